@@ -5,17 +5,24 @@
 //---------------------------------------------------------------------------//
 //! \file celer-dump-data.cc
 //---------------------------------------------------------------------------//
+#include <cmath>
 #include <cstdlib>
 #include <iomanip>
 #include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #include "corecel/cont/Range.hh"
+#include "corecel/data/Collection.hh"
 #include "corecel/io/Join.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/sys/MpiCommunicator.hh"
 #include "corecel/sys/ScopedMpiInit.hh"
 #include "celeritas/ext/RootImporter.hh"
 #include "celeritas/ext/ScopedRootErrorHandler.hh"
+#include "celeritas/grid/ValueGridInserter.hh"
+#include "celeritas/grid/XsGridData.hh"
 #include "celeritas/io/ImportData.hh"
 #include "celeritas/phys/ParticleParams.hh"
 
@@ -463,9 +470,115 @@ void print_atomic_relaxation_data(
     cout << endl;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Count the points of a physics vector after resampling for spline lookup.
+ *
+ * This uses the same resampling as physics tables built with a nonzero
+ * \c PhysicsParamsOptions::spline_tolerance , except that each vector is
+ * resampled separately rather than concatenated with its scaled counterpart.
+ */
+size_type calc_resampled_size(const ImportPhysicsVector& vec,
+                              ImportTableType            table_type,
+                              real_type                  tol)
+{
+    CELER_EXPECT(vec.x.size() == vec.y.size());
+
+    Collection<real_type, Ownership::value, MemSpace::host>  reals;
+    Collection<XsGridData, Ownership::value, MemSpace::host> grids;
+    ValueGridInserter insert(&reals, &grids, true, tol);
+
+    // Scaled cross sections are stored as E * xs
+    const size_type prime_index = table_type == ImportTableType::lambda_prim
+                                      ? 0
+                                      : XsGridData::no_scaling();
+    auto grid_id = insert(UniformGridData::from_bounds(std::log(vec.x.front()),
+                                                       std::log(vec.x.back()),
+                                                       vec.x.size()),
+                          prime_index,
+                          make_span(vec.y));
+    return grids[grid_id].log_energy.size;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Print the sizes of cross section and energy loss tables after resampling.
+ *
+ * Spline-interpolated tables store a second derivative for each value, so the
+ * memory saved is the difference between the number of original points and
+ * twice the number of resampled points.
+ */
+void print_resampled_tables(const ImportData&     data,
+                            const ParticleParams& particles,
+                            real_type             tol)
+{
+    CELER_LOG(info) << "Resampling physics tables to a relative tolerance of "
+                    << tol;
+
+    cout << R"gfm(
+# Resampled tables
+
+| Particle      | Process        | Table         | Points | Resampled |
+| ------------- | -------------- | ------------- | ------ | --------- |
+)gfm";
+
+    size_type total_points    = 0;
+    size_type total_resampled = 0;
+    for (const ImportProcess& proc : data.processes)
+    {
+        for (const ImportPhysicsTable& table : proc.tables)
+        {
+            if (table.table_type != ImportTableType::lambda
+                && table.table_type != ImportTableType::lambda_prim
+                && table.table_type != ImportTableType::dedx)
+            {
+                // Range tables must be linearly interpolated
+                continue;
+            }
+
+            size_type num_points    = 0;
+            size_type num_resampled = 0;
+            for (const auto& vec : table.physics_vectors)
+            {
+                num_points += vec.x.size();
+                num_resampled
+                    += (vec.vector_type == ImportPhysicsVectorType::log
+                        && vec.x.size() > 2)
+                           ? calc_resampled_size(vec, table.table_type, tol)
+                           : vec.x.size();
+            }
+            total_points += num_points;
+            total_resampled += num_resampled;
+
+            cout << "| " << setw(13) << std::left
+                 << particles.id_to_label(
+                        particles.find(PDGNumber{proc.particle_pdg}))
+                 << " | " << setw(14) << to_cstring(proc.process_class)
+                 << " | " << setw(13) << to_cstring(table.table_type) << " | "
+                 << setw(6) << num_points << " | " << setw(9) << num_resampled
+                 << " |\n";
+        }
+    }
+
+    const auto linear_bytes = total_points * sizeof(real_type);
+    const auto spline_bytes = 2 * total_resampled * sizeof(real_type);
+    cout << "\nLinear tables: " << total_points << " points ("
+         << linear_bytes / 1024.0 << " KiB)\n"
+         << "Spline tables: " << total_resampled << " points ("
+         << spline_bytes / 1024.0 << " KiB)\n"
+         << "Memory saved: " << setprecision(3)
+         << 100 * (1 - real_type(spline_bytes) / linear_bytes) << "%\n"
+         << endl;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Dump the contents of a ROOT file writen by celer-export-geant.
+ *
+ * If a relative tolerance is given as a second argument, also report how much
+ * smaller the cross section and energy loss tables can be made by resampling
+ * them for spline interpolation (see
+ * \c PhysicsParamsOptions::spline_tolerance ).
  */
 int main(int argc, char* argv[])
 {
@@ -478,13 +591,39 @@ int main(int argc, char* argv[])
         return EXIT_FAILURE;
     }
 
-    if (argc != 2)
+    auto print_usage = [argv] {
+        std::cerr << "Usage: " << argv[0] << " {output}.root [tolerance]"
+                  << std::endl;
+    };
+
+    if (argc != 2 && argc != 3)
     {
         // If number of arguments is incorrect, print help
-        std::cerr << "Usage: " << argv[0] << " {output}.root" << std::endl;
+        print_usage();
         return 2;
     }
 
+    real_type resample_tol = 0;
+    if (argc == 3)
+    {
+        try
+        {
+            resample_tol = std::stod(argv[2]);
+        }
+        catch (const std::logic_error&)
+        {
+            // Not a number or out of range
+            print_usage();
+            return 2;
+        }
+        if (!(resample_tol > 0 && resample_tol < 1))
+        {
+            CELER_LOG(critical) << "Invalid resampling tolerance "
+                                << resample_tol;
+            return 2;
+        }
+    }
+
     ImportData data;
     try
     {
@@ -513,6 +652,10 @@ int main(int argc, char* argv[])
     print_sb_data(data.sb_data);
     print_livermore_pe_data(data.livermore_pe_data);
     print_atomic_relaxation_data(data.atomic_relaxation_data);
+    if (resample_tol > 0)
+    {
+        print_resampled_tables(data, *particle_params, resample_tol);
+    }
 
     return EXIT_SUCCESS;
 }
@@ -56,6 +56,12 @@ GlobalSetup::GlobalSetup()
             = celeritas::Device::num_devices() > 0 ? 524288 : 64;
         cmd.SetDefaultValue(std::to_string(options_->max_num_tracks));
     }
+    {
+        auto& cmd = messenger_->DeclareProperty("stageBatchSize",
+                                                options_->stage_batch_size);
+        cmd.SetGuidance("Set the number of offloaded tracks uploaded at once");
+        cmd.SetDefaultValue("0");
+    }
     {
         auto& cmd = messenger_->DeclareProperty("maxNumEvents",
                                                 options_->max_num_events);
@@ -11,6 +11,7 @@
 #include <set>
 #include <string>
 
+#include "celeritas_config.h"
 #include "corecel/cont/Array.json.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/io/StringUtils.hh"
@@ -21,6 +22,7 @@
 #include "celeritas/field/UniformFieldData.hh"
 #include "celeritas/geo/GeoMaterialParams.hh"
 #include "celeritas/geo/GeoParams.hh" // IWYU pragma: keep
+#include "celeritas/geo/WoodcockParams.hh"
 #include "celeritas/global/ActionRegistry.hh"
 #include "celeritas/global/alongstep/AlongStepGeneralLinearAction.hh"
 #include "celeritas/global/alongstep/AlongStepUniformMscAction.hh"
@@ -114,6 +116,23 @@ void to_json(nlohmann::json& j, const LDemoArgs& v)
     {
         j["step_limiter"] = v.step_limiter;
     }
+    if (!v.woodcock_regions.empty())
+    {
+        j["woodcock_regions"] = v.woodcock_regions;
+    }
+    if (v.host_threads > 0)
+    {
+        j["host_threads"]    = v.host_threads;
+        j["host_grain_size"] = v.host_grain_size;
+    }
+    if (v.fused_chunk_size > 0)
+    {
+        j["fused_chunk_size"] = v.fused_chunk_size;
+    }
+    if (v.reorder_period > 0)
+    {
+        j["reorder_period"] = v.reorder_period;
+    }
     if (ends_with(v.physics_filename, ".gdml"))
     {
         j["geant_options"] = v.geant_options;
@@ -164,6 +183,22 @@ void from_json(const nlohmann::json& j, LDemoArgs& v)
     j.at("enable_diagnostics").get_to(v.enable_diagnostics);
     j.at("use_device").get_to(v.use_device);
     j.at("sync").get_to(v.sync);
+    if (j.contains("host_threads"))
+    {
+        j.at("host_threads").get_to(v.host_threads);
+    }
+    if (j.contains("host_grain_size"))
+    {
+        j.at("host_grain_size").get_to(v.host_grain_size);
+    }
+    if (j.contains("fused_chunk_size"))
+    {
+        j.at("fused_chunk_size").get_to(v.fused_chunk_size);
+    }
+    if (j.contains("reorder_period"))
+    {
+        j.at("reorder_period").get_to(v.reorder_period);
+    }
     if (j.contains("mag_field"))
     {
         j.at("mag_field").get_to(v.mag_field);
@@ -176,6 +211,10 @@ void from_json(const nlohmann::json& j, LDemoArgs& v)
     {
         j.at("step_limiter").get_to(v.step_limiter);
     }
+    if (j.contains("woodcock_regions"))
+    {
+        j.at("woodcock_regions").get_to(v.woodcock_regions);
+    }
 
     j.at("brem_combined").get_to(v.brem_combined);
 
@@ -291,13 +330,25 @@ TransporterInput load_input(const LDemoArgs& args)
     bool eloss = imported_data.em_params.energy_loss_fluct;
     if (args.mag_field == LDemoArgs::no_field())
     {
+        // Group volumes for Woodcock tracking of neutral particles
+        std::shared_ptr<const WoodcockParams> woodcock;
+        if (!args.woodcock_regions.empty())
+        {
+            WoodcockParams::Input input;
+            input.geometry    = params.geometry;
+            input.geomaterial = params.geomaterial;
+            input.regions     = args.woodcock_regions;
+            woodcock          = std::make_shared<WoodcockParams>(input);
+        }
+
         // Create along-step action
         auto along_step = AlongStepGeneralLinearAction::from_params(
             params.action_reg->next_id(),
             *params.material,
             *params.particle,
             *params.physics,
-            eloss);
+            eloss,
+            std::move(woodcock));
         params.action_reg->insert(along_step);
     }
     else
@@ -305,6 +356,9 @@ TransporterInput load_input(const LDemoArgs& args)
         CELER_VALIDATE(!eloss,
                        << "energy loss fluctuations are not supported "
                           "simultaneoulsy with magnetic field");
+        CELER_VALIDATE(args.woodcock_regions.empty(),
+                       << "Woodcock tracking regions are not supported "
+                          "simultaneously with magnetic field");
         UniformFieldParams field_params;
         field_params.field   = args.mag_field;
         field_params.options = args.field_options;
@@ -354,10 +408,20 @@ TransporterInput load_input(const LDemoArgs& args)
                    << "nonpositive max_num_tracks=" << args.max_num_tracks);
     CELER_VALIDATE(args.max_steps > 0,
                    << "nonpositive max_steps=" << args.max_steps);
-    result.num_track_slots    = args.max_num_tracks;
-    result.max_steps          = args.max_steps;
-    result.enable_diagnostics = args.enable_diagnostics;
-    result.sync               = args.sync;
+    CELER_VALIDATE(args.reorder_period == 0 || !CELERITAS_USE_VECGEOM,
+                   << "reorder_period=" << args.reorder_period
+                   << " is not supported with VecGeom geometry");
+    result.num_track_slots       = args.max_num_tracks;
+    result.max_steps             = args.max_steps;
+    result.enable_diagnostics    = args.enable_diagnostics;
+    result.sync                  = args.sync;
+    result.host_pool.num_threads = args.host_threads;
+    result.fused_chunk_size      = args.fused_chunk_size;
+    result.reorder_period        = args.reorder_period;
+    if (args.host_grain_size > 0)
+    {
+        result.host_pool.grain_size = args.host_grain_size;
+    }
 
     // Save diagnosics
     result.energy_diag = args.energy_diag;
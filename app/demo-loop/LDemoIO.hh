@@ -8,6 +8,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <vector>
 #include <nlohmann/json.hpp>
 
@@ -55,6 +56,10 @@ struct LDemoArgs
     bool         enable_diagnostics{};
     bool         use_device{};
     bool         sync{};
+    size_type    host_threads{};
+    size_type    host_grain_size{};
+    size_type    fused_chunk_size{};
+    size_type    reorder_period{};
 
     // Magnetic field vector [* 1/Tesla] and associated field options
     Real3                         mag_field{no_field()};
@@ -64,6 +69,9 @@ struct LDemoArgs
     // (non-positive for unused)
     real_type step_limiter{};
 
+    // Optional volume names of each Woodcock tracking region for neutrals
+    std::vector<std::vector<std::string>> woodcock_regions;
+
     // Options for physics
     bool brem_combined{true};
 
@@ -9,6 +9,7 @@
 
 #include <csignal>
 #include <memory>
+#include <numeric>
 #include <type_traits>
 
 #include "corecel/Assert.hh"
@@ -168,11 +169,19 @@ TransporterResult Transporter<M>::operator()(SpanConstPrimary primaries)
         result.initializers.reserve(input_.max_steps);
         result.active.reserve(input_.max_steps);
         result.alive.reserve(input_.max_steps);
+        result.secondaries.reserve(input_.max_steps);
     }
     auto append_track_counts = [&result](const StepperResult& track_counts) {
         result.initializers.push_back(track_counts.queued);
         result.active.push_back(track_counts.active);
         result.alive.push_back(track_counts.alive);
+        result.secondaries.push_back(track_counts.secondaries);
+        if (track_counts.mixed_before > 0)
+        {
+            // Track states were reordered and weren't already grouped
+            result.mixed_before.push_back(track_counts.mixed_before);
+            result.mixed_after.push_back(track_counts.mixed_after);
+        }
     };
 
     // Abort cleanly for interrupt and user-defined signals
@@ -180,9 +189,12 @@ TransporterResult Transporter<M>::operator()(SpanConstPrimary primaries)
     CELER_LOG(status) << "Transporting";
 
     StepperInput input;
-    input.params          = input_.params;
-    input.num_track_slots = input_.num_track_slots;
-    input.sync            = input_.sync;
+    input.params           = input_.params;
+    input.num_track_slots  = input_.num_track_slots;
+    input.sync             = input_.sync;
+    input.host_pool        = input_.host_pool;
+    input.fused_chunk_size = input_.fused_chunk_size;
+    input.reorder_period   = input_.reorder_period;
     Stepper<M> step(std::move(input));
 
     Stopwatch get_step_time;
@@ -215,6 +227,38 @@ TransporterResult Transporter<M>::operator()(SpanConstPrimary primaries)
         result.time.steps.push_back(get_step_time());
     }
 
+    // Report the secondary stack usage for tuning the stack factor
+    CELER_LOG(info) << "Peak secondary stack usage was "
+                    << step.max_secondaries() << " ("
+                    << static_cast<double>(step.max_secondaries())
+                           / input_.num_track_slots
+                    << " per track slot)";
+
+    // Report the effect of reordering on physics table locality
+    if (!result.mixed_before.empty())
+    {
+        CELER_LOG(info)
+            << "Reordering track states reduced the number of neighboring "
+               "tracks using different physics tables from "
+            << std::accumulate(
+                   result.mixed_before.begin(), result.mixed_before.end(), 0.0)
+            << " to "
+            << std::accumulate(
+                   result.mixed_after.begin(), result.mixed_after.end(), 0.0);
+    }
+
+    // Compare host execution modes by the rate of track steps
+    {
+        double num_track_steps = std::accumulate(
+            result.active.begin(), result.active.end(), 0.0);
+        double step_time = std::accumulate(
+            result.time.steps.begin(), result.time.steps.end(), 0.0);
+        if (step_time > 0)
+        {
+            result.time.throughput = num_track_steps / step_time;
+        }
+    }
+
     // Save kernel timing if host or synchronization is enabled
     if (M == MemSpace::host || input_.sync)
     {
@@ -17,6 +17,7 @@
 #include "corecel/cont/Range.hh"
 #include "corecel/cont/Span.hh"
 #include "corecel/math/NumericLimits.hh"
+#include "corecel/sys/ThreadPool.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/global/CoreParams.hh"
 
@@ -60,6 +61,9 @@ struct TransporterInput
     std::shared_ptr<const CoreParams> params;
     size_type num_track_slots{}; //!< AKA max_num_tracks
     bool sync{false}; //!< Whether to synchronize device between actions
+    celeritas::ThreadPool::Options host_pool; //!< Host thread pool options
+    size_type fused_chunk_size{0}; //!< Fuse host actions over track chunks
+    size_type reorder_period{0};   //!< Steps between sorting track states
 
     // Loop control
     size_type max_steps{};
@@ -83,10 +87,11 @@ struct TransporterTiming
     using VecReal    = std::vector<real_type>;
     using MapStrReal = std::unordered_map<std::string, real_type>;
 
-    VecReal    steps;     //!< Real time per step
-    real_type  total{};   //!< Total simulation time
-    real_type  setup{};   //!< One-time initialization cost
-    MapStrReal actions{}; //!< Accumulated action timing
+    VecReal    steps;        //!< Real time per step
+    real_type  total{};      //!< Total simulation time
+    real_type  setup{};      //!< One-time initialization cost
+    real_type  throughput{}; //!< Track steps per second of step time
+    MapStrReal actions{};    //!< Accumulated action timing
 };
 
 //---------------------------------------------------------------------------//
@@ -108,6 +113,9 @@ struct TransporterResult
     VecCount          initializers; //!< Num starting track initializers
     VecCount          active;       //!< Num tracks active at beginning of step
     VecCount          alive;        //!< Num living tracks at end of step
+    VecCount          secondaries;  //!< Num secondaries requested in step
+    VecCount          mixed_before; //!< Neighbors with different tables
+    VecCount          mixed_after;  //!< Same, after reordering
     VecReal           edep;         //!< Energy deposition along the grid
     MapStringCount    process;      //!< Count of particle/process interactions
     MapStringVecCount steps;        //!< Distribution of steps
@@ -20,6 +20,7 @@ inline void to_json(nlohmann::json& j, const TransporterTiming& v)
     j = nlohmann::json{{"steps", v.steps},
                        {"total", v.total},
                        {"setup", v.setup},
+                       {"throughput", v.throughput},
                        {"actions", v.actions}};
 }
 
@@ -28,10 +29,16 @@ inline void to_json(nlohmann::json& j, const TransporterResult& v)
     j = nlohmann::json{{"initializers", v.initializers},
                        {"active", v.active},
                        {"alive", v.alive},
+                       {"secondaries", v.secondaries},
                        {"edep", v.edep},
                        {"process", v.process},
                        {"steps", v.steps},
                        {"time", v.time}};
+    if (!v.mixed_before.empty())
+    {
+        j["mixed_before"] = v.mixed_before;
+        j["mixed_after"]  = v.mixed_after;
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -17,8 +17,11 @@ namespace demo_rasterizer
 //---------------------------------------------------------------------------//
 /*!
  * Construct with image slice and extents.
+ *
+ * The image is allocated only in the memory space where it will be traced.
  */
-ImageStore::ImageStore(ImageRunArgs params)
+ImageStore::ImageStore(ImageRunArgs params, MemSpace memspace)
+    : memspace_(memspace)
 {
     CELER_EXPECT(celeritas::is_soft_unit_vector(params.rightward_ax));
     CELER_EXPECT(params.lower_left != params.upper_right);
@@ -63,16 +66,24 @@ ImageStore::ImageStore(ImageRunArgs params)
 
     // Allocate storage
     dims_  = {num_y, num_x};
-    image_ = celeritas::DeviceVector<int>(num_y * num_x);
-    CELER_ENSURE(!image_.empty());
+    if (memspace_ == MemSpace::device)
+    {
+        image_ = celeritas::DeviceVector<int>(num_y * num_x);
+    }
+    else
+    {
+        host_image_.assign(num_y * num_x, -1);
+    }
+    CELER_ENSURE(!image_.empty() || !host_image_.empty());
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Access image on host for initializing.
+ * Access image on host for writing.
  */
 ImageData ImageStore::host_interface()
 {
+    CELER_EXPECT(memspace_ == MemSpace::host);
     ImageData result;
 
     result.origin      = origin_;
@@ -80,6 +91,7 @@ ImageData ImageStore::host_interface()
     result.right_ax    = right_ax_;
     result.pixel_width = pixel_width_;
     result.dims        = dims_;
+    result.image       = celeritas::make_span(host_image_);
 
     return result;
 }
@@ -90,6 +102,7 @@ ImageData ImageStore::host_interface()
  */
 ImageData ImageStore::device_interface()
 {
+    CELER_EXPECT(memspace_ == MemSpace::device);
     ImageData result;
 
     result.origin      = origin_;
@@ -108,6 +121,11 @@ ImageData ImageStore::device_interface()
  */
 auto ImageStore::data_to_host() const -> VecInt
 {
+    if (memspace_ == MemSpace::host)
+    {
+        return host_image_;
+    }
+
     VecInt result(dims_[0] * dims_[1]);
     image_.copy_to_host(celeritas::make_span(result));
     return result;
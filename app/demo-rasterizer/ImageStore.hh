@@ -33,22 +33,26 @@ class ImageStore
     using UInt2     = celeritas::Array<unsigned int, 2>;
     using Real3     = celeritas::Real3;
     using VecInt    = std::vector<int>;
+    using MemSpace  = celeritas::MemSpace;
     //!@}
 
   public:
-    // Construct with defaults
-    explicit ImageStore(ImageRunArgs);
+    // Construct with image parameters and the memory space to trace in
+    ImageStore(ImageRunArgs, MemSpace memspace);
 
     //// DEVICE ACCESSORS ////
 
-    //! Access image on host for initializing
+    // Access image on host for writing
     ImageData host_interface();
 
-    //! Access image on device for writing
+    // Access image on device for writing
     ImageData device_interface();
 
     //// HOST ACCESSORS ////
 
+    //! Memory space in which the image is stored
+    MemSpace memspace() const { return memspace_; }
+
     //! Upper left corner of the image
     const Real3& origin() const { return origin_; }
 
@@ -73,6 +77,8 @@ class ImageStore
     Real3                        right_ax_;
     real_type                    pixel_width_;
     UInt2                        dims_;
+    MemSpace                     memspace_;
+    VecInt                       host_image_;
     celeritas::DeviceVector<int> image_;
 };
 
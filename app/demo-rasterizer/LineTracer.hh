@@ -0,0 +1,111 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020-2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file demo-rasterizer/LineTracer.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "celeritas/geo/GeoTrackView.hh"
+
+#include "ImageTrackView.hh"
+
+namespace demo_rasterizer
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Get the volume ID as an integer, or -1 if outside.
+ */
+inline CELER_FUNCTION int geo_id(const celeritas::GeoTrackView& geo)
+{
+    if (geo.is_outside())
+        return -1;
+    return geo.volume_id().get();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Trace a single row of the image.
+ *
+ * Each pixel is assigned the ID of the volume that occupies the largest
+ * fraction of its width along the row. This is shared by the host and device
+ * implementations so that they produce identical images.
+ */
+inline CELER_FUNCTION void trace_line(celeritas::GeoTrackView& geo,
+                                      ImageTrackView&          image,
+                                      unsigned int             num_pixels)
+{
+    using celeritas::GeoTrackInitializer;
+    using celeritas::Real3;
+    using celeritas::real_type;
+
+    // Start track at the leftmost point in the requested direction
+    geo = GeoTrackInitializer{image.start_pos(), image.start_dir()};
+
+    int cur_id = geo_id(geo);
+
+    // Track along each pixel
+    for (unsigned int i = 0; i < num_pixels; ++i)
+    {
+        real_type pix_dist      = image.pixel_width();
+        real_type max_dist      = 0;
+        int       max_id        = cur_id;
+        int       abort_counter = 32; // max number of crossings per pixel
+
+        auto next = geo.find_next_step(pix_dist);
+        while (next.boundary && pix_dist > 0)
+        {
+            CELER_ASSERT(next.distance <= pix_dist);
+            // Move to geometry boundary
+            pix_dist -= next.distance;
+
+            if (max_id == cur_id)
+            {
+                max_dist += next.distance;
+            }
+            else if (next.distance > max_dist)
+            {
+                max_dist = next.distance;
+                max_id   = cur_id;
+            }
+
+            // Cross surface and update post-crossing ID
+            geo.move_to_boundary();
+            geo.cross_boundary();
+            cur_id = geo_id(geo);
+
+            if (--abort_counter == 0)
+            {
+                // Reinitialize at end of pixel
+                Real3 new_pos = image.start_pos();
+                celeritas::axpy(
+                    (i + 1) * image.pixel_width(), image.start_dir(), &new_pos);
+                geo      = GeoTrackInitializer{new_pos, image.start_dir()};
+                pix_dist = 0;
+            }
+            if (pix_dist > 0)
+            {
+                // Next movement is to end of geo or pixel
+                next = geo.find_next_step(pix_dist);
+            }
+        }
+
+        if (pix_dist > 0)
+        {
+            // Move to pixel boundary
+            geo.move_internal(pix_dist);
+            if (pix_dist > max_dist)
+            {
+                max_dist = pix_dist;
+                max_id   = cur_id;
+            }
+        }
+        image.set_pixel(i, max_id);
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_rasterizer
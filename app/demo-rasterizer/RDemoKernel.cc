@@ -0,0 +1,52 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020-2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file demo-rasterizer/RDemoKernel.cc
+//---------------------------------------------------------------------------//
+#include "RDemoKernel.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/sys/MultiExceptionHandler.hh"
+#include "celeritas/geo/GeoTrackView.hh"
+
+#include "ImageTrackView.hh"
+#include "LineTracer.hh"
+
+using namespace celeritas;
+
+namespace demo_rasterizer
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Trace an image on the host.
+ *
+ * Each row of the image is an independent track, so rows are dynamically
+ * scheduled in small tiles among the available threads: the cost of a row
+ * depends on the number of surface crossings along it.
+ */
+void trace(const GeoParamsCRefHost& geo_params,
+           const GeoStateRefHost&   geo_state,
+           const ImageData&         image)
+{
+    CELER_EXPECT(image);
+    CELER_EXPECT(geo_state.size() >= image.dims[0]);
+
+    auto trace_row = [&](ThreadId tid) {
+        ImageTrackView row(image, tid);
+        GeoTrackView   geo(geo_params, geo_state, tid);
+        trace_line(geo, row, image.dims[1]);
+    };
+
+    MultiExceptionHandler capture_exception;
+#pragma omp parallel for schedule(dynamic, 4)
+    for (size_type j = 0; j < image.dims[0]; ++j)
+    {
+        CELER_TRY_ELSE(trace_row(ThreadId{j}), capture_exception);
+    }
+    log_and_rethrow(std::move(capture_exception));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_rasterizer
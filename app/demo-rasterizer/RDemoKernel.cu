@@ -7,13 +7,12 @@
 //---------------------------------------------------------------------------//
 #include "RDemoKernel.hh"
 
-#include <cmath>
-
 #include "corecel/Assert.hh"
 #include "corecel/sys/KernelParamCalculator.device.hh"
 #include "celeritas/geo/GeoTrackView.hh"
 
 #include "ImageTrackView.hh"
+#include "LineTracer.hh"
 
 using namespace celeritas;
 using namespace demo_rasterizer;
@@ -26,13 +25,6 @@ namespace
 // KERNELS
 //---------------------------------------------------------------------------//
 
-__device__ int geo_id(const GeoTrackView& geo)
-{
-    if (geo.is_outside())
-        return -1;
-    return geo.volume_id().get();
-}
-
 __global__ void trace_kernel(const GeoParamsCRefDevice geo_params,
                              const GeoStateRefDevice   geo_state,
                              const ImageData           image_state)
@@ -43,71 +35,7 @@ __global__ void trace_kernel(const GeoParamsCRefDevice geo_params,
 
     ImageTrackView image(image_state, tid);
     GeoTrackView   geo(geo_params, geo_state, tid);
-
-    // Start track at the leftmost point in the requested direction
-    geo = GeoTrackInitializer{image.start_pos(), image.start_dir()};
-
-    int cur_id = geo_id(geo);
-
-    // Track along each pixel
-    for (unsigned int i = 0; i < image_state.dims[1]; ++i)
-    {
-        real_type pix_dist      = image_state.pixel_width;
-        real_type max_dist      = 0;
-        int       max_id        = cur_id;
-        int       abort_counter = 32; // max number of crossings per pixel
-
-        auto next = geo.find_next_step(pix_dist);
-        while (next.boundary && pix_dist > 0)
-        {
-            CELER_ASSERT(next.distance <= pix_dist);
-            // Move to geometry boundary
-            pix_dist -= next.distance;
-
-            if (max_id == cur_id)
-            {
-                max_dist += next.distance;
-            }
-            else if (next.distance > max_dist)
-            {
-                max_dist = next.distance;
-                max_id   = cur_id;
-            }
-
-            // Cross surface and update post-crossing ID
-            geo.move_to_boundary();
-            geo.cross_boundary();
-            cur_id = geo_id(geo);
-
-            if (--abort_counter == 0)
-            {
-                // Reinitialize at end of pixel
-                Real3 new_pos = image.start_pos();
-                celeritas::axpy((i + 1) * image_state.pixel_width,
-                                image.start_dir(),
-                                &new_pos);
-                geo      = GeoTrackInitializer{new_pos, image.start_dir()};
-                pix_dist = 0;
-            }
-            if (pix_dist > 0)
-            {
-                // Next movement is to end of geo or pixel
-                next = geo.find_next_step(pix_dist);
-            }
-        }
-
-        if (pix_dist > 0)
-        {
-            // Move to pixel boundary
-            geo.move_internal(pix_dist);
-            if (pix_dist > max_dist)
-            {
-                max_dist = pix_dist;
-                max_id   = cur_id;
-            }
-        }
-        image.set_pixel(i, max_id);
-    }
+    trace_line(geo, image, image_state.dims[1]);
 }
 } // namespace
 
@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
 #include "celeritas/geo/GeoData.hh"
 
 #include "ImageData.hh"
@@ -15,12 +17,33 @@ namespace demo_rasterizer
 {
 //---------------------------------------------------------------------------//
 
+using GeoParamsCRefHost   = celeritas::HostCRef<celeritas::GeoParamsData>;
+using GeoStateRefHost     = celeritas::HostRef<celeritas::GeoStateData>;
 using GeoParamsCRefDevice = celeritas::DeviceCRef<celeritas::GeoParamsData>;
 using GeoStateRefDevice   = celeritas::DeviceRef<celeritas::GeoStateData>;
 
+// Trace an image on the host, with rows distributed among OpenMP threads
+void trace(const GeoParamsCRefHost& geo_params,
+           const GeoStateRefHost&   geo_state,
+           const ImageData&         image);
+
+// Trace an image on the device, with one thread per row
 void trace(const GeoParamsCRefDevice& geo_params,
            const GeoStateRefDevice&   geo_state,
            const ImageData&           image);
 
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+
+#if !CELER_USE_DEVICE
+inline void trace(const GeoParamsCRefDevice&,
+                  const GeoStateRefDevice&,
+                  const ImageData&)
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
 //---------------------------------------------------------------------------//
 } // namespace demo_rasterizer
@@ -39,21 +39,50 @@ void RDemoRunner::operator()(ImageStore* image, int ntimes) const
 {
     CELER_EXPECT(image);
 
-    CollectionStateStore<GeoStateData, MemSpace::device> geo_state(
-        geo_params_->host_ref(), image->dims()[0]);
+    if (image->memspace() == MemSpace::host)
+    {
+        this->trace_impl<MemSpace::host>(
+            image, ntimes, [this, image](const HostRef<GeoStateData>& state) {
+                trace(geo_params_->host_ref(), state, image->host_interface());
+            });
+    }
+    else
+    {
+        this->trace_impl<MemSpace::device>(
+            image, ntimes, [this, image](const DeviceRef<GeoStateData>& state) {
+                trace(geo_params_->device_ref(),
+                      state,
+                      image->device_interface());
+            });
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate geometry states and time the tracing of an image.
+ */
+template<MemSpace M, class F>
+void RDemoRunner::trace_impl(ImageStore* image,
+                             int         ntimes,
+                             F&&         trace_image) const
+{
+    CollectionStateStore<GeoStateData, M> geo_state(geo_params_->host_ref(),
+                                                    image->dims()[0]);
+
+    const double num_pixels = double(image->dims()[0]) * image->dims()[1];
 
-    CELER_LOG(status) << "Tracing geometry";
+    CELER_LOG(status) << "Tracing geometry on "
+                      << (M == MemSpace::host ? "host" : "device");
     // do it ntimes+1 as first one tends to be a warm-up run (slightly longer)
     double sum = 0, time = 0;
     for (int i = 0; i <= ntimes; ++i)
     {
         Stopwatch get_time;
-        trace(geo_params_->device_ref(),
-              geo_state.ref(),
-              image->device_interface());
+        trace_image(geo_state.ref());
         time = get_time();
         CELER_LOG(info) << color_code('x') << "Elapsed " << i << ": " << time
-                        << " s" << color_code(' ');
+                        << " s (" << time / num_pixels << " s/pixel)"
+                        << color_code(' ');
         if (i > 0)
         {
             sum += time;
@@ -62,7 +91,8 @@ void RDemoRunner::operator()(ImageStore* image, int ntimes) const
     if (ntimes > 0)
     {
         CELER_LOG(info) << color_code('x')
-                        << "\tAverage time: " << sum / ntimes << " s"
+                        << "\tAverage time: " << sum / ntimes << " s ("
+                        << sum / (ntimes * num_pixels) << " s/pixel)"
                         << color_code(' ');
     }
 }
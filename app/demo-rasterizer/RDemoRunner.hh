@@ -17,7 +17,11 @@ namespace demo_rasterizer
 {
 //---------------------------------------------------------------------------//
 /*!
- * Set up and run rasterization of the given device image.
+ * Set up and run rasterization of the given image.
+ *
+ * The image is traced on the host or device depending on where its storage
+ * lives. The elapsed time is reported per pixel so that host and device
+ * geometry throughput can be compared directly.
  */
 class RDemoRunner
 {
@@ -37,6 +41,9 @@ class RDemoRunner
 
   private:
     SPConstGeo geo_params_;
+
+    template<celeritas::MemSpace M, class F>
+    void trace_impl(ImageStore* image, int ntimes, F&& trace_image) const;
 };
 
 //---------------------------------------------------------------------------//
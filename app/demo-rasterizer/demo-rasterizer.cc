@@ -13,6 +13,7 @@
 #include <nlohmann/json.hpp>
 
 #include "celeritas_version.h"
+#include "corecel/Assert.hh"
 #include "corecel/cont/Range.hh"
 #include "corecel/io/ColorUtils.hh"
 #include "corecel/io/Logger.hh"
@@ -59,15 +60,25 @@ void run(std::istream& is)
         inp.at("input").get<std::string>().c_str());
     timers["load"] = get_time();
 
+    // Trace on the device if available unless the host is requested
+    bool use_device = static_cast<bool>(celeritas::device());
+    if (inp.contains("use_device"))
+    {
+        inp.at("use_device").get_to(use_device);
+        CELER_VALIDATE(!use_device || celeritas::device(),
+                       << "device tracing was requested but no device is "
+                          "available");
+    }
+
     // Construct image
-    ImageStore image(inp.at("image").get<ImageRunArgs>());
+    ImageStore image(inp.at("image").get<ImageRunArgs>(),
+                     use_device ? MemSpace::device : MemSpace::host);
 
-    // Construct runner
+    // Construct runner, optionally repeating for performance measurement
     RDemoRunner run(geo_params);
     get_time = {};
-    run(&image);
+    run(&image, inp.value("repeats", 0));
     timers["trace"] = get_time();
-    // run(&image, 10); // Ntimes for performance measurement
 
     // Get geometry names
     std::vector<std::string> vol_names;
@@ -78,7 +89,7 @@ void run(std::istream& is)
     }
 
     // Write image
-    CELER_LOG(status) << "Transferring image from GPU to disk";
+    CELER_LOG(status) << "Transferring image to disk";
     get_time                 = {};
     std::string out_filename = inp.at("output");
     auto        image_data   = image.data_to_host();
@@ -93,6 +104,7 @@ void run(std::istream& is)
         {"metadata", image},
         {"data", out_filename},
         {"volumes", vol_names},
+        {"use_device", use_device},
         {"timers", timers},
         {
             "runtime",
@@ -152,14 +164,12 @@ int main(int argc, char* argv[])
         instream_ptr = &std::cin;
     }
 
-    // Initialize GPU
-    celeritas::activate_device(Device(0));
-
-    if (!celeritas::device())
-    {
-        CELER_LOG(critical) << "CUDA capability is disabled";
-        return EXIT_FAILURE;
-    }
+    // Initialize GPU if available; otherwise trace on the host
+    MpiCommunicator comm
+        = (ScopedMpiInit::status() == ScopedMpiInit::Status::disabled
+               ? MpiCommunicator{}
+               : MpiCommunicator::comm_world());
+    celeritas::activate_device(celeritas::make_device(comm));
 
     try
     {
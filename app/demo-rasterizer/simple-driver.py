@@ -11,9 +11,9 @@ from os import environ
 from sys import exit, argv
 
 try:
-    (gdml_filename,) = argv[1:]
+    (geo_filename,) = argv[1:]
 except TypeError:
-    print("usage: {} inp.gdml".format(sys.argv[0]))
+    print("usage: {} {{inp.gdml,inp.org.json}}".format(argv[0]))
     exit(2)
 
 inp = {
@@ -23,8 +23,8 @@ inp = {
         'rightward_ax': [1, 0, 0],
         'vertical_pixels': 32
     },
-    'input': gdml_filename,
-    'output': 'two-boxes.bin'
+    'input': geo_filename,
+    'output': 'rasterizer.bin'
 }
 
 exe = environ.get('CELERITAS_DEMO_EXE', './demo-rasterizer')
@@ -0,0 +1,94 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file geo-bench/GBenchIO.cc
+//---------------------------------------------------------------------------//
+#include "GBenchIO.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Array.json.hh"
+
+namespace geo_bench
+{
+//---------------------------------------------------------------------------//
+//!@{
+//! I/O routines for JSON
+void to_json(nlohmann::json& j, const GBenchInput& v)
+{
+    j = nlohmann::json{{"geometry_filename", v.geometry_filename},
+                       {"num_tracks", v.num_tracks},
+                       {"max_steps", v.max_steps},
+                       {"seed", v.seed},
+                       {"num_threads", v.num_threads}};
+    if (v.has_bbox())
+    {
+        j["lower"] = v.lower;
+        j["upper"] = v.upper;
+    }
+}
+
+void from_json(const nlohmann::json& j, GBenchInput& v)
+{
+    j.at("geometry_filename").get_to(v.geometry_filename);
+    j.at("num_tracks").get_to(v.num_tracks);
+    j.at("max_steps").get_to(v.max_steps);
+    if (j.contains("seed"))
+    {
+        j.at("seed").get_to(v.seed);
+    }
+    if (j.contains("num_threads"))
+    {
+        j.at("num_threads").get_to(v.num_threads);
+    }
+    if (j.contains("lower") || j.contains("upper"))
+    {
+        j.at("lower").get_to(v.lower);
+        j.at("upper").get_to(v.upper);
+        CELER_VALIDATE(v.has_bbox(),
+                       << "sampling box has zero size: lower and upper "
+                          "corners are the same");
+    }
+    for (int n : v.num_threads)
+    {
+        CELER_VALIDATE(n > 0, << "invalid number of threads " << n);
+    }
+}
+
+void to_json(nlohmann::json& j, const GBenchTiming& v)
+{
+    j = nlohmann::json{
+        {"calls", v.calls}, {"time", v.time}, {"rate", v.rate()}};
+}
+
+void to_json(nlohmann::json& j, const GBenchCounters& v)
+{
+    j = nlohmann::json{{"volumes_tested", v.volumes_tested},
+                       {"next_step_hits", v.next_step_hits},
+                       {"next_step_misses", v.next_step_misses},
+                       {"next_step_hit_rate", v.next_step_hit_rate()},
+                       {"safety_hits", v.safety_hits},
+                       {"safety_misses", v.safety_misses},
+                       {"safety_hit_rate", v.safety_hit_rate()}};
+}
+
+void to_json(nlohmann::json& j, const GBenchRun& v)
+{
+    j = nlohmann::json{{"num_threads", v.num_threads},
+                       {"initialize", v.initialize},
+                       {"find_safety", v.find_safety},
+                       {"find_next_step", v.find_next_step},
+                       {"move_to_boundary", v.move_to_boundary},
+                       {"cross_boundary", v.cross_boundary},
+                       {"counters", v.counters}};
+}
+
+void to_json(nlohmann::json& j, const GBenchResult& v)
+{
+    j = nlohmann::json{{"runs", v.runs}};
+}
+//!@}
+
+//---------------------------------------------------------------------------//
+} // namespace geo_bench
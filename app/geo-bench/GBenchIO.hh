@@ -0,0 +1,144 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file geo-bench/GBenchIO.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "corecel/Types.hh"
+#include "orange/Types.hh"
+
+namespace geo_bench
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Input for a geometry benchmark.
+ *
+ * Rays start at points sampled uniformly in a box with isotropic directions.
+ * If the box isn't given, the bounding box of an ORANGE geometry is used.
+ * Each ray is tracked until it leaves the geometry or reaches the maximum
+ * number of boundary crossings. The whole benchmark is repeated for each
+ * number of OpenMP threads; if none are given, the default number of threads
+ * is used.
+ */
+struct GBenchInput
+{
+    using Real3     = celeritas::Real3;
+    using size_type = celeritas::size_type;
+
+    // Problem definition
+    std::string geometry_filename; //!< Path to ORANGE JSON or GDML file
+    Real3       lower{0, 0, 0};    //!< Lower corner of the sampling box
+    Real3       upper{0, 0, 0};    //!< Upper corner of the sampling box
+
+    // Control
+    size_type        num_tracks{};
+    size_type        max_steps{};
+    unsigned int     seed{};
+    std::vector<int> num_threads;
+
+    //! Whether a sampling box was given
+    bool has_bbox() const { return lower != upper; }
+
+    //! Whether the input is valid
+    explicit operator bool() const
+    {
+        return !geometry_filename.empty() && num_tracks > 0 && max_steps > 0;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of calls to and total wall time of a single geometry operation.
+ */
+struct GBenchTiming
+{
+    celeritas::size_type calls{0};
+    double               time{0}; //!< [s]
+
+    //! Calls per second
+    double rate() const { return time > 0 ? calls / time : 0; }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * ORANGE profiling counters summed over all rays.
+ *
+ * These are zero for VecGeom geometry.
+ */
+struct GBenchCounters
+{
+    using size_type = celeritas::size_type;
+
+    //! Candidate volumes tested while initializing and crossing boundaries
+    size_type volumes_tested{0};
+
+    //!@{
+    //! Reuses and recalculations of the cached next step and safety
+    size_type next_step_hits{0};
+    size_type next_step_misses{0};
+    size_type safety_hits{0};
+    size_type safety_misses{0};
+    //!@}
+
+    //! Fraction of next step calls that reused the cached distance
+    double next_step_hit_rate() const
+    {
+        return calc_hit_rate(next_step_hits, next_step_misses);
+    }
+
+    //! Fraction of safety calls that reused the cached sphere
+    double safety_hit_rate() const
+    {
+        return calc_hit_rate(safety_hits, safety_misses);
+    }
+
+  private:
+    static double calc_hit_rate(size_type hits, size_type misses)
+    {
+        return hits + misses > 0 ? double(hits) / (hits + misses) : 0;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Timing of each geometry operation for a single thread count.
+ */
+struct GBenchRun
+{
+    int            num_threads{};
+    GBenchTiming   initialize;
+    GBenchTiming   find_safety;
+    GBenchTiming   find_next_step;
+    GBenchTiming   move_to_boundary;
+    GBenchTiming   cross_boundary;
+    GBenchCounters counters;
+};
+
+//---------------------------------------------------------------------------//
+//! Results of all runs
+struct GBenchResult
+{
+    std::vector<GBenchRun> runs;
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+
+void to_json(nlohmann::json& j, const GBenchInput& value);
+void from_json(const nlohmann::json& j, GBenchInput& value);
+
+void to_json(nlohmann::json& j, const GBenchTiming& value);
+void to_json(nlohmann::json& j, const GBenchCounters& value);
+void to_json(nlohmann::json& j, const GBenchRun& value);
+void to_json(nlohmann::json& j, const GBenchResult& value);
+
+//---------------------------------------------------------------------------//
+} // namespace geo_bench
@@ -0,0 +1,171 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file geo-bench/GBenchRunner.cc
+//---------------------------------------------------------------------------//
+#include "GBenchRunner.hh"
+
+#include <algorithm>
+#include <random>
+
+#include "celeritas_config.h"
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionStateStore.hh"
+#include "corecel/sys/MultiExceptionHandler.hh"
+#include "corecel/sys/Stopwatch.hh"
+#include "celeritas/geo/GeoParams.hh" // IWYU pragma: keep
+#include "celeritas/geo/GeoTrackView.hh"
+#include "celeritas/random/distribution/IsotropicDistribution.hh"
+#include "celeritas/random/distribution/UniformBoxDistribution.hh"
+
+using namespace celeritas;
+
+namespace geo_bench
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+using VecFlag = std::vector<char>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a function to every track with the flag set, and time it.
+ */
+template<class F>
+void launch(const VecFlag&        mask,
+            CELER_MAYBE_UNUSED int num_threads,
+            GBenchTiming*         timing,
+            F&&                   call_thread)
+{
+    timing->calls += std::count(mask.begin(), mask.end(), 1);
+
+    MultiExceptionHandler capture_exception;
+    Stopwatch             get_time;
+#pragma omp parallel for num_threads(num_threads)
+    for (size_type i = 0; i < mask.size(); ++i)
+    {
+        if (mask[i])
+        {
+            CELER_TRY_ELSE(call_thread(ThreadId{i}), capture_exception);
+        }
+    }
+    timing->time += get_time();
+    log_and_rethrow(std::move(capture_exception));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with geometry and input, sampling the rays.
+ */
+GBenchRunner::GBenchRunner(SPConstGeo geometry, const GBenchInput& inp)
+    : geo_(std::move(geometry)), max_steps_(inp.max_steps)
+{
+    CELER_EXPECT(geo_);
+    CELER_EXPECT(inp);
+
+    Real3 lower = inp.lower;
+    Real3 upper = inp.upper;
+    if (!inp.has_bbox())
+    {
+#if CELERITAS_USE_VECGEOM
+        CELER_VALIDATE(false,
+                       << "a sampling box (lower, upper) is required for "
+                          "VecGeom geometry");
+#else
+        lower = geo_->bbox().lower();
+        upper = geo_->bbox().upper();
+#endif
+    }
+
+    std::mt19937             rng(inp.seed);
+    UniformBoxDistribution<> sample_pos(lower, upper);
+    IsotropicDistribution<>  sample_dir;
+    inits_.resize(inp.num_tracks);
+    for (GeoTrackInitializer& init : inits_)
+    {
+        init.pos = sample_pos(rng);
+        init.dir = sample_dir(rng);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Track all rays with the given number of threads.
+ *
+ * Rays start with a safety calculation, then repeatedly find the next
+ * boundary, move to it, and cross it until they leave the geometry or reach
+ * the maximum number of steps.
+ */
+GBenchRun GBenchRunner::operator()(int num_threads) const
+{
+    CELER_EXPECT(num_threads > 0);
+
+    using StateStore = CollectionStateStore<GeoStateData, MemSpace::host>;
+
+    const auto& params = geo_->host_ref();
+    StateStore  states(params, inits_.size());
+    const auto& state_ref = states.ref();
+
+    auto make_geo = [&params, &state_ref](ThreadId tid) {
+        return GeoTrackView(params, state_ref, tid);
+    };
+
+    GBenchRun result;
+    result.num_threads = num_threads;
+
+    VecFlag alive(inits_.size(), 1);
+    launch(alive, num_threads, &result.initialize, [&](ThreadId tid) {
+        GeoTrackView geo = make_geo(tid);
+        geo              = inits_[tid.get()];
+        alive[tid.get()] = !geo.is_outside();
+    });
+
+    launch(alive, num_threads, &result.find_safety, [&](ThreadId tid) {
+        make_geo(tid).find_safety();
+    });
+
+    for (size_type step = 0; step < max_steps_; ++step)
+    {
+        launch(alive, num_threads, &result.find_next_step, [&](ThreadId tid) {
+            // Rays that don't hit a boundary are lost
+            alive[tid.get()] = make_geo(tid).find_next_step().boundary;
+        });
+        launch(alive, num_threads, &result.move_to_boundary, [&](ThreadId tid) {
+            make_geo(tid).move_to_boundary();
+        });
+        launch(alive, num_threads, &result.cross_boundary, [&](ThreadId tid) {
+            GeoTrackView geo = make_geo(tid);
+            geo.cross_boundary();
+            alive[tid.get()] = !geo.is_outside();
+        });
+        if (std::find(alive.begin(), alive.end(), 1) == alive.end())
+        {
+            break;
+        }
+    }
+
+#if !CELERITAS_USE_VECGEOM
+    // Sum the ORANGE profiling counters
+    GBenchCounters& counters = result.counters;
+    for (auto tid : range(ThreadId{state_ref.size()}))
+    {
+        counters.volumes_tested += state_ref.volumes_tested[tid];
+        counters.next_step_hits += state_ref.next_step_hits[tid];
+        counters.next_step_misses += state_ref.next_step_misses[tid];
+        counters.safety_hits += state_ref.safety_hits[tid];
+        counters.safety_misses += state_ref.safety_misses[tid];
+    }
+#endif
+
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace geo_bench
@@ -0,0 +1,51 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file geo-bench/GBenchRunner.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "celeritas/geo/GeoData.hh"
+#include "orange/Types.hh"
+#include "celeritas/geo/GeoParamsFwd.hh"
+
+#include "GBenchIO.hh"
+
+namespace geo_bench
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Time geometry operations for many random rays on the host.
+ *
+ * Each geometry operation is applied to all live tracks in a separate
+ * (OpenMP-parallel) loop, like a kernel, so that each operation is timed
+ * independently. The same rays are used for every run.
+ */
+class GBenchRunner
+{
+  public:
+    //!@{
+    //! Type aliases
+    using SPConstGeo = std::shared_ptr<const celeritas::GeoParams>;
+    //!@}
+
+  public:
+    // Construct with geometry and input, sampling the rays
+    GBenchRunner(SPConstGeo geometry, const GBenchInput& inp);
+
+    // Track all rays with the given number of threads
+    GBenchRun operator()(int num_threads) const;
+
+  private:
+    SPConstGeo                                  geo_;
+    celeritas::size_type                        max_steps_;
+    std::vector<celeritas::GeoTrackInitializer> inits_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace geo_bench
@@ -0,0 +1,145 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file geo-bench/geo-bench.cc
+//---------------------------------------------------------------------------//
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "celeritas_config.h"
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+
+#include "corecel/io/BuildOutput.hh"
+#include "corecel/io/ExceptionOutput.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/io/OutputInterfaceAdapter.hh"
+#include "corecel/io/OutputManager.hh"
+#include "corecel/sys/Environment.hh"
+#include "corecel/sys/EnvironmentIO.json.hh"
+#include "corecel/sys/ScopedMpiInit.hh"
+#include "corecel/sys/Stopwatch.hh"
+#include "celeritas/geo/GeoParams.hh"
+
+#include "GBenchIO.hh"
+#include "GBenchRunner.hh"
+
+using std::cout;
+using std::endl;
+using namespace geo_bench;
+using namespace celeritas;
+
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Run, launch, and output.
+ */
+void run(std::istream* is, OutputManager* output)
+{
+    // Read input options
+    auto inp = nlohmann::json::parse(*is).get<GBenchInput>();
+    CELER_VALIDATE(inp,
+                   << "invalid benchmark input: geometry_filename, "
+                      "num_tracks, and max_steps are required");
+    if (inp.num_threads.empty())
+    {
+#if CELERITAS_USE_OPENMP
+        inp.num_threads.push_back(omp_get_max_threads());
+#else
+        inp.num_threads.push_back(1);
+#endif
+    }
+    output->insert(OutputInterfaceAdapter<GBenchInput>::from_rvalue_ref(
+        OutputInterface::Category::input, "*", GBenchInput(inp)));
+
+    // Load geometry
+    Stopwatch get_setup_time;
+    auto      geo = std::make_shared<GeoParams>(inp.geometry_filename);
+    GBenchRunner run_bench(geo, inp);
+    CELER_LOG(info) << "Loaded geometry and sampled " << inp.num_tracks
+                    << " rays in " << get_setup_time() << " s";
+
+    GBenchResult result;
+    for (int num_threads : inp.num_threads)
+    {
+        CELER_LOG(status) << "Tracking with " << num_threads << " thread"
+                          << (num_threads > 1 ? "s" : "");
+        result.runs.push_back(run_bench(num_threads));
+    }
+
+    output->insert(OutputInterfaceAdapter<GBenchResult>::from_rvalue_ref(
+        OutputInterface::Category::result, "*", std::move(result)));
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute and run.
+ */
+int main(int argc, char* argv[])
+{
+    ScopedMpiInit scoped_mpi(&argc, &argv);
+
+    // Process input arguments
+    std::vector<std::string> args(argv, argv + argc);
+    if (args.size() != 2 || args[1] == "--help" || args[1] == "-h")
+    {
+        std::cerr << "usage: " << args[0] << " {input}.json" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::string   filename = args[1];
+    std::ifstream infile;
+    std::istream* instream = nullptr;
+    if (filename == "-")
+    {
+        instream = &std::cin;
+        filename = "<stdin>"; // For nicer output on failure
+    }
+    else
+    {
+        // Open the specified file
+        infile.open(filename);
+        if (!infile)
+        {
+            CELER_LOG(critical) << "Failed to open '" << filename << "'";
+            return EXIT_FAILURE;
+        }
+        instream = &infile;
+    }
+
+    // Set up output
+    OutputManager output;
+    output.insert(OutputInterfaceAdapter<Environment>::from_const_ref(
+        OutputInterface::Category::system, "environ", celeritas::environment()));
+    output.insert(std::make_shared<BuildOutput>());
+
+    int return_code = EXIT_SUCCESS;
+    try
+    {
+        run(instream, &output);
+    }
+    catch (const std::exception& e)
+    {
+        CELER_LOG(critical)
+            << "While running input at " << filename << ": " << e.what();
+        return_code = EXIT_FAILURE;
+        output.insert(
+            std::make_shared<ExceptionOutput>(std::current_exception()));
+    }
+
+    // Write system properties and (if available) results
+    CELER_LOG(status) << "Saving output";
+    output.output(&cout);
+    cout << endl;
+
+    return return_code;
+}
@@ -35,7 +35,7 @@ namespace celeritas
 namespace generated
 {{
 //---------------------------------------------------------------------------//
-class {clsname} final : public ExplicitActionInterface, public ConcreteAction
+class {clsname} final : public FusibleActionInterface, public ConcreteAction
 {{
 public:
   // Construct with ID and label
@@ -70,6 +70,7 @@ CC_TEMPLATE = CLIKE_TOP + """\
 #include "corecel/Types.hh"
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
+#include "celeritas/global/HostLauncher.hh"
 #include "celeritas/global/TrackLauncher.hh"
 #include "../detail/{clsname}Impl.hh" // IWYU pragma: associated
 
@@ -83,11 +84,9 @@ void {clsname}::execute(CoreHostRef const& data) const
 
     MultiExceptionHandler capture_exception;
     auto launch = make_track_launcher(data, detail::{func}_track);
-    #pragma omp parallel for
-    for (size_type i = 0; i < data.states.size(); ++i)
-    {{
-        CELER_TRY_ELSE(launch(ThreadId{{i}}), capture_exception);
-    }}
+    launch_host_tracks(data, [&](ThreadId tid) {{
+        CELER_TRY_ELSE(launch(tid), capture_exception);
+    }});
     log_and_rethrow(std::move(capture_exception));
 }}
 
@@ -68,6 +68,7 @@ CC_TEMPLATE = CLIKE_TOP + """\
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/{dir}/launcher/{class}Launcher.hh" // IWYU pragma: associated
+#include "celeritas/global/HostLauncher.hh"
 #include "celeritas/phys/InteractionLauncher.hh"
 
 using celeritas::MemSpace;
@@ -88,11 +89,10 @@ void {func}_interact(
         core_data,
         model_data,
         {namespace}::{func}_interact_track);
-    #pragma omp parallel for
-    for (celeritas::size_type i = 0; i < core_data.states.size(); ++i)
-    {{
-        CELER_TRY_ELSE(launch(celeritas::ThreadId{{i}}), capture_exception);
-    }}
+    celeritas::launch_host_action(
+        core_data, model_data.ids.action, [&](celeritas::ThreadId slot) {{
+            CELER_TRY_ELSE(launch(slot), capture_exception);
+        }});
     log_and_rethrow(std::move(capture_exception));
 }}
 
@@ -121,17 +121,18 @@ namespace
 {{
 __global__ void{launch_bounds}{func}_interact_kernel(
     const {namespace}::{class}DeviceRef model_data,
-    const celeritas::CoreRef<MemSpace::device> core_data)
+    const celeritas::CoreRef<MemSpace::device> core_data,
+    const celeritas::Range<celeritas::ThreadId> threads)
 {{
     auto tid = celeritas::KernelParamCalculator::thread_id();
-    if (!(tid < core_data.states.size()))
+    if (!(tid.get() < threads.size()))
         return;
 
     auto launch = celeritas::make_interaction_launcher(
         core_data,
         model_data,
         {namespace}::{func}_interact_track);
-    launch(tid);
+    launch(core_data.states.sort.track_slots[threads[tid.get()]]);
 }}
 }} // namespace
 
@@ -142,10 +143,15 @@ void {func}_interact(
     CELER_EXPECT(core_data);
     CELER_EXPECT(model_data);
 
+    auto const threads = core_data.states.sort.action_threads(
+        model_data.ids.action);
+    if (threads.empty())
+        return;
+
     CELER_LAUNCH_KERNEL({func}_interact,
                         celeritas::device().default_block_size(),
-                        core_data.states.size(),
-                        model_data, core_data);
+                        threads.size(),
+                        model_data, core_data, threads);
 }}
 
 }} // namespace generated
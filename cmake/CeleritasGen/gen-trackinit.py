@@ -57,6 +57,7 @@ CC_TEMPLATE = CLIKE_TOP + """\
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "corecel/Types.hh"
+#include "celeritas/global/HostLauncher.hh"
 
 namespace celeritas
 {{
@@ -66,11 +67,9 @@ namespace generated
 {{
     MultiExceptionHandler capture_exception;
     detail::{clsname}Launcher<MemSpace::host> launch({kernel_arglist});
-    #pragma omp parallel for
-    for (ThreadId::size_type i = 0; i < {num_threads}; ++i)
-    {{
-        CELER_TRY_ELSE(launch(ThreadId{{i}}), capture_exception);
-    }}
+    launch_host(core_data, {num_threads}, [&](ThreadId tid) {{
+        CELER_TRY_ELSE(launch(tid), capture_exception);
+    }});
     log_and_rethrow(std::move(capture_exception));
 }}
 
@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #include "LocalTransporter.hh"
 
+#include <algorithm>
+
 #include <CLHEP/Units/SystemOfUnits.h>
 
 #include "celeritas/phys/PDGNumber.hh"
@@ -38,12 +40,22 @@ inline Real3 convert_from_geant(const G4ThreeVector& vec, double units)
 //---------------------------------------------------------------------------//
 /*!
  * Construct with shared (MT) params.
+ *
+ * If the stage batch size is unset, it defaults to an eighth of the number of
+ * track slots. It's derived here rather than when the options are declared so
+ * that it reflects the final (user-configured) number of tracks.
  */
 LocalTransporter::LocalTransporter(const SetupOptions& options,
                                    const SharedParams& params)
-    : auto_flush_(options.max_num_tracks), max_steps_(options.max_steps)
+    : auto_flush_(options.max_num_tracks)
+    , stage_size_(options.stage_batch_size)
+    , max_steps_(options.max_steps)
 {
     CELER_EXPECT(params);
+    if (stage_size_ == 0)
+    {
+        stage_size_ = std::max<size_type>(options.max_num_tracks / 8, 1);
+    }
     particles_ = params.Params()->particle();
 
     StepperInput inp{params.Params(), options.max_num_tracks, options.sync};
@@ -106,7 +118,12 @@ void LocalTransporter::Push(const G4Track& g4track)
     track.event_id = event_id_;
 
     buffer_.push_back(track);
-    if (buffer_.size() >= auto_flush_)
+    if (stage_size_ > 0 && buffer_.size() >= stage_size_)
+    {
+        // Upload while Geant4 continues to produce tracks
+        this->StageBuffer();
+    }
+    if (this->GetBufferSize() >= auto_flush_)
     {
         // TODO: maybe only run one iteration? But then make sure that Flush
         // still transports active tracks to completion.
@@ -120,18 +137,22 @@ void LocalTransporter::Push(const G4Track& g4track)
  */
 void LocalTransporter::Flush()
 {
-    if (buffer_.empty())
+    if (this->GetBufferSize() == 0)
     {
         return;
     }
 
-    CELER_LOG_LOCAL(info) << "Transporting " << buffer_.size()
+    CELER_LOG_LOCAL(info) << "Transporting " << this->GetBufferSize()
                           << " tracks from event " << event_id_.unchecked_get()
                           << " with Celeritas";
 
-    // Copy buffered tracks to device and transport the first step
-    auto track_counts = (*step_)(make_span(buffer_));
-    buffer_.clear();
+    // Upload the remaining tracks and transport the first step
+    if (!buffer_.empty())
+    {
+        this->StageBuffer();
+    }
+    auto track_counts = (*step_)();
+    num_staged_       = 0;
 
     size_type step_iters = 1;
 
@@ -156,7 +177,7 @@ void LocalTransporter::Flush()
  */
 void LocalTransporter::Finalize()
 {
-    CELER_VALIDATE(buffer_.empty(),
+    CELER_VALIDATE(this->GetBufferSize() == 0,
                    << "some offloaded tracks were not flushed");
 
     // Reset all data
@@ -166,5 +187,21 @@ void LocalTransporter::Finalize()
     CELER_ENSURE(!*this);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Start uploading buffered tracks.
+ *
+ * The stepper copies the primaries into its own staging buffer, so the local
+ * buffer can be reused immediately.
+ */
+void LocalTransporter::StageBuffer()
+{
+    CELER_EXPECT(!buffer_.empty());
+
+    step_->stage_primaries(make_span(buffer_));
+    num_staged_ += buffer_.size();
+    buffer_.clear();
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -28,6 +28,11 @@ class SharedParams;
  * - an event action (to set the event ID and flush offloaded tracks at the end
  *   of the event)
  * - a tracking action (to try offloading every track)
+ *
+ * Offloaded tracks are uploaded in batches of \c stage_batch_size as they are
+ * pushed, so that the copies overlap with the Geant4 transport that produces
+ * the next tracks. They are transported when the buffer holds
+ * \c max_num_tracks tracks or when the event is flushed.
  */
 class LocalTransporter
 {
@@ -57,8 +62,8 @@ class LocalTransporter
     // Clear local data and return to an invalid state
     void Finalize();
 
-    // Number of buffered tracks
-    size_type GetBufferSize() const { return buffer_.size(); }
+    //! Number of buffered tracks, including those already uploaded
+    size_type GetBufferSize() const { return buffer_.size() + num_staged_; }
 
     //! Whether the class instance is initialized
     explicit operator bool() const { return static_cast<bool>(step_); }
@@ -72,7 +77,12 @@ class LocalTransporter
     TrackId::size_type track_counter_{};
 
     size_type auto_flush_{};
+    size_type stage_size_{};
+    size_type num_staged_{};
     size_type max_steps_{};
+
+    // Start uploading buffered tracks
+    void StageBuffer();
 };
 
 //---------------------------------------------------------------------------//
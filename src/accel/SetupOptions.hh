@@ -88,6 +88,8 @@ struct SetupOptions
     size_type max_num_events{};
     //! Limit on number of step iterations before aborting
     size_type max_steps = no_max_steps();
+    //! Upload offloaded tracks in batches of this size (0 for default)
+    size_type stage_batch_size{};
     //! Maximum number of track initializers (primaries+secondaries)
     size_type initializer_capacity{};
     //! At least the average number of secondaries per track slot
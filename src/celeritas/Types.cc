@@ -22,6 +22,7 @@ const char* to_cstring(ActionOrder value)
         "pre",
         "along",
         "pre_post",
+        "sort_post",
         "post",
         "post_post",
         "end",
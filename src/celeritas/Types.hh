@@ -103,6 +103,7 @@ enum class ActionOrder
     pre,       //!< Pre-step physics and setup
     along,     //!< Along-step
     pre_post,  //!< Discrete selection kernel
+    sort_post, //!< Partition track slots by post-step action
     post,      //!< After step
     post_post, //!< User actions after boundary crossing, collision
     end,       //!< Processing secondaries, including replacing primaries
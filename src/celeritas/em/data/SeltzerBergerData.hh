@@ -29,6 +29,11 @@ namespace celeritas
  * \c argmax is the y index of the largest cross section at a given incident
  * energy point.
  *
+ * \c cdf is optional: if present, it stores the cumulative integral of the
+ * photon spectrum \f$ \chi / \kappa \f$ over the reduced energy grid,
+ * indexed like the cross section values, for sampling without rejection on
+ * the tabulated cross section (see \c SBInverseCdfDistribution).
+ *
  * \todo We could use way smaller integers for argmax, even i/j here, because
  * these tables are so small.
  */
@@ -39,10 +44,12 @@ struct SBElementTableData
 
     TwodGridData         grid;   //!< Cross section grid and data
     ItemRange<size_type> argmax; //!< Y index of the largest XS for each energy
+    ItemRange<real_type> cdf;    //!< Integrated spectrum [x][y] (optional)
 
     explicit CELER_FUNCTION operator bool() const
     {
-        return grid && argmax.size() == grid.x.size();
+        return grid && argmax.size() == grid.x.size()
+               && (cdf.empty() || cdf.size() == grid.values.size());
     }
 };
 
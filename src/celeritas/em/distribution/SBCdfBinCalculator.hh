@@ -0,0 +1,157 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/em/distribution/SBCdfBinCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/math/Algorithms.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Integrate and invert the SB photon spectrum inside one reduced energy bin.
+ *
+ * Between two adjacent reduced photon energy grid points \f$ \kappa_0 \f$ and
+ * \f$ \kappa_1 \f$ the scaled cross section \f$ \chi \f$ is linearly
+ * interpolated, so it can be written as \f$ \chi(\kappa) = a + b \kappa \f$.
+ * The (unnormalized) photon energy spectrum \f$ \chi / \kappa \f$ then has the
+ * exact integral
+ * \f[
+   F(\kappa) = \int_{\kappa_0}^{\kappa} \frac{\chi(\kappa')}{\kappa'}
+   \dif\kappa' = a \ln \frac{\kappa}{\kappa_0} + b (\kappa - \kappa_0) \, .
+ * \f]
+ *
+ * If a density correction \f$ \delta \f$ (in units of the reduced energy
+ * squared) is given, the spectrum is multiplied by \f$ \kappa^2 / (\kappa^2 +
+ * \delta) \f$, which is also integrable:
+ * \f[
+   F(\kappa) = \frac{a}{2} \ln \frac{\kappa^2 + \delta}{\kappa_0^2 + \delta}
+   + b \left[ \kappa - \kappa_0 - \sqrt{\delta} \left(
+     \arctan \frac{\kappa}{\sqrt{\delta}}
+   - \arctan \frac{\kappa_0}{\sqrt{\delta}} \right) \right] \, .
+ * \f]
+ *
+ * Neither has a closed-form inverse, so \c invert starts from the solution for
+ * a flat cross section (\f$ b = 0 \f$) and refines it with a fixed number of
+ * Newton iterations. Since \f$ F' > 0 \f$ and the initial guess is exact for a
+ * flat cross section, a few iterations converge to near machine precision for
+ * the smooth SB tables.
+ */
+class SBCdfBinCalculator
+{
+  public:
+    // Construct from the bin edges and cross sections at the edges
+    inline CELER_FUNCTION SBCdfBinCalculator(real_type lower_kappa,
+                                             real_type upper_kappa,
+                                             real_type lower_xs,
+                                             real_type upper_xs,
+                                             real_type density = 0);
+
+    // Integrate the spectrum from the lower edge to the given energy
+    inline CELER_FUNCTION real_type operator()(real_type kappa) const;
+
+    // Find the reduced energy at which the integral reaches the given value
+    inline CELER_FUNCTION real_type invert(real_type integral) const;
+
+    //! Number of Newton iterations used for inversion
+    static CELER_CONSTEXPR_FUNCTION int num_iterations() { return 4; }
+
+  private:
+    real_type lower_;
+    real_type upper_;
+    real_type a_;
+    real_type b_;
+    real_type dens_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from the bin edges and cross sections at the edges.
+ */
+CELER_FUNCTION
+SBCdfBinCalculator::SBCdfBinCalculator(real_type lower_kappa,
+                                       real_type upper_kappa,
+                                       real_type lower_xs,
+                                       real_type upper_xs,
+                                       real_type density)
+    : lower_(lower_kappa), upper_(upper_kappa), dens_(density)
+{
+    CELER_EXPECT(lower_kappa > 0 && lower_kappa < upper_kappa);
+    CELER_EXPECT(lower_xs >= 0 && upper_xs >= 0);
+    CELER_EXPECT(density >= 0);
+
+    real_type inv_width = 1 / (upper_kappa - lower_kappa);
+    a_ = (lower_xs * upper_kappa - upper_xs * lower_kappa) * inv_width;
+    b_ = (upper_xs - lower_xs) * inv_width;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Integrate the spectrum from the lower edge to the given energy.
+ */
+CELER_FUNCTION real_type SBCdfBinCalculator::operator()(real_type kappa) const
+{
+    CELER_EXPECT(kappa >= lower_ && kappa <= upper_);
+    if (dens_ == 0)
+    {
+        return a_ * std::log(kappa / lower_) + b_ * (kappa - lower_);
+    }
+
+    const real_type sqrt_dens = std::sqrt(dens_);
+    return real_type(0.5) * a_
+               * std::log((ipow<2>(kappa) + dens_)
+                          / (ipow<2>(lower_) + dens_))
+           + b_
+                 * (kappa - lower_
+                    - sqrt_dens
+                          * (std::atan(kappa / sqrt_dens)
+                             - std::atan(lower_ / sqrt_dens)));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the reduced energy at which the integral reaches the given value.
+ */
+CELER_FUNCTION real_type SBCdfBinCalculator::invert(real_type integral) const
+{
+    const real_type total = (*this)(upper_);
+    CELER_EXPECT(total > 0 && integral >= 0);
+
+    // Initial guess is exact when the cross section is constant in the bin:
+    // the spectrum is then reciprocal in the density-corrected energy
+    // squared. Clamping accounts for roundoff in the tabulated CDF.
+    const real_type lower_sq = ipow<2>(lower_) + dens_;
+    const real_type upper_sq = ipow<2>(upper_) + dens_;
+    const real_type guess_sq
+        = lower_sq * std::exp(integral / total * std::log(upper_sq / lower_sq))
+          - dens_;
+    real_type kappa = clamp(std::sqrt(celeritas::max<real_type>(guess_sq, 0)),
+                            lower_,
+                            upper_);
+    for (int i = 0; i < num_iterations(); ++i)
+    {
+        real_type deriv = (a_ + b_ * kappa) * kappa
+                          / (ipow<2>(kappa) + dens_);
+        if (!(deriv > 0))
+        {
+            break;
+        }
+        kappa -= ((*this)(kappa) - integral) / deriv;
+        kappa = clamp(kappa, lower_, upper_);
+    }
+    return kappa;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
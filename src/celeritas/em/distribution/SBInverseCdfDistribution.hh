@@ -0,0 +1,353 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/em/distribution/SBInverseCdfDistribution.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+
+#include "corecel/cont/Array.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/math/Algorithms.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/em/data/SeltzerBergerData.hh"
+#include "celeritas/grid/NonuniformGrid.hh"
+#include "celeritas/grid/TwodGridCalculator.hh"
+#include "celeritas/grid/TwodSubgridCalculator.hh"
+#include "celeritas/random/distribution/BernoulliDistribution.hh"
+#include "celeritas/random/distribution/GenerateCanonical.hh"
+
+#include "SBCdfBinCalculator.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sample exiting photon energy from Bremsstrahlung using tabulated CDFs.
+ *
+ * This samples the same distribution as \c SBEnergyDistribution but replaces
+ * the rejection against the tabulated cross section with a direct inversion
+ * of the precomputed cumulative distribution of \f$ \chi_Z(E_i, \kappa) /
+ * \kappa \f$ at each incident energy grid point \f$ E_i \f$ (see \c
+ * SBCdfBinCalculator). Each sample:
+ *
+ * 1. Selects one of the two incident energy grid points bracketing \em E.
+ *    Because the cross section is bilinearly interpolated, the spectrum at
+ *    \em E is a mixture of the spectra at the two grid points, and the
+ *    mixture weights are the interpolation fractions multiplied by the
+ *    spectrum integrals over \f$ [\kappa_c, 1) \f$.
+ * 2. Rescales the same random number to a value of the density-corrected
+ *    CDF, finds the reduced energy bin, and inverts the CDF in the bin.
+ * 3. Accepts the sample with the cross section correction (unity for
+ *    electrons).
+ *
+ * The density correction \f$ k^2 / (k^2 + d_\rho E^2) \f$ depends on the
+ * material and incident energy, so it can't be included in the per-element
+ * tables. It suppresses the spectrum only near the bottom of the reduced
+ * energy range, though, where \f$ \kappa^2 \f$ is comparable to \f$ \delta =
+ * d_\rho E^2 / T^2 \f$. The spectrum in those bins (typically only the one
+ * containing the cutoff at high energy) is integrated and inverted exactly at
+ * construction time. Above them, the tabulated CDF is used and the sample is
+ * accepted with the density correction, which is larger than \c
+ * 1 - density_tolerance() . Electrons are therefore sampled with a single
+ * random number in almost every case, independent of the element and
+ * incident energy.
+ */
+template<class XSCorrector>
+class SBInverseCdfDistribution
+{
+  public:
+    //!@{
+    //! Type aliases
+    using SBDXsec  = NativeCRef<SeltzerBergerTableData>;
+    using Energy   = units::MevEnergy;
+    using EnergySq = Quantity<UnitProduct<units::Mev, units::Mev>>;
+    //!@}
+
+  public:
+    // Construct from data
+    inline CELER_FUNCTION
+    SBInverseCdfDistribution(const SBDXsec& differential_xs,
+                             Energy         inc_energy,
+                             ElementId      element,
+                             EnergySq       density_correction,
+                             Energy         min_gamma_energy,
+                             XSCorrector    scale_xs);
+
+    template<class Engine>
+    inline CELER_FUNCTION Energy operator()(Engine& rng);
+
+    //! Maximum rejection fraction from the density correction
+    static CELER_CONSTEXPR_FUNCTION real_type density_tolerance()
+    {
+        return 0.01;
+    }
+
+  private:
+    //// IMPLEMENTATION DATA ////
+
+    const SBDXsec&            xs_;
+    const SBElementTableData& table_;
+    const real_type           inc_energy_;
+    real_type                 min_kappa_;
+    real_type                 dens_;
+    size_type                 x_index_;
+    size_type                 min_bin_;
+    size_type                 tabulated_bin_;
+    real_type                 upper_prob_;
+    Array<real_type, 2>       corrected_total_;
+    Array<real_type, 2>       cdf_min_;
+    XSCorrector               scale_xs_;
+
+    //// HELPER FUNCTIONS ////
+
+    inline CELER_FUNCTION Span<const real_type> cdf(size_type ix) const;
+    inline CELER_FUNCTION SBCdfBinCalculator
+    make_bin_calc(size_type ix, size_type iy, real_type density = 0) const;
+    inline CELER_FUNCTION real_type calc_cdf(size_type ix,
+                                             real_type kappa) const;
+    inline CELER_FUNCTION real_type calc_corrected_total(size_type ix) const;
+    inline CELER_FUNCTION real_type sample_kappa(size_type ix,
+                                                 real_type cdf_value) const;
+    inline CELER_FUNCTION real_type
+    sample_corrected_kappa(size_type ix, real_type integral) const;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from incident particle and energy.
+ *
+ * The incident energy *must* be within the bounds of the SB table data, and
+ * the element's CDF tables must have been built.
+ */
+template<class X>
+CELER_FUNCTION SBInverseCdfDistribution<X>::SBInverseCdfDistribution(
+    const SBDXsec& differential_xs,
+    Energy         inc_energy,
+    ElementId      element,
+    EnergySq       density_correction,
+    Energy         min_gamma_energy,
+    X              scale_xs)
+    : xs_(differential_xs)
+    , table_(differential_xs.elements[element])
+    , inc_energy_(inc_energy.value())
+    , scale_xs_(::celeritas::move(scale_xs))
+{
+    CELER_EXPECT(inc_energy > min_gamma_energy);
+    CELER_EXPECT(!table_.cdf.empty());
+
+    // Locate the incident energy on the table's log energy grid
+    static_assert(
+        std::is_same<Energy::unit_type, units::Mev>::value
+            && std::is_same<SBElementTableData::EnergyUnits, units::LogMev>::value,
+        "Inconsistent energy units");
+    const TwodSubgridCalculator calc_xs
+        = TwodGridCalculator(table_.grid, xs_.reals)(std::log(inc_energy_));
+    x_index_ = calc_xs.x_index();
+
+    // Find the reduced energy bins where the density correction is
+    // significant: these start with the bin containing the cutoff
+    min_kappa_ = min_gamma_energy.value() / inc_energy_;
+    dens_      = density_correction.value() / ipow<2>(inc_energy_);
+    const NonuniformGrid<real_type> y_grid{table_.grid.y, xs_.reals};
+    min_bin_       = y_grid.find(min_kappa_);
+    tabulated_bin_ = min_bin_;
+    while (tabulated_bin_ + 1 < y_grid.size()
+           && dens_
+                  > density_tolerance()
+                        * (ipow<2>(celeritas::max(y_grid[tabulated_bin_],
+                                                  min_kappa_))
+                           + dens_))
+    {
+        ++tabulated_bin_;
+    }
+
+    // Integrate the spectrum above the cutoff at both bracketing grid points
+    Array<real_type, 2> weight{1 - calc_xs.x_fraction(), calc_xs.x_fraction()};
+    for (int i = 0; i < 2; ++i)
+    {
+        const size_type ix  = x_index_ + i;
+        corrected_total_[i] = this->calc_corrected_total(ix);
+        cdf_min_[i] = tabulated_bin_ == min_bin_
+                          ? this->calc_cdf(ix, min_kappa_)
+                          : this->cdf(ix)[tabulated_bin_];
+        weight[i] *= corrected_total_[i] + this->cdf(ix).back() - cdf_min_[i];
+    }
+    CELER_ASSERT(weight[0] + weight[1] > 0);
+    upper_prob_ = weight[1] / (weight[0] + weight[1]);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the exiting energy by inverting the tabulated CDF.
+ */
+template<class X>
+template<class Engine>
+CELER_FUNCTION auto SBInverseCdfDistribution<X>::operator()(Engine& rng)
+    -> Energy
+{
+    real_type exit_energy;
+    real_type accept_prob;
+    do
+    {
+        // Select the incident energy grid point, then rescale the same
+        // random number to sample the spectrum above the cutoff
+        real_type xi = generate_canonical(rng);
+        int       i  = 0;
+        if (xi < upper_prob_)
+        {
+            i = 1;
+            xi /= upper_prob_;
+        }
+        else
+        {
+            xi = (xi - upper_prob_) / (1 - upper_prob_);
+        }
+        const size_type ix        = x_index_ + i;
+        const real_type corrected = corrected_total_[i];
+        const real_type cdf_max   = this->cdf(ix).back();
+        const real_type integral
+            = xi * (corrected + cdf_max - cdf_min_[i]);
+
+        real_type kappa;
+        if (integral < corrected)
+        {
+            // Sample exactly from the density-corrected spectrum
+            kappa       = this->sample_corrected_kappa(ix, integral);
+            accept_prob = 1;
+        }
+        else
+        {
+            // Sample from the tabulated spectrum and reject with the (small)
+            // density correction
+            kappa = this->sample_kappa(
+                ix,
+                celeritas::min(cdf_min_[i] + (integral - corrected), cdf_max));
+            real_type ksq = ipow<2>(kappa);
+            accept_prob   = ksq / (ksq + dens_);
+        }
+        exit_energy = kappa * inc_energy_;
+
+        // Correct for the cross section scaling
+        accept_prob *= scale_xs_(Energy{exit_energy});
+    } while (accept_prob < 1 && !BernoulliDistribution(accept_prob)(rng));
+    return Energy{exit_energy};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the tabulated CDF for an incident energy grid point.
+ */
+template<class X>
+CELER_FUNCTION auto SBInverseCdfDistribution<X>::cdf(size_type ix) const
+    -> Span<const real_type>
+{
+    const size_type num_y = table_.grid.y.size();
+    return xs_.reals[table_.cdf].subspan(ix * num_y, num_y);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the integrator for a single reduced energy bin.
+ */
+template<class X>
+CELER_FUNCTION SBCdfBinCalculator SBInverseCdfDistribution<X>::make_bin_calc(
+    size_type ix, size_type iy, real_type density) const
+{
+    const NonuniformGrid<real_type> y_grid{table_.grid.y, xs_.reals};
+    return SBCdfBinCalculator(y_grid[iy],
+                              y_grid[iy + 1],
+                              xs_.reals[table_.grid.at(ix, iy)],
+                              xs_.reals[table_.grid.at(ix, iy + 1)],
+                              density);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the CDF at the given reduced photon energy.
+ */
+template<class X>
+CELER_FUNCTION real_type
+SBInverseCdfDistribution<X>::calc_cdf(size_type ix, real_type kappa) const
+{
+    const NonuniformGrid<real_type> y_grid{table_.grid.y, xs_.reals};
+    CELER_EXPECT(kappa >= y_grid.front() && kappa < y_grid.back());
+
+    size_type iy = y_grid.find(kappa);
+    return this->cdf(ix)[iy] + this->make_bin_calc(ix, iy)(kappa);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Integrate the density-corrected spectrum below the tabulated bins.
+ */
+template<class X>
+CELER_FUNCTION real_type
+SBInverseCdfDistribution<X>::calc_corrected_total(size_type ix) const
+{
+    const NonuniformGrid<real_type> y_grid{table_.grid.y, xs_.reals};
+    real_type                       result = 0;
+    for (size_type iy = min_bin_; iy < tabulated_bin_; ++iy)
+    {
+        SBCdfBinCalculator integrate = this->make_bin_calc(ix, iy, dens_);
+        result += integrate(y_grid[iy + 1]);
+        if (iy == min_bin_)
+        {
+            result -= integrate(min_kappa_);
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the reduced photon energy for a density-corrected spectrum integral.
+ *
+ * The integral is measured from the cutoff energy.
+ */
+template<class X>
+CELER_FUNCTION real_type SBInverseCdfDistribution<X>::sample_corrected_kappa(
+    size_type ix, real_type integral) const
+{
+    CELER_EXPECT(tabulated_bin_ > min_bin_);
+    const NonuniformGrid<real_type> y_grid{table_.grid.y, xs_.reals};
+    for (size_type iy = min_bin_;; ++iy)
+    {
+        SBCdfBinCalculator integrate = this->make_bin_calc(ix, iy, dens_);
+        real_type lower = (iy == min_bin_ ? integrate(min_kappa_) : 0);
+        real_type bin_integral = integrate(y_grid[iy + 1]) - lower;
+        if (integral < bin_integral || iy + 1 == tabulated_bin_)
+        {
+            return integrate.invert(
+                lower + celeritas::min(integral, bin_integral));
+        }
+        integral -= bin_integral;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the reduced photon energy for a CDF value.
+ */
+template<class X>
+CELER_FUNCTION real_type SBInverseCdfDistribution<X>::sample_kappa(
+    size_type ix, real_type cdf_value) const
+{
+    Span<const real_type> row = this->cdf(ix);
+    CELER_EXPECT(cdf_value >= row.front() && cdf_value <= row.back());
+
+    // Find the bin with cdf[iy] <= value < cdf[iy + 1], skipping empty bins
+    // (the upper edge is only reachable through roundoff)
+    size_type iy = celeritas::upper_bound(row.begin(), row.end(), cdf_value)
+                   - row.begin() - 1;
+    iy = celeritas::min<size_type>(iy, row.size() - 2);
+    return this->make_bin_calc(ix, iy).invert(cdf_value - row[iy]);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -35,17 +35,18 @@ __launch_bounds__(1024, 8)
 #endif // CELERITAS_LAUNCH_BOUNDS
 bethe_heitler_interact_kernel(
     const celeritas::BetheHeitlerDeviceRef model_data,
-    const celeritas::CoreRef<MemSpace::device> core_data)
+    const celeritas::CoreRef<MemSpace::device> core_data,
+    const celeritas::Range<celeritas::ThreadId> threads)
 {
     auto tid = celeritas::KernelParamCalculator::thread_id();
-    if (!(tid < core_data.states.size()))
+    if (!(tid.get() < threads.size()))
         return;
 
     auto launch = celeritas::make_interaction_launcher(
         core_data,
         model_data,
         celeritas::bethe_heitler_interact_track);
-    launch(tid);
+    launch(core_data.states.sort.track_slots[threads[tid.get()]]);
 }
 } // namespace
 
@@ -56,10 +57,15 @@ void bethe_heitler_interact(
     CELER_EXPECT(core_data);
     CELER_EXPECT(model_data);
 
+    auto const threads = core_data.states.sort.action_threads(
+        model_data.ids.action);
+    if (threads.empty())
+        return;
+
     CELER_LAUNCH_KERNEL(bethe_heitler_interact,
                         celeritas::device().default_block_size(),
-                        core_data.states.size(),
-                        model_data, core_data);
+                        threads.size(),
+                        model_data, core_data, threads);
 }
 
 } // namespace generated
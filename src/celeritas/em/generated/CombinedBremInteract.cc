@@ -13,6 +13,7 @@
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/em/launcher/CombinedBremLauncher.hh" // IWYU pragma: associated
+#include "celeritas/global/HostLauncher.hh"
 #include "celeritas/phys/InteractionLauncher.hh"
 
 using celeritas::MemSpace;
@@ -33,11 +34,10 @@ void combined_brem_interact(
         core_data,
         model_data,
         celeritas::combined_brem_interact_track);
-    #pragma omp parallel for
-    for (celeritas::size_type i = 0; i < core_data.states.size(); ++i)
-    {
-        CELER_TRY_ELSE(launch(celeritas::ThreadId{i}), capture_exception);
-    }
+    celeritas::launch_host_action(
+        core_data, model_data.ids.action, [&](celeritas::ThreadId slot) {
+            CELER_TRY_ELSE(launch(slot), capture_exception);
+        });
     log_and_rethrow(std::move(capture_exception));
 }
 
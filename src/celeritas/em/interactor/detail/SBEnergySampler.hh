@@ -15,6 +15,7 @@
 #include "celeritas/em/data/SeltzerBergerData.hh"
 #include "celeritas/em/distribution/SBEnergyDistHelper.hh"
 #include "celeritas/em/distribution/SBEnergyDistribution.hh"
+#include "celeritas/em/distribution/SBInverseCdfDistribution.hh"
 #include "celeritas/mat/ElementView.hh"
 #include "celeritas/mat/MaterialView.hh"
 #include "celeritas/phys/CutoffView.hh"
@@ -72,6 +73,12 @@ class SBEnergySampler
     const bool inc_particle_is_electron_;
     // Density correction
     real_type density_correction_;
+
+    //// HELPER FUNCTIONS ////
+
+    template<class Engine>
+    inline CELER_FUNCTION Energy sample_inverse_cdf(ElementId el_id,
+                                                    Engine&   rng) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -105,10 +112,19 @@ SBEnergySampler::SBEnergySampler(const SBTable&            differential_xs,
 //---------------------------------------------------------------------------//
 /*!
  * Sample the exiting energy by doing a table lookup and rejection.
+ *
+ * If the model precomputed cumulative spectrum tables, the energy is instead
+ * sampled by inverting them.
  */
 template<class Engine>
 CELER_FUNCTION auto SBEnergySampler::operator()(Engine& rng) -> Energy
 {
+    const ElementId el_id = material_.element_id(elcomp_id_);
+    if (!differential_xs_.elements[el_id].cdf.empty())
+    {
+        return this->sample_inverse_cdf(el_id, rng);
+    }
+
     // Outgoing photon secondary energy sampler
     Energy gamma_exit_energy;
 
@@ -117,7 +133,7 @@ CELER_FUNCTION auto SBEnergySampler::operator()(Engine& rng) -> Energy
     SBEnergyDistHelper sb_helper(
         differential_xs_,
         inc_energy_,
-        material_.element_id(elcomp_id_),
+        el_id,
         SBEnergyDistHelper::EnergySq{density_correction_},
         gamma_cutoff_);
 
@@ -142,5 +158,43 @@ CELER_FUNCTION auto SBEnergySampler::operator()(Engine& rng) -> Energy
     return gamma_exit_energy;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the exiting energy by inverting the cumulative spectrum tables.
+ */
+template<class Engine>
+CELER_FUNCTION auto
+SBEnergySampler::sample_inverse_cdf(ElementId el_id, Engine& rng) const
+    -> Energy
+{
+    using EnergySq = SBEnergyDistHelper::EnergySq;
+
+    if (inc_particle_is_electron_)
+    {
+        SBInverseCdfDistribution<SBElectronXsCorrector> sample_gamma_energy(
+            differential_xs_,
+            inc_energy_,
+            el_id,
+            EnergySq{density_correction_},
+            gamma_cutoff_,
+            {});
+        return sample_gamma_energy(rng);
+    }
+    else
+    {
+        SBInverseCdfDistribution<SBPositronXsCorrector> sample_gamma_energy(
+            differential_xs_,
+            inc_energy_,
+            el_id,
+            EnergySq{density_correction_},
+            gamma_cutoff_,
+            {inc_mass_,
+             material_.make_element_view(elcomp_id_),
+             gamma_cutoff_,
+             inc_energy_});
+        return sample_gamma_energy(rng);
+    }
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -11,12 +11,14 @@
 #include <utility>
 
 #include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/math/Quantity.hh"
 #include "celeritas/em/data/CombinedBremData.hh"
 #include "celeritas/em/data/RelativisticBremData.hh"
 #include "celeritas/em/data/SeltzerBergerData.hh"
 #include "celeritas/em/generated/CombinedBremInteract.hh"
 #include "celeritas/em/interactor/detail/PhysicsConstants.hh"
+#include "celeritas/grid/ValueGridBuilder.hh"
 #include "celeritas/phys/Applicability.hh"
 
 #include "RelativisticBremModel.hh"
@@ -33,7 +35,8 @@ CombinedBremModel::CombinedBremModel(ActionId              id,
                                      const MaterialParams& materials,
                                      SPConstImported       data,
                                      ReadData              sb_table,
-                                     bool                  enable_lpm)
+                                     bool                  enable_lpm,
+                                     bool                  sb_cdf_tables)
 {
     CELER_EXPECT(id);
     CELER_EXPECT(sb_table);
@@ -41,7 +44,7 @@ CombinedBremModel::CombinedBremModel(ActionId              id,
     // Construct SeltzerBergerModel and RelativisticBremModel and save the
     // host data reference
     sb_model_ = std::make_shared<SeltzerBergerModel>(
-        id, particles, materials, data, sb_table);
+        id, particles, materials, data, sb_table, sb_cdf_tables);
 
     rb_model_ = std::make_shared<RelativisticBremModel>(
         id, particles, materials, data, enable_lpm);
@@ -77,10 +80,25 @@ auto CombinedBremModel::applicability() const -> SetApplicability
 /*!
  * Get the microscopic cross sections for the given particle and material.
  */
-auto CombinedBremModel::micro_xs(Applicability) const -> MicroXsBuilders
+auto CombinedBremModel::micro_xs(Applicability applic) const
+    -> MicroXsBuilders
 {
-    // Multiple elements per material not supported for combined brems model
-    return {};
+    // Join the SB (low energy) and relativistic (high energy) cross sections
+    MicroXsBuilders sb_builders = sb_model_->micro_xs(applic);
+    MicroXsBuilders rb_builders = rb_model_->micro_xs(applic);
+    CELER_ASSERT(sb_builders.size() == rb_builders.size());
+
+    MicroXsBuilders builders(sb_builders.size());
+    for (auto elcomp_idx : range(builders.size()))
+    {
+        const auto* sb = dynamic_cast<const ValueGridLogBuilder*>(
+            sb_builders[elcomp_idx].get());
+        const auto* rb = dynamic_cast<const ValueGridLogBuilder*>(
+            rb_builders[elcomp_idx].get());
+        CELER_ASSERT(sb && rb);
+        builders[elcomp_idx] = ValueGridLogBuilder::from_joined(*sb, *rb);
+    }
+    return builders;
 }
 
 //---------------------------------------------------------------------------//
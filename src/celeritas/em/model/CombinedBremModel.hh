@@ -47,7 +47,8 @@ class CombinedBremModel final : public Model
                       const MaterialParams& materials,
                       SPConstImported       data,
                       ReadData              load_sb_table,
-                      bool                  enable_lpm);
+                      bool                  enable_lpm,
+                      bool                  sb_cdf_tables = false);
 
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
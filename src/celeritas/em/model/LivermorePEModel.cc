@@ -91,6 +91,10 @@ auto LivermorePEModel::applicability() const -> SetApplicability
 //---------------------------------------------------------------------------//
 /*!
  * Get the microscopic cross sections for the given particle and material.
+ *
+ * The element is sampled in the interaction kernel from cross sections
+ * calculated on the fly. Tabulating them on a uniform log grid for the
+ * element selection CDFs would smear the absorption edges of each element.
  */
 auto LivermorePEModel::micro_xs(Applicability) const -> MicroXsBuilders
 {
@@ -14,6 +14,7 @@
 #include "corecel/data/CollectionBuilder.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/io/ScopedTimeLog.hh"
+#include "celeritas/em/distribution/SBCdfBinCalculator.hh"
 #include "celeritas/em/generated/SeltzerBergerInteract.hh"
 #include "celeritas/em/interactor/detail/PhysicsConstants.hh"
 #include "celeritas/em/interactor/detail/SBPositronXsCorrector.hh"
@@ -31,7 +32,8 @@ SeltzerBergerModel::SeltzerBergerModel(ActionId              id,
                                        const ParticleParams& particles,
                                        const MaterialParams& materials,
                                        SPConstImported       data,
-                                       ReadData              load_sb_table)
+                                       ReadData              load_sb_table,
+                                       bool                  use_cdf_tables)
     : imported_(data,
                 particles,
                 ImportProcessClass::e_brems,
@@ -68,6 +70,10 @@ SeltzerBergerModel::SeltzerBergerModel(ActionId              id,
                            load_sb_table(element.atomic_number()),
                            &host_data.differential_xs,
                            host_data.electron_mass);
+        if (use_cdf_tables)
+        {
+            this->append_cdf(&host_data.differential_xs);
+        }
     }
     CELER_ASSERT(host_data.differential_xs.elements.size()
                  == materials.num_elements());
@@ -219,5 +225,43 @@ void SeltzerBergerModel::append_table(const ElementView&   element,
     CELER_ENSURE(table.grid);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the cumulative photon spectrum for the last element.
+ *
+ * At each incident energy grid point this integrates the (unscaled) spectrum
+ * \f$ \chi / \kappa \f$ exactly over each reduced energy bin, assuming the
+ * linear interpolation of \f$ \chi \f$ used by the rejection sampler.
+ */
+void SeltzerBergerModel::append_cdf(HostXsTables* tables) const
+{
+    CELER_EXPECT(tables && !tables->elements.empty());
+
+    SBElementTableData& table = tables->elements[ElementId{
+        static_cast<size_type>(tables->elements.size() - 1)}];
+    const size_type num_x = table.grid.x.size();
+    const size_type num_y = table.grid.y.size();
+    CELER_ASSERT(table.cdf.empty());
+
+    const auto* y = &tables->reals[table.grid.y.front()];
+    std::vector<real_type> cdf(num_x * num_y);
+    for (size_type i : range(num_x))
+    {
+        const real_type* xs  = &tables->reals[table.grid.at(i, 0)];
+        real_type*       row = cdf.data() + i * num_y;
+        row[0]               = 0;
+        for (size_type j : range(num_y - 1))
+        {
+            SBCdfBinCalculator integrate(y[j], y[j + 1], xs[j], xs[j + 1]);
+            row[j + 1] = row[j] + integrate(y[j + 1]);
+        }
+        CELER_ASSERT(row[num_y - 1] > 0);
+    }
+    table.cdf
+        = make_builder(&tables->reals).insert_back(cdf.begin(), cdf.end());
+
+    CELER_ENSURE(table);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -44,6 +44,11 @@ class ParticleParams;
  * energy spectra from electrons with kinetic energy 1 keV–10 GeV incident on
  * screened nuclei and orbital electrons of neutral atoms with Z = 1–100", At.
  * Data Nucl. Data Tables 35, 345–418.
+ *
+ * If \c use_cdf_tables is enabled, the cumulative photon spectrum at each
+ * incident energy grid point is also precomputed so that the exiting photon
+ * energy can be sampled by inverting the tables rather than by rejection on
+ * the tabulated cross section.
  */
 class SeltzerBergerModel final : public Model
 {
@@ -62,7 +67,8 @@ class SeltzerBergerModel final : public Model
                        const ParticleParams& particles,
                        const MaterialParams& materials,
                        SPConstImported       data,
-                       ReadData              load_sb_table);
+                       ReadData              load_sb_table,
+                       bool                  use_cdf_tables = false);
 
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
@@ -105,6 +111,7 @@ class SeltzerBergerModel final : public Model
                       const ImportSBTable& table,
                       HostXsTables*        tables,
                       Mass                 electron_mass) const;
+    void append_cdf(HostXsTables* tables) const;
 };
 
 //---------------------------------------------------------------------------//
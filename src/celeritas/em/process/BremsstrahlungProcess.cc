@@ -55,7 +55,8 @@ auto BremsstrahlungProcess::build_models(ActionIdIter start_id) const
                                                     *materials_,
                                                     imported_.processes(),
                                                     load_sb_,
-                                                    options_.enable_lpm)};
+                                                    options_.enable_lpm,
+                                                    options_.sb_cdf_tables)};
     }
     else
     {
@@ -63,7 +64,8 @@ auto BremsstrahlungProcess::build_models(ActionIdIter start_id) const
                                                      *particles_,
                                                      *materials_,
                                                      imported_.processes(),
-                                                     load_sb_),
+                                                     load_sb_,
+                                                     options_.sb_cdf_tables),
                 std::make_shared<RelativisticBremModel>(*start_id++,
                                                         *particles_,
                                                         *materials_,
@@ -43,6 +43,8 @@ class BremsstrahlungProcess : public Process
                                     //! energies
         bool use_integral_xs{true}; //!> Use integral method for sampling
                                     //! discrete interaction length
+        bool sb_cdf_tables{false};  //!> Sample SB photon energy from
+                                    //! precomputed spectrum tables
     };
 
   public:
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "corecel/Assert.hh"
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
 #include "corecel/cont/Array.hh"
@@ -135,5 +136,17 @@ void resize(VecgeomStateData<Ownership::value, M>* data,
     CELER_ENSURE(data);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a function to the persistent per-track collections of the state.
+ *
+ * The navigation states aren't collections, so they can't be visited.
+ */
+template<Ownership W, MemSpace M, class F>
+inline void for_each_track_items(const VecgeomStateData<W, M>&, F&&)
+{
+    CELER_NOT_IMPLEMENTED("reordering VecGeom track states");
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -0,0 +1,74 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/geo/WoodcockData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/OpaqueId.hh"
+#include "corecel/data/Collection.hh"
+#include "orange/Types.hh"
+#include "celeritas/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+//! Opaque index to a set of volumes tracked with a majorant cross section
+using WoodcockRegionId = OpaqueId<struct WoodcockRegion>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Materials present in a Woodcock tracking region.
+ */
+struct WoodcockRegion
+{
+    ItemRange<MaterialId> materials; //!< Unique materials of all volumes
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !materials.empty();
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Shared data for mapping volumes to Woodcock tracking regions.
+ */
+template<Ownership W, MemSpace M>
+struct WoodcockParamsData
+{
+    template<class T>
+    using Items = celeritas::Collection<T, W, M>;
+    template<class T>
+    using VolumeItems = celeritas::Collection<T, W, M, VolumeId>;
+    template<class T>
+    using RegionItems = celeritas::Collection<T, W, M, WoodcockRegionId>;
+
+    VolumeItems<WoodcockRegionId> volume_region; //!< Null if not in a region
+    RegionItems<WoodcockRegion>   regions;
+    Items<MaterialId>             materials;
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !volume_region.empty() && !regions.empty()
+               && !materials.empty();
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    WoodcockParamsData& operator=(const WoodcockParamsData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        volume_region = other.volume_region;
+        regions       = other.regions;
+        materials     = other.materials;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
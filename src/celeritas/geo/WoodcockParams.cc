@@ -0,0 +1,90 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/geo/WoodcockParams.cc
+//---------------------------------------------------------------------------//
+#include "WoodcockParams.hh"
+
+#include <set>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/io/Join.hh"
+#include "celeritas/geo/GeoParams.hh" // IWYU pragma: keep
+
+#include "GeoMaterialParams.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from geometry and volume names.
+ */
+WoodcockParams::WoodcockParams(const Input& input)
+{
+    CELER_EXPECT(input.geometry);
+    CELER_EXPECT(input.geomaterial);
+    CELER_VALIDATE(!input.regions.empty(),
+                   << "no Woodcock tracking regions were specified");
+
+    const GeoParams& geo = *input.geometry;
+    const auto& volume_to_mat = input.geomaterial->host_ref().materials;
+    CELER_ASSERT(volume_to_mat.size() == geo.num_volumes());
+
+    HostVal<WoodcockParamsData> host_data;
+    std::vector<WoodcockRegionId> volume_region(geo.num_volumes());
+    auto regions   = make_builder(&host_data.regions);
+    auto materials = make_builder(&host_data.materials);
+    for (auto region_idx : range(input.regions.size()))
+    {
+        const WoodcockRegionId region_id{region_idx};
+        std::set<MaterialId>   region_mats;
+        for (const std::string& name : input.regions[region_idx])
+        {
+            auto volumes = geo.find_volumes(name);
+            CELER_VALIDATE(!volumes.empty(),
+                           << "Woodcock tracking region " << region_idx
+                           << " has an unknown volume '" << name << "'");
+            for (VolumeId vol_id : volumes)
+            {
+                WoodcockRegionId& vol_region
+                    = volume_region[vol_id.unchecked_get()];
+                CELER_VALIDATE(!vol_region || vol_region == region_id,
+                               << "volume '" << geo.id_to_label(vol_id)
+                               << "' is in multiple Woodcock tracking "
+                                  "regions");
+                vol_region = region_id;
+                if (MaterialId mat_id = volume_to_mat[vol_id])
+                {
+                    region_mats.insert(mat_id);
+                }
+            }
+        }
+        CELER_VALIDATE(!region_mats.empty(),
+                       << "Woodcock tracking region " << region_idx
+                       << " has no volumes with materials: volumes are '"
+                       << join(input.regions[region_idx].begin(),
+                               input.regions[region_idx].end(),
+                               "', '")
+                       << "'");
+
+        WoodcockRegion region;
+        region.materials
+            = materials.insert_back(region_mats.begin(), region_mats.end());
+        regions.push_back(region);
+    }
+    make_builder(&host_data.volume_region)
+        .insert_back(volume_region.begin(), volume_region.end());
+
+    // Move to mirrored data, copying to device
+    data_ = CollectionMirror<WoodcockParamsData>{std::move(host_data)};
+    CELER_ENSURE(data_);
+    CELER_ENSURE(this->num_regions() == input.regions.size());
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
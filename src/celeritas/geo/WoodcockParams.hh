@@ -0,0 +1,84 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/geo/WoodcockParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "corecel/Types.hh"
+#include "corecel/data/CollectionMirror.hh"
+
+#include "GeoParamsFwd.hh"
+#include "WoodcockData.hh"
+
+namespace celeritas
+{
+class GeoMaterialParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Group geometry volumes into regions for Woodcock (delta) tracking.
+ *
+ * Neutral particles inside a region sample their distance to collision from a
+ * majorant cross section: the largest macroscopic cross section of any
+ * material in the region at the particle's energy. They then travel through
+ * the region's internal boundaries without stopping, and at the collision site
+ * the interaction is rejected as a "virtual" collision with probability \f$ 1
+ * - \sigma / \sigma_\mathrm{maj} \f$. This greatly reduces the number of steps
+ * in finely segmented regions such as sampling calorimeters, whose layers are
+ * much thinner than a photon's mean free path.
+ *
+ * Each region is a list of volume names; every volume with a matching name
+ * (including all its uniquifying extensions) belongs to the region. A volume
+ * may belong to at most one region, and the materials of each region are
+ * determined from the geometry-material mapping.
+ */
+class WoodcockParams
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstGeo         = std::shared_ptr<const GeoParams>;
+    using SPConstGeoMaterial = std::shared_ptr<const GeoMaterialParams>;
+    using VecString          = std::vector<std::string>;
+
+    using HostRef   = HostCRef<WoodcockParamsData>;
+    using DeviceRef = DeviceCRef<WoodcockParamsData>;
+    //!@}
+
+    //! Input parameters
+    struct Input
+    {
+        SPConstGeo             geometry;
+        SPConstGeoMaterial     geomaterial;
+        std::vector<VecString> regions; //!< Volume names in each region
+    };
+
+  public:
+    // Construct from geometry and volume names
+    explicit WoodcockParams(const Input&);
+
+    //! Number of regions
+    WoodcockRegionId::size_type num_regions() const
+    {
+        return this->host_ref().regions.size();
+    }
+
+    //! Access region data on the host
+    const HostRef& host_ref() const { return data_.host(); }
+
+    //! Access region data on the device
+    const DeviceRef& device_ref() const { return data_.device(); }
+
+  private:
+    CollectionMirror<WoodcockParamsData> data_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
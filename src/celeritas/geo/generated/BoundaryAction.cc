@@ -12,6 +12,7 @@
 #include "corecel/Types.hh"
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
+#include "celeritas/global/HostLauncher.hh"
 #include "celeritas/global/TrackLauncher.hh"
 #include "../detail/BoundaryActionImpl.hh" // IWYU pragma: associated
 
@@ -25,11 +26,9 @@ void BoundaryAction::execute(CoreHostRef const& data) const
 
     MultiExceptionHandler capture_exception;
     auto launch = make_track_launcher(data, detail::boundary_track);
-    #pragma omp parallel for
-    for (size_type i = 0; i < data.states.size(); ++i)
-    {
-        CELER_TRY_ELSE(launch(ThreadId{i}), capture_exception);
-    }
+    launch_host_tracks(data, [&](ThreadId tid) {
+        CELER_TRY_ELSE(launch(tid), capture_exception);
+    });
     log_and_rethrow(std::move(capture_exception));
 }
 
@@ -18,7 +18,7 @@ namespace celeritas
 namespace generated
 {
 //---------------------------------------------------------------------------//
-class BoundaryAction final : public ExplicitActionInterface, public ConcreteAction
+class BoundaryAction final : public FusibleActionInterface, public ConcreteAction
 {
 public:
   // Construct with ID and label
@@ -88,6 +88,23 @@ class ExplicitActionInterface : public virtual ActionInterface
     ~ExplicitActionInterface() = default;
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Interface for an explicit action that acts independently on each track.
+ *
+ * On host, these actions must only touch track slots in
+ * \c CoreRef::fused_slots if it is nonempty (see \c launch_host_tracks ).
+ * Consecutive fusible actions can then be executed back-to-back on a small
+ * chunk of track slots, while that chunk's state is still in cache, rather
+ * than each action looping over every track slot in turn.
+ */
+class FusibleActionInterface : public ExplicitActionInterface
+{
+  protected:
+    // Protected destructor prevents deletion of pointer-to-interface
+    ~FusibleActionInterface() = default;
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Concrete mixin utility class for managing an action.
@@ -18,6 +18,7 @@
 #include "celeritas/phys/ParticleParams.hh"   // IWYU pragma: keep
 #include "celeritas/phys/PhysicsParams.hh"    // IWYU pragma: keep
 #include "celeritas/random/RngParams.hh"      // IWYU pragma: keep
+#include "celeritas/track/SortTracksAction.hh"
 #include "celeritas/track/TrackInitParams.hh" // IWYU pragma: keep
 
 #include "ActionInterface.hh"
@@ -98,6 +99,16 @@ CoreParams::CoreParams(Input input) : input_(std::move(input))
         "geo-propagation-limit",
         "Propagation substep/range limit"));
 
+    // Construct action to partition tracks by post-step action
+    input_.action_reg->insert(std::make_shared<SortTracksAction>(
+        input_.action_reg->next_id(),
+        "sort-tracks-post",
+        "Partition track slots by post-step action"));
+
+    // Save the number of possible post-step actions: any actions added after
+    // this point (e.g., along-step or user actions) cannot limit the step
+    scalars_.num_actions = input_.action_reg->num_actions();
+
     // Save host reference
     host_ref_ = build_params_refs<MemSpace::host>(input_, scalars_);
     if (celeritas::device())
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "corecel/cont/Range.hh"
 #include "celeritas/geo/GeoData.hh"
 #include "celeritas/geo/GeoMaterialData.hh"
 #include "celeritas/mat/MaterialData.hh"
@@ -16,9 +17,15 @@
 #include "celeritas/random/RngData.hh"
 #include "celeritas/track/SimData.hh"
 #include "celeritas/track/TrackInitData.hh"
+#include "celeritas/track/TrackSortData.hh"
 
 namespace celeritas
 {
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+class StepScratchArena;
+class ThreadPool;
+
 //---------------------------------------------------------------------------//
 /*!
  * Memspace-independent core variables.
@@ -28,10 +35,13 @@ struct CoreScalars
     ActionId boundary_action;
     ActionId propagation_limit_action;
 
+    //! Number of actions that can be a post-step action
+    ActionId::size_type num_actions{0};
+
     //! True if assigned and valid
     explicit CELER_FUNCTION operator bool() const
     {
-        return boundary_action && propagation_limit_action;
+        return boundary_action && propagation_limit_action && num_actions > 0;
     }
 };
 
@@ -97,6 +107,7 @@ struct CoreStateData
     RngStateData<W, M>       rng;
     SimStateData<W, M>       sim;
     TrackInitStateData<W, M> init;
+    TrackSortStateData<W, M> sort;
 
     //! Number of state elements
     CELER_FUNCTION size_type size() const { return particles.size(); }
@@ -105,7 +116,7 @@ struct CoreStateData
     explicit CELER_FUNCTION operator bool() const
     {
         return geometry && materials && particles && physics && rng && sim
-               && init;
+               && init && sort;
     }
 
     //! Assign from another set of data
@@ -120,6 +131,7 @@ struct CoreStateData
         rng       = other.rng;
         sim       = other.sim;
         init      = other.init;
+        sort      = other.sort;
         return *this;
     }
 };
@@ -135,12 +147,23 @@ using CoreStateHostRef    = HostRef<CoreStateData>;
  * Reference to core parameters and states.
  *
  * This is passed via \c ExplicitActionInterface::execute to launch kernels.
+ * The optional scratch arena is a host-side object that provides temporary
+ * memory for host code that runs during the step; it must not be accessed
+ * from kernels. Likewise, the optional thread pool executes host track loops
+ * in place of OpenMP (see \c launch_host ).
+ *
+ * When host actions are fused, \c fused_slots is the chunk of track slots
+ * that a \c FusibleActionInterface action must restrict itself to (see
+ * \c launch_host_tracks ). It is empty, meaning all track slots, otherwise.
  */
 template<MemSpace M>
 struct CoreRef
 {
     CoreParamsData<Ownership::const_reference, M> params;
     CoreStateData<Ownership::reference, M>        states;
+    StepScratchArena<M>*                          scratch{nullptr};
+    ThreadPool*                                   thread_pool{nullptr};
+    Range<ThreadId>                               fused_slots;
 
     //! True if assigned
     CELER_FUNCTION operator bool() const { return params && states; }
@@ -169,6 +192,28 @@ inline void resize(CoreStateData<Ownership::value, M>* state,
     resize(&state->rng, params.rng, size);
     resize(&state->sim, size);
     resize(&state->init, params.init, size);
+    resize(&state->sort, params.scalars.num_actions, size);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a function to the persistent per-track collections of all states.
+ *
+ * The function is called with each collection, which holds one item per
+ * track or consecutive blocks of one item per track. Scratch space that is
+ * rewritten during every step isn't visited, nor are the track initializers
+ * and the action sorting order, which index track slots rather than being
+ * indexed by them.
+ */
+template<Ownership W, MemSpace M, class F>
+inline void for_each_track_items(const CoreStateData<W, M>& state, F&& visit)
+{
+    for_each_track_items(state.geometry, visit);
+    for_each_track_items(state.materials, visit);
+    for_each_track_items(state.particles, visit);
+    for_each_track_items(state.physics, visit);
+    for_each_track_items(state.rng, visit);
+    for_each_track_items(state.sim, visit);
 }
 
 //---------------------------------------------------------------------------//
@@ -53,6 +53,9 @@ class CoreTrackView
     // Return a material view
     inline CELER_FUNCTION MaterialTrackView make_material_view() const;
 
+    // Return a view to the properties of another material
+    inline CELER_FUNCTION MaterialView make_material_view(MaterialId) const;
+
     // Return a particle view
     inline CELER_FUNCTION ParticleTrackView make_particle_view() const;
 
@@ -62,6 +65,9 @@ class CoreTrackView
     // Return a physics view
     inline CELER_FUNCTION PhysicsTrackView make_physics_view() const;
 
+    // Return a physics view of the track's particle in another material
+    inline CELER_FUNCTION PhysicsTrackView make_physics_view(MaterialId) const;
+
     // Return a view to temporary physics data
     inline CELER_FUNCTION PhysicsStepView make_physics_step_view() const;
 
@@ -136,6 +142,19 @@ CELER_FUNCTION auto CoreTrackView::make_material_view() const
     return MaterialTrackView{params_.materials, states_.materials, thread_};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Return a view to the properties of another material.
+ *
+ * This is used to bound the track's cross sections over several materials.
+ */
+CELER_FUNCTION auto CoreTrackView::make_material_view(MaterialId mat_id) const
+    -> MaterialView
+{
+    CELER_EXPECT(mat_id);
+    return MaterialView{params_.materials, mat_id};
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Return a particle view.
@@ -165,6 +184,20 @@ CELER_FUNCTION auto CoreTrackView::make_physics_view() const -> PhysicsTrackView
 {
     MaterialId mat_id = this->make_material_view().material_id();
     CELER_ASSERT(mat_id);
+    return this->make_physics_view(mat_id);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Return a physics view of the track's particle in another material.
+ *
+ * The persistent physics state is shared with the view of the current
+ * material, so this should only be used to calculate cross sections.
+ */
+CELER_FUNCTION auto CoreTrackView::make_physics_view(MaterialId mat_id) const
+    -> PhysicsTrackView
+{
+    CELER_EXPECT(mat_id);
     ParticleId par_id = this->make_particle_view().particle_id();
     CELER_ASSERT(par_id);
     return PhysicsTrackView{
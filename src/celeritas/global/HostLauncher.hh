@@ -0,0 +1,114 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/HostLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/sys/ThreadId.hh"
+#include "corecel/sys/ThreadPool.hh"
+#include "celeritas/Types.hh"
+
+#include "CoreTrackData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Call a function for every thread ID in [0, num_threads) on host.
+ *
+ * This is the host analog of a kernel launch and should be used primarily by
+ * generated action launchers:
+ *
+ * \code
+    MultiExceptionHandler capture_exception;
+    auto launch = make_track_launcher(data, foo_track);
+    launch_host(data, data.states.size(), [&](ThreadId tid) {
+        CELER_TRY_ELSE(launch(tid), capture_exception);
+    });
+    log_and_rethrow(std::move(capture_exception));
+   \endcode
+ *
+ * The loop is executed by the core data's thread pool if one is present, and
+ * with an OpenMP parallel loop (or serially if OpenMP is disabled) otherwise.
+ */
+template<class F>
+void launch_host(CoreRef<MemSpace::host> const& data,
+                 size_type                      num_threads,
+                 F&&                            call_thread)
+{
+    CELER_EXPECT(data.fused_slots.empty());
+
+    if (data.thread_pool)
+    {
+        data.thread_pool->parallel_for(
+            num_threads, [&call_thread](size_type i) {
+                call_thread(ThreadId{i});
+            });
+        return;
+    }
+
+#pragma omp parallel for
+    for (size_type i = 0; i < num_threads; ++i)
+    {
+        call_thread(ThreadId{i});
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Call a function for every track slot on host.
+ *
+ * This should be used by \c FusibleActionInterface actions: if the core data
+ * has a nonempty \c fused_slots chunk, only those slots are visited, serially,
+ * since the caller is already parallel over chunks.
+ */
+template<class F>
+void launch_host_tracks(CoreRef<MemSpace::host> const& data, F&& call_thread)
+{
+    if (!data.fused_slots.empty())
+    {
+        for (ThreadId tid : data.fused_slots)
+        {
+            call_thread(tid);
+        }
+        return;
+    }
+
+    launch_host(data, data.states.size(), std::forward<F>(call_thread));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Call a function for every track slot whose post-step action is \c action .
+ *
+ * Track slots are visited through the ranges partitioned by the sort-tracks
+ * action. When actions are fused, the tracks are not sorted and every slot in
+ * the chunk is visited: the function must then check the track's action.
+ */
+template<class F>
+void launch_host_action(CoreRef<MemSpace::host> const& data,
+                        ActionId                       action,
+                        F&&                            call_slot)
+{
+    if (!data.fused_slots.empty())
+    {
+        launch_host_tracks(data, std::forward<F>(call_slot));
+        return;
+    }
+
+    auto const  threads = data.states.sort.action_threads(action);
+    auto const& slots   = data.states.sort.track_slots;
+    launch_host(data, threads.size(), [&](ThreadId tid) {
+        call_slot(slots[threads[tid.get()]]);
+    });
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,105 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/StepScratchArena.cc
+//---------------------------------------------------------------------------//
+#include "StepScratchArena.hh"
+
+#include <algorithm>
+
+#include "corecel/data/CollectionBuilder.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with an optional initial capacity.
+ */
+template<MemSpace M>
+StepScratchArena<M>::StepScratchArena(size_type capacity)
+{
+    if (capacity > 0)
+    {
+        this->add_block(capacity);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate uninitialized memory valid until the next reset.
+ *
+ * The result is aligned to \c alignment() bytes. A zero-byte request returns
+ * a null pointer.
+ */
+template<MemSpace M>
+Byte* StepScratchArena<M>::allocate(size_type num_bytes)
+{
+    if (num_bytes == 0)
+    {
+        return nullptr;
+    }
+
+    // Round up so the next allocation is also aligned
+    num_bytes = (num_bytes + alignment() - 1) / alignment() * alignment();
+
+    if (blocks_.empty() || offset_ + num_bytes > blocks_.back().size())
+    {
+        // Double the total capacity, leaving earlier allocations in place
+        this->add_block(std::max(num_bytes, capacity_));
+    }
+
+    Byte* result = blocks_.back()[AllItems<Byte, M>{}].data() + offset_;
+    offset_ += num_bytes;
+    size_ += num_bytes;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Release all allocations and consolidate storage.
+ *
+ * If more than one block was needed during the last step, they are replaced
+ * by a single block with the combined capacity.
+ */
+template<MemSpace M>
+void StepScratchArena<M>::reset()
+{
+    if (blocks_.size() > 1)
+    {
+        size_type capacity = capacity_;
+        blocks_.clear();
+        capacity_ = 0;
+        this->add_block(capacity);
+    }
+    offset_ = 0;
+    size_   = 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add a block of memory and make it the active one.
+ */
+template<MemSpace M>
+void StepScratchArena<M>::add_block(size_type num_bytes)
+{
+    CELER_EXPECT(num_bytes > 0);
+    num_bytes = (num_bytes + alignment() - 1) / alignment() * alignment();
+
+    blocks_.emplace_back();
+    resize(&blocks_.back(), num_bytes);
+    offset_ = 0;
+    capacity_ += num_bytes;
+    ++num_allocations_;
+}
+
+//---------------------------------------------------------------------------//
+// EXPLICIT INSTANTIATION
+//---------------------------------------------------------------------------//
+
+template class StepScratchArena<MemSpace::host>;
+template class StepScratchArena<MemSpace::device>;
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,110 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/StepScratchArena.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/data/Collection.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Bump allocator for temporary memory used during a single step.
+ *
+ * Track initialization and other host-side step helpers draw their temporary
+ * storage (including the temporary storage needed by device-wide algorithms)
+ * from this arena rather than allocating memory for every call. All
+ * allocations are released at once by \c reset at the start of every step.
+ *
+ * If an allocation doesn't fit in the current block, a new block is
+ * allocated so that previous allocations in the step remain valid; the total
+ * capacity at least doubles each time. At the next reset, multiple blocks are
+ * consolidated into a single block large enough for the whole step. Memory is
+ * never returned to the system until the arena is destroyed, so after the
+ * first few steps no further allocations occur.
+ *
+ * Allocations are padded to a multiple of \c alignment() bytes so that they
+ * are as aligned as the underlying block: at least 256 bytes on device, and
+ * suitable for any scalar type on host.
+ */
+template<MemSpace M>
+class StepScratchArena
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using size_type = std::size_t;
+    //!@}
+
+    //! Padding of every allocation in bytes
+    static constexpr size_type alignment() { return 256; }
+
+  public:
+    // Construct with an optional initial capacity
+    explicit StepScratchArena(size_type capacity = 0);
+
+    // Allocate uninitialized memory valid until the next reset
+    Byte* allocate(size_type num_bytes);
+
+    // Allocate uninitialized typed memory valid until the next reset
+    template<class T>
+    inline Span<T> allocate(size_type count);
+
+    // Release all allocations and consolidate storage
+    void reset();
+
+    //// ACCESSORS ////
+
+    //! Number of bytes allocated since the last reset
+    size_type size() const { return size_; }
+
+    //! Number of bytes that can be allocated before more memory is needed
+    size_type capacity() const { return capacity_; }
+
+    //! Cumulative number of heap or device memory allocations
+    size_type num_allocations() const { return num_allocations_; }
+
+  private:
+    using Block = Collection<Byte, Ownership::value, M>;
+
+    std::vector<Block> blocks_;
+    size_type          offset_{0};
+    size_type          size_{0};
+    size_type          capacity_{0};
+    size_type          num_allocations_{0};
+
+    // Add a block of memory
+    void add_block(size_type num_bytes);
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate uninitialized typed memory valid until the next reset.
+ */
+template<MemSpace M>
+template<class T>
+Span<T> StepScratchArena<M>::allocate(size_type count)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Scratch data must be trivially copyable");
+    static_assert(alignof(T) <= alignof(std::max_align_t),
+                  "Type alignment exceeds arena alignment");
+    Byte* data = this->allocate(count * sizeof(T));
+    return {reinterpret_cast<T*>(data), count};
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -7,7 +7,14 @@
 //---------------------------------------------------------------------------//
 #include "Stepper.hh"
 
+#include <algorithm>
+#include <utility>
+
+#include "celeritas_config.h"
 #include "corecel/Assert.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
+#include "corecel/data/CollectionBuilder.hh"
 #include "corecel/data/Ref.hh"
 #include "celeritas/phys/PhysicsParams.hh"
 #include "celeritas/phys/Primary.hh"
@@ -17,6 +24,7 @@
 #include "ActionRegistry.hh"
 #include "CoreParams.hh"
 #include "detail/ActionSequence.hh"
+#include "detail/ReorderTracks.hh"
 
 namespace celeritas
 {
@@ -30,6 +38,11 @@ Stepper<M>::Stepper(Input input) : params_(std::move(input.params))
     CELER_EXPECT(params_);
     CELER_VALIDATE(input.num_track_slots > 0,
                    << "number of track slots has not been set");
+    CELER_VALIDATE(input.reorder_period == 0 || !CELERITAS_USE_VECGEOM,
+                   << "track states cannot be reordered with VecGeom "
+                      "(reorder_period="
+                   << input.reorder_period << ")");
+    reorder_period_ = input.reorder_period;
     states_ = CollectionStateStore<CoreStateData, M>(params_->host_ref(),
                                                      input.num_track_slots);
 
@@ -37,6 +50,10 @@ Stepper<M>::Stepper(Input input) : params_(std::move(input.params))
     {
         ActionSequence::Options opts;
         opts.sync = input.sync;
+        if (M == MemSpace::host)
+        {
+            opts.fused_chunk_size = input.fused_chunk_size;
+        }
         actions_
             = std::make_shared<ActionSequence>(*params_->action_reg(), opts);
     }
@@ -44,6 +61,17 @@ Stepper<M>::Stepper(Input input) : params_(std::move(input.params))
     core_ref_.params = get_ref<M>(*params_);
     core_ref_.states = states_.ref();
 
+    stream_ = Stream(M);
+
+    scratch_          = std::make_unique<StepScratchArena<M>>();
+    core_ref_.scratch = scratch_.get();
+
+    if (M == MemSpace::host && input.host_pool)
+    {
+        thread_pool_          = std::make_unique<ThreadPool>(input.host_pool);
+        core_ref_.thread_pool = thread_pool_.get();
+    }
+
     CELER_ENSURE(actions_ && *actions_);
 }
 
@@ -58,6 +86,11 @@ Stepper<M>::~Stepper() = default;
  *
  * A single transport step is simply a loop over a toplogically sorted DAG
  * of kernels.
+ *
+ * Temporary memory needed by the step's helper functions is drawn from a
+ * \c StepScratchArena that is reset at the start of every step. Track
+ * initializers that don't fit in the state are spilled to host, oldest
+ * first, and returned in order as track slots become vacant.
  */
 template<MemSpace M>
 auto Stepper<M>::operator()() -> result_type
@@ -66,18 +99,53 @@ auto Stepper<M>::operator()() -> result_type
 
     result_type result;
 
+    // Release temporary memory from the previous step
+    scratch_->reset();
+    const size_type spill_capacity = init_spill_.capacity();
+
+    // Create track initializers from primaries uploaded since the last step
+    this->initialize_staged();
+
     // Create new tracks from queued primaries or secondaries
-    initialize_tracks(core_ref_);
+    initialize_tracks(core_ref_, &init_spill_);
     result.active = states_.size() - core_ref_.states.init.vacancies.size();
 
+    // Periodically sort the track states to improve physics table locality
+    if (reorder_period_ > 0 && ++steps_since_reorder_ == reorder_period_)
+    {
+        auto reordered       = detail::reorder_tracks(core_ref_);
+        result.mixed_before  = reordered.mixed_before;
+        result.mixed_after   = reordered.mixed_after;
+        steps_since_reorder_ = 0;
+    }
+
+    // Clear the secondary stack before any action can allocate from it: the
+    // pre-step action may be executed concurrently with interactions when
+    // actions are fused
+    fill(size_type(0), &core_ref_.states.physics.secondaries.size);
+
     actions_->execute(core_ref_);
 
     // Create track initializers from surviving secondaries
-    extend_from_secondaries(core_ref_);
+    extend_from_secondaries(core_ref_, &init_spill_);
+
+    // Make room for secondaries from any interactions that failed
+    result.secondaries = this->update_secondaries();
 
     // Get the number of track initializers and active tracks
-    result.alive  = states_.size() - core_ref_.states.init.vacancies.size();
-    result.queued = core_ref_.states.init.initializers.size();
+    result.alive   = states_.size() - core_ref_.states.init.vacancies.size();
+    result.spilled = init_spill_.size();
+    result.queued  = core_ref_.states.init.initializers.size() + result.spilled;
+    if (init_spill_.capacity() != spill_capacity)
+    {
+        // Host buffer for spilled initializers grew
+        ++num_staging_allocations_;
+    }
+
+    // Count allocations made by this step and by staging since the last one
+    size_type num_allocations = this->num_allocations();
+    result.allocations        = num_allocations - prev_num_allocations_;
+    prev_num_allocations_     = num_allocations;
 
     return result;
 }
@@ -92,18 +160,125 @@ auto Stepper<M>::operator()(SpanConstPrimary primaries) -> result_type
     CELER_EXPECT(*this);
     CELER_EXPECT(!primaries.empty());
 
-    CELER_VALIDATE(primaries.size() + core_ref_.states.init.initializers.size()
-                       <= core_ref_.states.init.initializers.capacity(),
-                   << "insufficient initializer capacity ("
-                   << core_ref_.states.init.initializers.capacity()
-                   << ") with size ("
-                   << core_ref_.states.init.initializers.size()
-                   << ") for primaries (" << primaries.size() << ")");
+    this->stage_primaries(primaries);
+    return (*this)();
+}
 
-    // Create track initializers
-    extend_from_primaries(core_ref_, primaries);
+//---------------------------------------------------------------------------//
+/*!
+ * Asynchronously upload primaries to be initialized at the next step.
+ *
+ * The primaries are copied into the pinned host staging buffer (so the input
+ * can be discarded after this call) and an upload to the state's memory space
+ * is enqueued on the staging stream. Multiple batches can be staged between
+ * steps, so a caller that produces primaries incrementally (such as the Geant4
+ * offload in \c LocalTransporter ) can upload each batch while it continues
+ * to work. Primaries that don't fit in the track initializer storage are
+ * spilled to host along with older initializers.
+ */
+template<MemSpace M>
+void Stepper<M>::stage_primaries(SpanConstPrimary primaries)
+{
+    CELER_EXPECT(*this);
+    CELER_EXPECT(!primaries.empty());
 
-    return (*this)();
+    size_type start = staged_host_.size();
+    size_type stop  = start + primaries.size();
+    if (stop > staged_host_.capacity() || stop > staged_.size())
+    {
+        // Growing either buffer invalidates memory being read or written by
+        // a pending upload: wait for it, then reallocate and upload all the
+        // staged primaries
+        stream_.sync();
+        staged_host_.reserve(std::max(stop, 2 * staged_host_.capacity()));
+        resize(&staged_, staged_host_.capacity());
+        num_staging_allocations_ += 2;
+        start = 0;
+    }
+    staged_host_.insert(staged_host_.end(), primaries.begin(), primaries.end());
+
+    Span<const Primary> src = make_span(staged_host_);
+    Span<Primary>       dst = staged_[AllItems<Primary, M>{}];
+    stream_.copy_async(dst.subspan(start, stop - start),
+                       src.subspan(start, stop - start));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create track initializers from staged primaries.
+ *
+ * The conversion kernel is ordered after the pending uploads without blocking
+ * the host, so that an upload enqueued just before the step overlaps with the
+ * launch of its first kernels. The step synchronizes on the track counts
+ * before returning, so the buffer can be safely reused at the next call to
+ * \c stage_primaries .
+ */
+template<MemSpace M>
+void Stepper<M>::initialize_staged()
+{
+    if (staged_host_.empty())
+    {
+        return;
+    }
+
+    stream_.fence();
+    extend_from_staged_primaries(
+        core_ref_,
+        staged_[AllItems<Primary, M>{}].subspan(0, staged_host_.size()),
+        &init_spill_);
+    staged_host_.clear();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Grow the secondary stack if it overflowed during the step.
+ *
+ * This must be called after the secondaries have been converted to track
+ * initializers, since the stack contents are discarded. Tracks whose
+ * interactions failed keep the "physics-failure" step limit and are resampled
+ * at the start of the next step. The return value is the total number of
+ * secondary slots requested during the step: its peak over all steps can be
+ * used to tune the \c secondary_stack_factor physics option.
+ */
+template<MemSpace M>
+size_type Stepper<M>::update_secondaries()
+{
+    const auto& stack = core_ref_.states.physics.secondaries;
+
+    // Copy the allocated size and the failed request count
+    Array<size_type, 2> counts;
+    copy_to_host(stack.size, make_span(counts));
+    size_type requested = counts[0] + counts[1];
+    max_secondaries_    = std::max(max_secondaries_, requested);
+
+    if (CELER_UNLIKELY(counts[1] > 0))
+    {
+        // Grow geometrically to amortize reallocation
+        size_type capacity = std::max(requested, 2 * stack.capacity());
+        StackAllocatorData<Secondary, Ownership::value, M> grown;
+        resize(&grown, capacity);
+        states_.update(
+            [this, &grown](CoreStateData<Ownership::value, M>& state) {
+                // Only update the stack in the step's reference, since the
+                // track initializer counts are stored in it
+                state.physics.secondaries = std::move(grown);
+                core_ref_.states.physics.secondaries
+                    = state.physics.secondaries;
+            });
+        ++num_secondary_allocations_;
+    }
+    return requested;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Total number of memory allocations by the stepper.
+ */
+template<MemSpace M>
+size_type Stepper<M>::num_allocations() const
+{
+    return scratch_->num_allocations() + num_staging_allocations_
+           + num_secondary_allocations_;
 }
 
 //---------------------------------------------------------------------------//
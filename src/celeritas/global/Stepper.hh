@@ -12,10 +12,16 @@
 
 #include "corecel/Types.hh"
 #include "corecel/cont/Span.hh"
+#include "corecel/data/Collection.hh"
 #include "corecel/data/CollectionStateStore.hh"
+#include "corecel/data/PinnedAllocator.hh"
+#include "corecel/sys/Stream.hh"
+#include "corecel/sys/ThreadPool.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/geo/GeoParamsFwd.hh"
 #include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/global/StepScratchArena.hh"
+#include "celeritas/phys/Primary.hh"
 #include "celeritas/random/RngParamsFwd.hh"
 #include "celeritas/track/TrackInitData.hh"
 
@@ -23,7 +29,6 @@ namespace celeritas
 {
 //---------------------------------------------------------------------------//
 class CoreParams;
-struct Primary;
 
 namespace detail
 {
@@ -37,12 +42,23 @@ class ActionSequence;
  * - \c params : Problem definition
  * - \c num_track_slots : Maximum number of threads to run in parallel on GPU
  * - \c sync : Whether to synchronize device between actions
+ * - \c host_pool : Execute host track loops on a persistent thread pool
+ *   instead of with OpenMP if the number of threads is nonzero
+ * - \c fused_chunk_size : Execute consecutive host actions on chunks of this
+ *   many track slots rather than one action at a time if nonzero (see
+ *   \c ActionSequence )
+ * - \c reorder_period : Sort the track states by particle type, material, and
+ *   energy every this many steps if nonzero, so that neighboring track slots
+ *   look up nearby physics table entries. This is not supported with VecGeom.
  */
 struct StepperInput
 {
     std::shared_ptr<const CoreParams> params;
     size_type                         num_track_slots{};
     bool                              sync{false};
+    ThreadPool::Options               host_pool;
+    size_type                         fused_chunk_size{0};
+    size_type                         reorder_period{0};
 
     //! True if defined
     explicit operator bool() const { return params && num_track_slots > 0; }
@@ -51,12 +67,26 @@ struct StepperInput
 //---------------------------------------------------------------------------//
 /*!
  * Track counters for a step.
+ *
+ * The \c allocations counter includes the step's scratch memory, primary
+ * staging buffers, spilled track initializers, and secondary stack growth. It
+ * should be zero once the stepping loop is warmed up.
+ *
+ * If the track states were reordered at the start of the step, the \c mixed
+ * counters are the number of adjacent pairs of active tracks with a different
+ * particle type or material, and hence different physics tables, before and
+ * after reordering.
  */
 struct StepperResult
 {
-    size_type queued{}; //!< Pending track initializers at end of step
-    size_type active{}; //!< Active tracks at start of step
-    size_type alive{};  //!< Active and alive at end of step
+    size_type queued{};       //!< Pending track initializers at end of step
+    size_type spilled{};      //!< Pending initializers held in host memory
+    size_type active{};       //!< Active tracks at start of step
+    size_type alive{};        //!< Active and alive at end of step
+    size_type secondaries{};  //!< Secondary stack slots requested during step
+    size_type allocations{};  //!< Memory allocations since the last step
+    size_type mixed_before{}; //!< Neighbors using different tables
+    size_type mixed_after{};  //!< Neighbors using different tables after
 
     //! True if more steps need to be run
     explicit operator bool() const { return queued > 0 || alive > 0; }
@@ -82,6 +112,9 @@ class StepperInterface
     // Transport existing states and these new primaries
     virtual StepperResult operator()(SpanConstPrimary primaries) = 0;
 
+    // Asynchronously upload primaries to initialize at the next step
+    virtual void stage_primaries(SpanConstPrimary primaries) = 0;
+
     //! Whether the stepper is assigned/valid
     virtual explicit operator bool() const = 0;
 
@@ -108,6 +141,9 @@ class StepperInterface
        alive_tracks = step();
    }
    \endcode
+ *
+ * See \c StepperInput for the host execution and track reordering options,
+ * and \c StepperResult for the counters reported by each step.
  */
 template<MemSpace M>
 class Stepper final : public StepperInterface
@@ -134,6 +170,15 @@ class Stepper final : public StepperInterface
     // Transport existing states and these new primaries
     StepperResult operator()(SpanConstPrimary primaries) final;
 
+    // Asynchronously upload primaries to initialize at the next step
+    void stage_primaries(SpanConstPrimary primaries) final;
+
+    //! Number of primaries waiting to be initialized at the next step
+    size_type num_staged() const { return staged_host_.size(); }
+
+    //! Maximum number of secondary stack slots requested in a single step
+    size_type max_secondaries() const { return max_secondaries_; }
+
     //! Whether the stepper is assigned/valid
     explicit operator bool() const final { return static_cast<bool>(states_); }
 
@@ -150,6 +195,43 @@ class Stepper final : public StepperInterface
 
     // Combined param/state for action calls
     CoreRef<M> core_ref_;
+
+    // Reusable staging for primaries
+    Stream                                         stream_;
+    std::vector<Primary, PinnedAllocator<Primary>> staged_host_;
+    Collection<Primary, Ownership::value, M>       staged_;
+
+    // Track initializers that don't fit in the state
+    TrackInitSpill init_spill_;
+
+    // Reusable temporary memory for step helpers
+    std::unique_ptr<StepScratchArena<M>> scratch_;
+
+    // Optional executor for host track loops
+    std::unique_ptr<ThreadPool> thread_pool_;
+
+    // Allocation counters
+    size_type num_staging_allocations_{0};
+    size_type num_secondary_allocations_{0};
+    size_type prev_num_allocations_{0};
+
+    // Secondary stack high-water mark
+    size_type max_secondaries_{0};
+
+    // Reordering frequency and steps since the last reordering
+    size_type reorder_period_{0};
+    size_type steps_since_reorder_{0};
+
+    //// HELPER FUNCTIONS ////
+
+    // Create track initializers from staged primaries
+    void initialize_staged();
+
+    // Grow the secondary stack if it overflowed during the step
+    size_type update_secondaries();
+
+    // Total number of memory allocations by the stepper
+    size_type num_allocations() const;
 };
 
 //---------------------------------------------------------------------------//
@@ -12,6 +12,7 @@
 #include "corecel/Macros.hh"
 #include "corecel/OpaqueId.hh"
 #include "corecel/Types.hh"
+#include "corecel/math/NumericLimits.hh"
 #include "orange/Types.hh"
 #include "celeritas/Types.hh"
 
@@ -49,13 +50,17 @@ inline CELER_FUNCTION void along_step(MH&&                 msc,
     // within-step MSC
     AlongStepLocalState local;
     local.step_limit = sim.step_limit();
-    CELER_ASSERT(local.step_limit);
+    // An unset action means that no physics process can limit the step
+    CELER_ASSERT(local.step_limit
+                 || local.step_limit.step
+                        == numeric_limits<real_type>::infinity());
     if (local.step_limit.step == 0)
     {
-        // Track is stopped: no movement or energy loss will happen
-        // (could be a stopped positron waiting for annihilation, or a particle
-        // waiting to decay?)
-        CELER_ASSERT(track.make_particle_view().is_stopped());
+        // Track is stopped or retrying a failed interaction: no movement or
+        // energy loss will happen (could be a stopped positron waiting for
+        // annihilation, or a particle waiting to decay?)
+        CELER_ASSERT(track.make_particle_view().is_stopped()
+                     || track.make_physics_step_view().retry_interaction());
         CELER_ASSERT(local.step_limit.action
                      == track.make_physics_view().scalars().discrete_action());
         // Increment the step counter
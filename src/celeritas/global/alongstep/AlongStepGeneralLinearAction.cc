@@ -14,7 +14,9 @@
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/em/FluctuationParams.hh"
 #include "celeritas/em/model/UrbanMscModel.hh"
+#include "celeritas/geo/WoodcockParams.hh"
 #include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/global/HostLauncher.hh"
 #include "celeritas/global/alongstep/detail/AlongStepLauncherImpl.hh"
 #include "celeritas/phys/PhysicsParams.hh"
 
@@ -32,7 +34,8 @@ AlongStepGeneralLinearAction::from_params(ActionId              id,
                                           const MaterialParams& materials,
                                           const ParticleParams& particles,
                                           const PhysicsParams&  physics,
-                                          bool eloss_fluctuation)
+                                          bool eloss_fluctuation,
+                                          SPConstWoodcock woodcock)
 {
     SPConstFluctuations fluct;
     if (eloss_fluctuation)
@@ -54,7 +57,7 @@ AlongStepGeneralLinearAction::from_params(ActionId              id,
     }
 
     return std::make_shared<AlongStepGeneralLinearAction>(
-        id, std::move(fluct), std::move(msc));
+        id, std::move(fluct), std::move(msc), std::move(woodcock));
 }
 
 //---------------------------------------------------------------------------//
@@ -62,12 +65,16 @@ AlongStepGeneralLinearAction::from_params(ActionId              id,
  * Construct with next action ID and optional energy loss parameters.
  */
 AlongStepGeneralLinearAction::AlongStepGeneralLinearAction(
-    ActionId id, SPConstFluctuations fluct, SPConstMsc msc)
+    ActionId            id,
+    SPConstFluctuations fluct,
+    SPConstMsc          msc,
+    SPConstWoodcock     woodcock)
     : id_(id)
     , fluct_(std::move(fluct))
     , msc_(std::move(msc))
-    , host_data_(fluct_, msc_)
-    , device_data_(fluct_, msc_)
+    , woodcock_(std::move(woodcock))
+    , host_data_(fluct_, msc_, woodcock_)
+    , device_data_(fluct_, msc_, woodcock_)
 {
     CELER_EXPECT(id_);
 }
@@ -87,15 +94,13 @@ void AlongStepGeneralLinearAction::execute(CoreHostRef const& data) const
     MultiExceptionHandler capture_exception;
     auto launch = make_along_step_launcher(data,
                                            host_data_.msc,
-                                           NoData{},
+                                           host_data_.woodcock,
                                            host_data_.fluct,
                                            detail::along_step_general_linear);
 
-#pragma omp parallel for
-    for (size_type i = 0; i < data.states.size(); ++i)
-    {
-        CELER_TRY_ELSE(launch(ThreadId{i}), capture_exception);
-    }
+    launch_host_tracks(data, [&](ThreadId tid) {
+        CELER_TRY_ELSE(launch(tid), capture_exception);
+    });
     log_and_rethrow(std::move(capture_exception));
 }
 
@@ -105,7 +110,9 @@ void AlongStepGeneralLinearAction::execute(CoreHostRef const& data) const
  */
 template<MemSpace M>
 AlongStepGeneralLinearAction::ExternalRefs<M>::ExternalRefs(
-    const SPConstFluctuations& fluct_params, const SPConstMsc& msc_params)
+    const SPConstFluctuations& fluct_params,
+    const SPConstMsc&          msc_params,
+    const SPConstWoodcock&     woodcock_params)
 {
     if (M == MemSpace::device && !celeritas::device())
     {
@@ -121,6 +128,10 @@ AlongStepGeneralLinearAction::ExternalRefs<M>::ExternalRefs(
     {
         msc = get_ref<M>(*msc_params);
     }
+    if (woodcock_params)
+    {
+        woodcock = get_ref<M>(*woodcock_params);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -21,10 +21,11 @@ namespace celeritas
 namespace
 {
 //---------------------------------------------------------------------------//
-__global__ void
-along_step_general_linear_kernel(CoreRef<MemSpace::device> const   track_data,
-                                 DeviceCRef<UrbanMscData> const    msc_data,
-                                 DeviceCRef<FluctuationData> const fluct)
+__global__ void along_step_general_linear_kernel(
+    CoreRef<MemSpace::device> const      track_data,
+    DeviceCRef<UrbanMscData> const       msc_data,
+    DeviceCRef<WoodcockParamsData> const woodcock,
+    DeviceCRef<FluctuationData> const    fluct)
 {
     auto tid = KernelParamCalculator::thread_id();
     if (!(tid < track_data.states.size()))
@@ -32,7 +33,7 @@ along_step_general_linear_kernel(CoreRef<MemSpace::device> const   track_data,
 
     auto launch = make_along_step_launcher(track_data,
                                            msc_data,
-                                           NoData{},
+                                           woodcock,
                                            fluct,
                                            detail::along_step_general_linear);
     launch(tid);
@@ -52,6 +53,7 @@ void AlongStepGeneralLinearAction::execute(const CoreDeviceRef& data) const
                         data.states.size(),
                         data,
                         device_data_.msc,
+                        device_data_.woodcock,
                         device_data_.fluct);
 }
 
@@ -14,6 +14,7 @@
 #include "celeritas/Types.hh"
 #include "celeritas/em/data/FluctuationData.hh"
 #include "celeritas/em/data/UrbanMscData.hh"
+#include "celeritas/geo/WoodcockData.hh"
 #include "celeritas/global/ActionInterface.hh"
 
 namespace celeritas
@@ -24,6 +25,7 @@ class FluctuationParams;
 class PhysicsParams;
 class MaterialParams;
 class ParticleParams;
+class WoodcockParams;
 
 //---------------------------------------------------------------------------//
 /*!
@@ -31,15 +33,17 @@ class ParticleParams;
  *
  * This kernel is for problems without EM fields, for particle types that may
  * have (but do not *need* to have) along-step energy loss, optional energy
- * fluctuation, and optional multiple scattering.
+ * fluctuation, and optional multiple scattering. Neutral particles can
+ * optionally use Woodcock tracking inside user-selected volume regions.
  */
-class AlongStepGeneralLinearAction final : public ExplicitActionInterface
+class AlongStepGeneralLinearAction final : public FusibleActionInterface
 {
   public:
     //!@{
     //! \name Type aliases
     using SPConstFluctuations = std::shared_ptr<const FluctuationParams>;
     using SPConstMsc          = std::shared_ptr<const UrbanMscModel>;
+    using SPConstWoodcock     = std::shared_ptr<const WoodcockParams>;
     //!@}
 
   public:
@@ -48,12 +52,15 @@ class AlongStepGeneralLinearAction final : public ExplicitActionInterface
                 const MaterialParams& materials,
                 const ParticleParams& particles,
                 const PhysicsParams&  physics,
-                bool                  eloss_fluctuation);
+                bool                  eloss_fluctuation,
+                SPConstWoodcock       woodcock = {});
 
-    // Construct with next action ID, and optional EM energy fluctuation
+    // Construct with next action ID, optional EM energy fluctuation, MSC, and
+    // Woodcock tracking regions
     AlongStepGeneralLinearAction(ActionId            id,
                                  SPConstFluctuations fluct,
-                                 SPConstMsc          msc);
+                                 SPConstMsc          msc,
+                                 SPConstWoodcock     woodcock = {});
 
     // Default destructor
     ~AlongStepGeneralLinearAction();
@@ -87,21 +94,27 @@ class AlongStepGeneralLinearAction final : public ExplicitActionInterface
     //! Whether MSC is in use
     bool has_msc() const { return static_cast<bool>(msc_); }
 
+    //! Whether Woodcock tracking is in use
+    bool has_woodcock() const { return static_cast<bool>(woodcock_); }
+
   private:
     ActionId            id_;
     SPConstFluctuations fluct_;
     SPConstMsc          msc_;
+    SPConstWoodcock     woodcock_;
 
-    // TODO: kind of hacky way to support fluct/msc being optional
+    // TODO: kind of hacky way to support fluct/msc/woodcock being optional
     // (required because we have to pass "empty" refs if they're missing)
     template<MemSpace M>
     struct ExternalRefs
     {
-        FluctuationData<Ownership::const_reference, M> fluct;
-        UrbanMscData<Ownership::const_reference, M>    msc;
+        FluctuationData<Ownership::const_reference, M>    fluct;
+        UrbanMscData<Ownership::const_reference, M>       msc;
+        WoodcockParamsData<Ownership::const_reference, M> woodcock;
 
         ExternalRefs(const SPConstFluctuations& fluct_params,
-                     const SPConstMsc&          msc_params);
+                     const SPConstMsc&          msc_params,
+                     const SPConstWoodcock&     woodcock_params);
     };
 
     ExternalRefs<MemSpace::host>   host_data_;
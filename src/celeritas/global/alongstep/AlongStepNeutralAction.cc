@@ -9,25 +9,43 @@
 
 #include "corecel/Assert.hh"
 #include "corecel/Types.hh"
+#include "corecel/sys/Device.hh"
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
+#include "celeritas/geo/WoodcockParams.hh"
 #include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/global/HostLauncher.hh"
 #include "celeritas/global/alongstep/detail/AlongStepLauncherImpl.hh"
 
 #include "AlongStepLauncher.hh"
-#include "detail/AlongStepNeutral.hh"
+#include "detail/AlongStepWoodcock.hh"
 
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
- * Construct with next action ID.
+ * Construct with next action ID and optional Woodcock tracking regions.
  */
-AlongStepNeutralAction::AlongStepNeutralAction(ActionId id) : id_(id)
+AlongStepNeutralAction::AlongStepNeutralAction(ActionId        id,
+                                               SPConstWoodcock woodcock)
+    : id_(id), woodcock_(std::move(woodcock))
 {
     CELER_EXPECT(id_);
+
+    if (woodcock_)
+    {
+        host_woodcock_ = woodcock_->host_ref();
+        if (celeritas::device())
+        {
+            device_woodcock_ = woodcock_->device_ref();
+        }
+    }
 }
 
+//---------------------------------------------------------------------------//
+//! Default destructor
+AlongStepNeutralAction::~AlongStepNeutralAction() = default;
+
 //---------------------------------------------------------------------------//
 /*!
  * Launch the along-step action on host.
@@ -37,13 +55,14 @@ void AlongStepNeutralAction::execute(CoreHostRef const& data) const
     CELER_EXPECT(data);
 
     MultiExceptionHandler capture_exception;
-    auto launch = make_along_step_launcher(
-        data, NoData{}, NoData{}, NoData{}, detail::along_step_neutral);
-#pragma omp parallel for
-    for (size_type i = 0; i < data.states.size(); ++i)
-    {
-        CELER_TRY_ELSE(launch(ThreadId{i}), capture_exception);
-    }
+    auto launch = make_along_step_launcher(data,
+                                           NoData{},
+                                           host_woodcock_,
+                                           NoData{},
+                                           detail::along_step_neutral_woodcock);
+    launch_host_tracks(data, [&](ThreadId tid) {
+        CELER_TRY_ELSE(launch(tid), capture_exception);
+    });
     log_and_rethrow(std::move(capture_exception));
 }
 
@@ -14,21 +14,26 @@
 #include "corecel/sys/KernelParamCalculator.device.hh"
 
 #include "AlongStepLauncher.hh"
-#include "detail/AlongStepNeutral.hh"
+#include "detail/AlongStepWoodcock.hh"
 
 namespace celeritas
 {
 namespace
 {
 //---------------------------------------------------------------------------//
-__global__ void along_step_neutral_kernel(CoreDeviceRef const data)
+__global__ void
+along_step_neutral_kernel(CoreDeviceRef const                  data,
+                          DeviceCRef<WoodcockParamsData> const woodcock)
 {
     auto tid = KernelParamCalculator::thread_id();
     if (!(tid < data.states.size()))
         return;
 
-    auto launch = make_along_step_launcher(
-        data, NoData{}, NoData{}, NoData{}, detail::along_step_neutral);
+    auto launch = make_along_step_launcher(data,
+                                           NoData{},
+                                           woodcock,
+                                           NoData{},
+                                           detail::along_step_neutral_woodcock);
     launch(tid);
 }
 //---------------------------------------------------------------------------//
@@ -44,7 +49,8 @@ void AlongStepNeutralAction::execute(const CoreDeviceRef& data) const
     CELER_LAUNCH_KERNEL(along_step_neutral,
                         celeritas::device().default_block_size(),
                         data.states.size(),
-                        data);
+                        data,
+                        device_woodcock_);
 }
 
 //---------------------------------------------------------------------------//
@@ -7,24 +7,40 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <memory>
+
 #include "corecel/Assert.hh"
 #include "celeritas/Types.hh"
+#include "celeritas/geo/WoodcockData.hh"
 #include "celeritas/global/ActionInterface.hh"
 
 namespace celeritas
 {
+class WoodcockParams;
+
 //---------------------------------------------------------------------------//
 /*!
  * Along-step kernel for particles without fields or energy loss.
  *
  * This should only be used for testing and demonstration purposes because real
- * EM physics always has continuous energy loss for charged particles.
+ * EM physics always has continuous energy loss for charged particles. Neutral
+ * particles can optionally use Woodcock tracking inside user-selected volume
+ * regions.
  */
-class AlongStepNeutralAction final : public ExplicitActionInterface
+class AlongStepNeutralAction final : public FusibleActionInterface
 {
   public:
-    // Construct with next action ID
-    explicit AlongStepNeutralAction(ActionId id);
+    //!@{
+    //! \name Type aliases
+    using SPConstWoodcock = std::shared_ptr<const WoodcockParams>;
+    //!@}
+
+  public:
+    // Construct with next action ID and optional Woodcock tracking regions
+    explicit AlongStepNeutralAction(ActionId id, SPConstWoodcock woodcock = {});
+
+    // Default destructor
+    ~AlongStepNeutralAction();
 
     // Launch kernel with host data
     void execute(CoreHostRef const&) const final;
@@ -47,8 +63,14 @@ class AlongStepNeutralAction final : public ExplicitActionInterface
     //! Dependency ordering of the action
     ActionOrder order() const final { return ActionOrder::along; }
 
+    //! Whether Woodcock tracking is in use
+    bool has_woodcock() const { return static_cast<bool>(woodcock_); }
+
   private:
-    ActionId id_;
+    ActionId                       id_;
+    SPConstWoodcock                woodcock_;
+    HostCRef<WoodcockParamsData>   host_woodcock_;
+    DeviceCRef<WoodcockParamsData> device_woodcock_;
 };
 
 //---------------------------------------------------------------------------//
@@ -14,6 +14,7 @@
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/em/model/UrbanMscModel.hh"
 #include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/global/HostLauncher.hh"
 #include "celeritas/global/alongstep/detail/AlongStepLauncherImpl.hh"
 #include "celeritas/phys/PhysicsParams.hh"
 
@@ -82,11 +83,9 @@ void AlongStepUniformMscAction::execute(CoreHostRef const& data) const
                                            NoData{},
                                            detail::along_step_uniform_msc);
 
-#pragma omp parallel for
-    for (size_type i = 0; i < data.states.size(); ++i)
-    {
-        CELER_TRY_ELSE(launch(ThreadId{i}), capture_exception);
-    }
+    launch_host_tracks(data, [&](ThreadId tid) {
+        CELER_TRY_ELSE(launch(tid), capture_exception);
+    });
     log_and_rethrow(std::move(capture_exception));
 }
 
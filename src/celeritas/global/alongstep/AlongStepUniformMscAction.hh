@@ -27,7 +27,7 @@ class ParticleParams;
 /*!
  * Along-step kernel with optional MSC and uniform magnetic field.
  */
-class AlongStepUniformMscAction final : public ExplicitActionInterface
+class AlongStepUniformMscAction final : public FusibleActionInterface
 {
   public:
     //!@{
@@ -11,6 +11,7 @@
 #include "celeritas/em/data/UrbanMscData.hh"
 
 #include "AlongStepNeutral.hh"
+#include "AlongStepWoodcock.hh"
 #include "EnergyLossFluctApplier.hh"
 #include "UrbanMsc.hh"
 
@@ -21,13 +22,22 @@ namespace detail
 //---------------------------------------------------------------------------//
 /*!
  * Implementation of the "along step" action with MSC and eloss fluctuation.
+ *
+ * Neutral particles in a Woodcock tracking region (if any are defined) are
+ * instead moved through the region's internal boundaries using a majorant
+ * cross section.
  */
 inline CELER_FUNCTION void
-along_step_general_linear(const NativeCRef<UrbanMscData>& msc,
-                          NoData,
-                          const NativeCRef<FluctuationData>& fluct,
-                          CoreTrackView const&               track)
+along_step_general_linear(const NativeCRef<UrbanMscData>&       msc,
+                          const NativeCRef<WoodcockParamsData>& woodcock,
+                          const NativeCRef<FluctuationData>&    fluct,
+                          CoreTrackView const&                  track)
 {
+    if (woodcock && apply_woodcock_majorant(woodcock, track))
+    {
+        return along_step_woodcock(woodcock, track);
+    }
+
     return along_step(UrbanMsc{msc},
                       LinearPropagatorFactory{},
                       EnergyLossFluctApplier{fluct},
@@ -0,0 +1,159 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/alongstep/detail/AlongStepWoodcock.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/math/Algorithms.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/geo/WoodcockData.hh"
+#include "celeritas/global/CoreTrackView.hh"
+#include "celeritas/global/alongstep/AlongStep.hh"
+#include "celeritas/grid/EnergyGridLocator.hh"
+
+#include "AlongStepNeutral.hh"
+#include "WoodcockPropagator.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Replace the physics step limit with one sampled from a majorant.
+ *
+ * This applies to neutral particles in a Woodcock tracking region that are
+ * moving toward a discrete interaction. The cross section of each process is
+ * bounded by its largest value in any material of the region: since neutral
+ * particles don't lose energy along the step, evaluating the cross sections
+ * at the pre-step energy gives a majorant that is exact everywhere in the
+ * region. The pre-step cross sections in the current material are reused.
+ *
+ * \return Whether Woodcock tracking applies to the step
+ */
+inline CELER_FUNCTION bool
+apply_woodcock_majorant(const NativeCRef<WoodcockParamsData>& woodcock,
+                        CoreTrackView const&                  track)
+{
+    auto      sim   = track.make_sim_view();
+    StepLimit limit = sim.step_limit();
+    if (limit.step == 0)
+    {
+        // Stopped or retrying a failed interaction
+        return false;
+    }
+
+    auto particle = track.make_particle_view();
+    if (particle.charge() != zero_quantity())
+    {
+        return false;
+    }
+
+    WoodcockRegionId region
+        = woodcock.volume_region[track.make_geo_view().volume_id()];
+    if (!region)
+    {
+        return false;
+    }
+
+    // Bound the cross section of each process over the region's materials
+    auto       phys     = track.make_physics_view();
+    auto       step     = track.make_physics_step_view();
+    MaterialId cur_mat  = track.make_material_view().material_id();
+    auto       num_ppid = ParticleProcessId{phys.num_particle_processes()};
+    EnergyGridLocator locate(particle.energy());
+    for (MaterialId mat_id :
+         woodcock.materials[woodcock.regions[region].materials])
+    {
+        if (mat_id == cur_mat)
+        {
+            continue;
+        }
+        auto mat_phys = track.make_physics_view(mat_id);
+        auto mat_view = track.make_material_view(mat_id);
+        for (auto ppid : range(num_ppid))
+        {
+            real_type& xs = step.per_process_xs(ppid);
+            xs = max(xs, mat_phys.calc_xs(ppid, mat_view, locate));
+        }
+    }
+
+    real_type total_xs = 0;
+    for (auto ppid : range(num_ppid))
+    {
+        total_xs += step.per_process_xs(ppid);
+    }
+    CELER_ASSERT(total_xs >= step.macro_xs());
+    if (total_xs == 0)
+    {
+        // No interaction is possible anywhere in the region
+        return false;
+    }
+    step.macro_xs(total_xs);
+    step.majorant_xs(true);
+
+    // Sample the distance to a real or virtual collision
+    CELER_ASSERT(!limit || limit.action == phys.scalars().discrete_action());
+    limit.step   = phys.interaction_mfp() / total_xs;
+    limit.action = phys.scalars().discrete_action();
+    sim.force_step_limit(limit);
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Implementation of the along-step action with Woodcock tracking.
+ *
+ * This must be called after \c apply_woodcock_majorant has succeeded. The
+ * collision at the end of the step is "virtual" unless accepted by the
+ * discrete select action.
+ */
+inline CELER_FUNCTION void
+along_step_woodcock(const NativeCRef<WoodcockParamsData>& woodcock,
+                    CoreTrackView const&                  track)
+{
+    along_step(
+        NoMsc{},
+        [&woodcock, &track](const ParticleTrackView&, GeoTrackView* geo) {
+            return WoodcockPropagator{woodcock, track, geo};
+        },
+        NoElossApplier{},
+        track);
+
+    if (track.make_geo_view().is_outside())
+    {
+        // Left the world while crossing region boundaries
+        auto sim = track.make_sim_view();
+        sim.status(TrackStatus::killed);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Implementation of the neutral along-step action with optional Woodcock
+ * tracking.
+ */
+inline CELER_FUNCTION void
+along_step_neutral_woodcock(NoData,
+                            const NativeCRef<WoodcockParamsData>& woodcock,
+                            NoData,
+                            CoreTrackView const&                  track)
+{
+    if (woodcock && apply_woodcock_majorant(woodcock, track))
+    {
+        return along_step_woodcock(woodcock, track);
+    }
+
+    return along_step_neutral(NoData{}, NoData{}, NoData{}, track);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
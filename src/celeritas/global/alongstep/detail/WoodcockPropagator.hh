@@ -0,0 +1,123 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/alongstep/detail/WoodcockPropagator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/math/Algorithms.hh"
+#include "celeritas/field/LinearPropagator.hh"
+#include "celeritas/geo/GeoTrackView.hh"
+#include "celeritas/geo/WoodcockData.hh"
+#include "celeritas/global/CoreTrackView.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Move a neutral track in a straight line through a Woodcock region.
+ *
+ * Boundaries between volumes of the track's current region are crossed
+ * without stopping, and the track's material is updated after each crossing.
+ * If the track crosses into a volume outside the region (or outside the
+ * world), propagation ends on the far side of that boundary: the returned
+ * distance is then shorter than requested, but the result is not flagged as a
+ * boundary because the crossing has already taken place.
+ */
+class WoodcockPropagator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using result_type = Propagation;
+    using WoodcockRef = NativeCRef<WoodcockParamsData>;
+    //!@}
+
+  public:
+    // Construct from region data, track, and geometry
+    inline CELER_FUNCTION WoodcockPropagator(const WoodcockRef&   woodcock,
+                                             const CoreTrackView& track,
+                                             GeoTrackView*        geo);
+
+    // Move track up to a user-provided distance, up to the region boundary
+    inline CELER_FUNCTION result_type operator()(real_type dist);
+
+  private:
+    const WoodcockRef&   woodcock_;
+    const CoreTrackView& track_;
+    GeoTrackView&        geo_;
+    WoodcockRegionId     region_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from region data, track, and geometry.
+ */
+CELER_FUNCTION
+WoodcockPropagator::WoodcockPropagator(const WoodcockRef&   woodcock,
+                                       const CoreTrackView& track,
+                                       GeoTrackView*        geo)
+    : woodcock_(woodcock), track_(track), geo_(*geo)
+{
+    CELER_EXPECT(geo);
+    CELER_EXPECT(!geo_.is_outside());
+    region_ = woodcock_.volume_region[geo_.volume_id()];
+    CELER_ENSURE(region_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move track up to a user-provided distance, up to the region boundary.
+ */
+CELER_FUNCTION auto WoodcockPropagator::operator()(real_type dist)
+    -> result_type
+{
+    CELER_EXPECT(dist > 0);
+
+    result_type      result;
+    LinearPropagator propagate(&geo_);
+    do
+    {
+        Propagation p = propagate(dist - result.distance);
+        if (!p.boundary)
+        {
+            // Reached the collision site
+            result.distance = dist;
+            return result;
+        }
+        result.distance += p.distance;
+
+        // Cross into the next volume and update the material
+        geo_.cross_boundary();
+        if (geo_.is_outside())
+        {
+            break;
+        }
+        VolumeId   volume = geo_.volume_id();
+        MaterialId mat_id
+            = track_.make_geo_material_view().material_id(volume);
+        CELER_ASSERT(mat_id);
+        auto mat = track_.make_material_view();
+        mat      = {mat_id};
+        if (woodcock_.volume_region[volume] != region_)
+        {
+            break;
+        }
+    } while (result.distance < dist);
+
+    result.distance = min(result.distance, dist);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -13,9 +13,14 @@
 #include "corecel/device_runtime_api.h"
 #include "corecel/cont/EnumArray.hh"
 #include "corecel/cont/Range.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/Stopwatch.hh"
+#include "corecel/sys/ThreadId.hh"
+#include "corecel/sys/ThreadPool.hh"
 
 #include "../ActionRegistry.hh"
+#include "../CoreTrackData.hh"
 
 namespace celeritas
 {
@@ -62,6 +67,25 @@ ActionSequence::ActionSequence(const ActionRegistry& reg, Options options)
                          < std::make_tuple(b->order(), b->action_id());
               });
 
+    // Group actions for execution: consecutive fusible actions are grouped if
+    // fusion is enabled
+    bool fusible_group = false;
+    for (auto i : range<size_type>(actions_.size()))
+    {
+        bool fusible = this->fused()
+                       && dynamic_cast<const FusibleActionInterface*>(
+                           actions_[i].get());
+        if (fusible && fusible_group)
+        {
+            groups_.back() = {groups_.back().front(), i + 1};
+        }
+        else
+        {
+            groups_.push_back({i, i + 1});
+        }
+        fusible_group = fusible;
+    }
+
     // Initialize timing
     accum_time_.resize(actions_.size());
 
@@ -70,9 +94,10 @@ ActionSequence::ActionSequence(const ActionRegistry& reg, Options options)
 
 //---------------------------------------------------------------------------//
 /*!
- * Call the given action ID with host or device data.
+ * Call all actions with host or device data.
  *
- * The given action ID \em must be an explicit action.
+ * When host actions are fused, the elapsed time of each fused group is
+ * attributed to the first action in the group.
  */
 template<MemSpace M>
 void ActionSequence::execute(const CoreRef<M>& data)
@@ -80,15 +105,22 @@ void ActionSequence::execute(const CoreRef<M>& data)
     if (M == MemSpace::host || options_.sync)
     {
         // Execute all actions and record the time elapsed
-        for (auto i : range(actions_.size()))
+        for (RangeAction group : groups_)
         {
             Stopwatch get_time;
-            actions_[i]->execute(data);
+            if (group.size() == 1)
+            {
+                actions_[group.front()]->execute(data);
+            }
+            else
+            {
+                this->execute_fused(group, data);
+            }
             if (M == MemSpace::device)
             {
                 CELER_DEVICE_CALL_PREFIX(DeviceSynchronize());
             }
-            accum_time_[i] += get_time();
+            accum_time_[group.front()] += get_time();
         }
     }
     else
@@ -101,6 +133,67 @@ void ActionSequence::execute(const CoreRef<M>& data)
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Execute a run of fusible actions on chunks of track slots.
+ *
+ * Each chunk is a unit of parallel work, so the chunks are scheduled
+ * dynamically rather than in large blocks.
+ */
+void ActionSequence::execute_fused(RangeAction                    group,
+                                   const CoreRef<MemSpace::host>& data)
+{
+    CELER_EXPECT(data.fused_slots.empty());
+
+    const size_type num_slots  = data.states.size();
+    const size_type chunk_size = options_.fused_chunk_size;
+    const size_type num_chunks = ceil_div(num_slots, chunk_size);
+
+    MultiExceptionHandler capture_exception;
+    auto                  execute_chunk = [&](size_type chunk) {
+        CoreRef<MemSpace::host> chunk_data = data;
+        size_type               begin      = chunk * chunk_size;
+        chunk_data.fused_slots
+            = {ThreadId{begin},
+               ThreadId{celeritas::min(begin + chunk_size, num_slots)}};
+        for (auto i : group)
+        {
+            actions_[i]->execute(chunk_data);
+        }
+    };
+
+    if (data.thread_pool)
+    {
+        data.thread_pool->parallel_for(num_chunks, 1, [&](size_type chunk) {
+            CELER_TRY_ELSE(execute_chunk(chunk), capture_exception);
+        });
+    }
+    else
+    {
+#pragma omp parallel for schedule(dynamic)
+        for (size_type chunk = 0; chunk < num_chunks; ++chunk)
+        {
+            CELER_TRY_ELSE(execute_chunk(chunk), capture_exception);
+        }
+    }
+    log_and_rethrow(std::move(capture_exception));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute a run of fusible actions with device data.
+ *
+ * Fusion is only implemented on host, so the actions are launched in order.
+ */
+void ActionSequence::execute_fused(RangeAction                      group,
+                                   const CoreRef<MemSpace::device>& data)
+{
+    for (auto i : group)
+    {
+        actions_[i]->execute(data);
+    }
+}
+
 //---------------------------------------------------------------------------//
 // Explicit template instantiation
 //---------------------------------------------------------------------------//
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
 
 #include "../ActionInterface.hh"
 #include "../CoreTrackDataFwd.hh"
@@ -25,6 +26,14 @@ namespace detail
 //---------------------------------------------------------------------------//
 /*!
  * Sequence of explicit actions to invoke as part of a single step.
+ *
+ * If \c fused_chunk_size is nonzero, host execution fuses each run of
+ * consecutive \c FusibleActionInterface actions: the track slots are divided
+ * into chunks, and all the actions in the run are executed on one chunk
+ * before moving on to the next. Chunks are executed in parallel. Actions that
+ * are not fusible (such as user diagnostics) are executed on all track slots
+ * between the fused runs, so the action ordering is the same as unfused
+ * execution.
  */
 class ActionSequence
 {
@@ -39,7 +48,8 @@ class ActionSequence
     //! Construction/execution options
     struct Options
     {
-        bool sync{false}; //!< Call DeviceSynchronize and add timer
+        bool      sync{false}; //!< Call DeviceSynchronize and add timer
+        size_type fused_chunk_size{0}; //!< Track slots per fused host chunk
     };
 
   public:
@@ -69,10 +79,20 @@ class ActionSequence
     //! Get the corresponding accumulated time, if 'sync' or host called
     const VecDouble& accum_time() const { return accum_time_; }
 
+    //! Whether host actions are fused
+    bool fused() const { return options_.fused_chunk_size > 0; }
+
   private:
-    Options   options_;
-    VecAction actions_;
-    VecDouble accum_time_;
+    using RangeAction = Range<size_type>;
+
+    Options                  options_;
+    VecAction                actions_;
+    VecDouble                accum_time_;
+    std::vector<RangeAction> groups_;
+
+    // Execute a run of fusible actions on chunks of track slots
+    void execute_fused(RangeAction group, const CoreRef<MemSpace::host>& data);
+    void execute_fused(RangeAction, const CoreRef<MemSpace::device>&);
 };
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,155 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/detail/ReorderTracks.cc
+//---------------------------------------------------------------------------//
+#include "ReorderTracks.hh"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "corecel/cont/Span.hh"
+#include "celeritas/global/StepScratchArena.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Get temporary host memory from the step's scratch space if available.
+ */
+template<class T>
+Span<T> allocate_temp(StepScratchArena<MemSpace::host>* scratch,
+                      std::vector<T>*                   storage,
+                      size_type                         count)
+{
+    if (scratch)
+    {
+        return scratch->template allocate<T>(count);
+    }
+    storage->resize(count);
+    return make_span(*storage);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Gather per-track items into their new order.
+ *
+ * A single temporary buffer, large enough for the largest per-track
+ * collection, is reused for every collection so that the reordering needs only
+ * a small fraction of the state's memory.
+ */
+class TrackGatherer
+{
+  public:
+    //! Construct with the old track slot of each new track slot
+    TrackGatherer(Span<const size_type> order, Span<Byte> buffer)
+        : order_(order), buffer_(buffer)
+    {
+    }
+
+    //! Permute each block of per-track items
+    template<class T>
+    void operator()(Span<T> items) const
+    {
+        const size_type num_tracks = order_.size();
+        CELER_EXPECT(items.size() % num_tracks == 0);
+        CELER_EXPECT(items.size() * sizeof(T) <= buffer_.size());
+
+        T* temp = reinterpret_cast<T*>(buffer_.data());
+        std::copy(items.begin(), items.end(), temp);
+
+        for (size_type start = 0; start < items.size(); start += num_tracks)
+        {
+#pragma omp parallel for
+            for (size_type i = 0; i < num_tracks; ++i)
+            {
+                items[start + i] = temp[start + order_[i]];
+            }
+        }
+    }
+
+  private:
+    Span<const size_type> order_;
+    Span<Byte>            buffer_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sort track slots by particle type, material, and energy.
+ *
+ * This is a stable sort on the key from \c calc_reorder_key , applied to
+ * every persistent per-track state. Vacant slots are moved to the back, so
+ * the vacancies are rewritten to be the last slots. It must be called between
+ * initializing tracks and the first action of the step, when no scratch data
+ * is live and the only track slots that are indexed are the vacancies.
+ */
+ReorderResult reorder_tracks(CoreRef<MemSpace::host>& core_data)
+{
+    CELER_EXPECT(core_data);
+
+    const auto&     states = core_data.states;
+    const size_type size   = states.size();
+
+    std::vector<ReorderKey> key_storage;
+    std::vector<size_type>  order_storage;
+    Span<ReorderKey>        keys
+        = allocate_temp(core_data.scratch, &key_storage, size);
+    Span<size_type> order
+        = allocate_temp(core_data.scratch, &order_storage, size);
+
+#pragma omp parallel for
+    for (size_type i = 0; i < size; ++i)
+    {
+        ThreadId tid{i};
+        keys[i] = calc_reorder_key(states.sim.state[tid],
+                                   states.particles.state[tid],
+                                   states.materials.state[tid]);
+    }
+
+    std::iota(order.begin(), order.end(), size_type(0));
+    std::stable_sort(
+        order.begin(), order.end(), [&keys](size_type left, size_type right) {
+            return keys[left] < keys[right];
+        });
+
+    ReorderResult result;
+    for (auto i : range(size_type(1), size))
+    {
+        result.mixed_before += is_mixed(keys[i - 1], keys[i]);
+        result.mixed_after += is_mixed(keys[order[i - 1]], keys[order[i]]);
+    }
+
+    auto vacancies = core_data.states.init.vacancies.data();
+    CELER_ASSERT(static_cast<size_type>(std::count_if(
+                     keys.begin(),
+                     keys.end(),
+                     [](ReorderKey key) { return key >> 63; }))
+                 == vacancies.size());
+    if (std::is_sorted(keys.begin(), keys.end()))
+    {
+        // Tracks and vacancies are already in order
+        return result;
+    }
+
+    std::vector<Byte> buffer_storage;
+    Span<Byte>        buffer = allocate_temp(
+        core_data.scratch, &buffer_storage, max_track_span_bytes(states));
+    for_each_track_span(states, TrackGatherer{order, buffer});
+    std::iota(vacancies.begin(), vacancies.end(), size - vacancies.size());
+
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
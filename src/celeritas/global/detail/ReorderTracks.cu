@@ -0,0 +1,204 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/detail/ReorderTracks.cu
+//---------------------------------------------------------------------------//
+#include "ReorderTracks.hh"
+
+#include <thrust/copy.h>
+#include <thrust/device_ptr.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/inner_product.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include "corecel/device_runtime_api.h"
+#include "corecel/Assert.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/sys/Device.hh"
+#include "corecel/sys/KernelParamCalculator.device.hh"
+#include "celeritas/global/StepScratchArena.hh"
+
+#include "ThrustScratchPolicy.device.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// KERNELS
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the reordering key of each track slot.
+ */
+__global__ void calc_keys_kernel(DeviceRef<SimStateData> const      sim,
+                                 DeviceRef<ParticleStateData> const particles,
+                                 DeviceRef<MaterialStateData> const materials,
+                                 Span<ReorderKey> const             keys)
+{
+    auto tid = KernelParamCalculator::thread_id();
+    if (!(tid < sim.size()))
+        return;
+
+    keys[tid.unchecked_get()] = calc_reorder_key(
+        sim.state[tid], particles.state[tid], materials.state[tid]);
+}
+
+//---------------------------------------------------------------------------//
+// HELPER CLASSES
+//---------------------------------------------------------------------------//
+//! Count adjacent occupied slots that use different tables
+struct MixedCounter
+{
+    CELER_FUNCTION size_type operator()(ReorderKey left,
+                                        ReorderKey right) const
+    {
+        return is_mixed(left, right);
+    }
+};
+
+template<class T>
+using DeviceVal = Collection<T, Ownership::value, MemSpace::device>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get temporary device memory from the step's scratch space if available.
+ */
+template<class T>
+Span<T> allocate_temp(StepScratchArena<MemSpace::device>* scratch,
+                      DeviceVal<T>*                       storage,
+                      size_type                           count)
+{
+    if (scratch)
+    {
+        return scratch->template allocate<T>(count);
+    }
+    resize(storage, count);
+    return (*storage)[AllItems<T, MemSpace::device>{}];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Gather per-track items into their new order.
+ *
+ * A single temporary buffer, large enough for the largest per-track
+ * collection, is reused for every collection.
+ */
+class TrackGatherer
+{
+  public:
+    //! Construct with the old track slot of each new track slot
+    TrackGatherer(Span<const size_type> order, Span<Byte> buffer)
+        : order_(order), buffer_(buffer)
+    {
+    }
+
+    //! Permute each block of per-track items
+    template<class T>
+    void operator()(Span<T> items) const
+    {
+        const size_type num_tracks = order_.size();
+        CELER_EXPECT(items.size() % num_tracks == 0);
+        CELER_EXPECT(items.size() * sizeof(T) <= buffer_.size());
+
+        auto items_ptr = thrust::device_pointer_cast(items.data());
+        auto temp_ptr
+            = thrust::device_pointer_cast(reinterpret_cast<T*>(buffer_.data()));
+        auto order_ptr = thrust::device_pointer_cast(order_.data());
+        thrust::copy(
+            thrust::device, items_ptr, items_ptr + items.size(), temp_ptr);
+        for (size_type start = 0; start < items.size(); start += num_tracks)
+        {
+            thrust::gather(thrust::device,
+                           order_ptr,
+                           order_ptr + num_tracks,
+                           temp_ptr + start,
+                           items_ptr + start);
+        }
+        CELER_DEVICE_CHECK_ERROR();
+    }
+
+  private:
+    Span<const size_type> order_;
+    Span<Byte>            buffer_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sort track slots by particle type, material, and energy.
+ *
+ * The keys are sorted in place along with the track slot ordering, so the
+ * locality afterward is counted from the sorted keys.
+ */
+ReorderResult reorder_tracks(CoreRef<MemSpace::device>& core_data)
+{
+    CELER_EXPECT(core_data);
+
+    const auto&     states = core_data.states;
+    const size_type size   = states.size();
+
+    DeviceVal<ReorderKey> key_storage;
+    DeviceVal<size_type>  order_storage;
+    Span<ReorderKey>      keys
+        = allocate_temp(core_data.scratch, &key_storage, size);
+    Span<size_type> order
+        = allocate_temp(core_data.scratch, &order_storage, size);
+
+    CELER_LAUNCH_KERNEL(calc_keys,
+                        celeritas::device().default_block_size(),
+                        size,
+                        states.sim,
+                        states.particles,
+                        states.materials,
+                        keys);
+
+    auto keys_ptr    = thrust::device_pointer_cast(keys.data());
+    auto order_ptr   = thrust::device_pointer_cast(order.data());
+    auto count_mixed = [&] {
+        return thrust::inner_product(thrust::device,
+                                     keys_ptr,
+                                     keys_ptr + size - 1,
+                                     keys_ptr + 1,
+                                     size_type(0),
+                                     thrust::plus<size_type>(),
+                                     MixedCounter{});
+    };
+
+    ReorderResult result;
+    result.mixed_before = count_mixed();
+    thrust::sequence(thrust::device, order_ptr, order_ptr + size);
+    with_scratch_policy(core_data.scratch, [&](auto const& policy) {
+        return thrust::stable_sort_by_key(
+            policy, keys_ptr, keys_ptr + size, order_ptr);
+    });
+    CELER_DEVICE_CHECK_ERROR();
+    result.mixed_after = count_mixed();
+
+    DeviceVal<Byte> buffer_storage;
+    Span<Byte>      buffer = allocate_temp(
+        core_data.scratch, &buffer_storage, max_track_span_bytes(states));
+    for_each_track_span(states,
+                        TrackGatherer{Span<const size_type>{order}, buffer});
+
+    auto vacancies     = core_data.states.init.vacancies.data();
+    auto vacancies_ptr = thrust::device_pointer_cast(vacancies.data());
+    thrust::sequence(thrust::device,
+                     vacancies_ptr,
+                     vacancies_ptr + vacancies.size(),
+                     size - vacancies.size());
+    CELER_DEVICE_CHECK_ERROR();
+
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,140 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/detail/ReorderTracks.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+#include "celeritas_config.h"
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/math/Algorithms.hh"
+#include "celeritas/global/CoreTrackData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+//! Packed particle type, material, and log energy of a track slot
+using ReorderKey = std::uint64_t;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Locality of the track slots before and after reordering.
+ *
+ * Each count is the number of adjacent pairs of occupied track slots whose
+ * tracks use different physics tables, i.e. have a different particle type or
+ * material.
+ */
+struct ReorderResult
+{
+    size_type mixed_before{};
+    size_type mixed_after{};
+};
+
+//---------------------------------------------------------------------------//
+// Sort track slots by particle type, material, and energy
+ReorderResult reorder_tracks(CoreRef<MemSpace::host>& core_data);
+
+ReorderResult reorder_tracks(CoreRef<MemSpace::device>& core_data);
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the key used to reorder a track slot.
+ *
+ * From the most to least significant bits, the key packs a flag that moves
+ * vacant slots to the back, 23 bits of particle ID, 16 bits of material ID,
+ * and 24 bits of log-energy bin. The energy bins are 1/64 of an e-fold wide,
+ * which is much finer than the spacing of the physics tables, so tracks with
+ * neighboring keys look up neighboring table entries.
+ */
+inline CELER_FUNCTION ReorderKey calc_reorder_key(const SimTrackState& sim,
+                                                  const ParticleTrackState& par,
+                                                  const MaterialTrackState& mat)
+{
+    constexpr ReorderKey vacant_flag  = ReorderKey(1) << 63;
+    constexpr ReorderKey particle_max = (ReorderKey(1) << 23) - 1;
+    constexpr ReorderKey material_max = (ReorderKey(1) << 16) - 1;
+    constexpr real_type  energy_max   = (1 << 24) - 1;
+
+    if (sim.status != TrackStatus::alive)
+    {
+        return vacant_flag;
+    }
+
+    // Bin the log energy, centered on 1 MeV; zero energy maps to bin zero
+    real_type energy_bin = clamp(real_type(64) * std::log(par.energy)
+                                     + real_type(1 << 23),
+                                 real_type(0),
+                                 energy_max);
+
+    return (min<ReorderKey>(par.particle_id.unchecked_get(), particle_max)
+            << 40)
+           | (min<ReorderKey>(mat.material_id.unchecked_get(), material_max)
+              << 24)
+           | static_cast<ReorderKey>(energy_bin);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether adjacent occupied slots use different physics tables.
+ */
+inline CELER_FUNCTION bool is_mixed(ReorderKey left, ReorderKey right)
+{
+    return (left >> 24) != (right >> 24) && !(left >> 63) && !(right >> 63);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a function to spans over the persistent per-track items of all states.
+ *
+ * See \c for_each_track_items for the collections that are visited.
+ */
+template<MemSpace M, class F>
+inline void
+for_each_track_span(const CoreStateData<Ownership::reference, M>& states,
+                    F&&                                           visit)
+{
+    for_each_track_items(states, [&visit](const auto& items) {
+        using T = typename std::decay_t<decltype(items)>::value_type;
+        visit(items[AllItems<T, M>{}]);
+    });
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the size in bytes of the largest per-track collection.
+ */
+template<MemSpace M>
+inline size_type
+max_track_span_bytes(const CoreStateData<Ownership::reference, M>& states)
+{
+    size_type result = 0;
+    for_each_track_span(states, [&result](auto items) {
+        result = std::max<size_type>(result, items.size() * sizeof(items[0]));
+    });
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+#if !CELER_USE_DEVICE
+inline ReorderResult reorder_tracks(CoreRef<MemSpace::device>&)
+{
+    CELER_NOT_CONFIGURED("CUDA or HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,78 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/detail/ThrustScratchPolicy.device.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <thrust/execution_policy.h>
+
+#include "corecel/Assert.hh"
+#include "celeritas/global/StepScratchArena.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Thrust allocator that draws temporary storage from a step scratch arena.
+ *
+ * Deallocation is a null-op: the memory is reclaimed when the arena is reset
+ * at the start of the next step.
+ */
+class ThrustScratchAllocator
+{
+  public:
+    using value_type = char;
+
+    //! Construct with the arena to allocate from
+    explicit ThrustScratchAllocator(StepScratchArena<MemSpace::device>* arena)
+        : arena_(arena)
+    {
+        CELER_EXPECT(arena_);
+    }
+
+    //! Allocate temporary storage
+    char* allocate(std::ptrdiff_t num_bytes)
+    {
+        return reinterpret_cast<char*>(arena_->allocate(num_bytes));
+    }
+
+    //! Memory is released when the arena is reset
+    void deallocate(char*, std::size_t) {}
+
+  private:
+    StepScratchArena<MemSpace::device>* arena_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Call a thrust algorithm with an execution policy using scratch memory.
+ *
+ * If no arena is available (e.g. in unit tests that construct their own core
+ * data), thrust's default temporary allocation is used.
+ *
+ * \code
+    auto end = with_scratch_policy(scratch, [&](auto const& policy) {
+        return thrust::remove_if(policy, first, last, pred);
+    });
+   \endcode
+ */
+template<class F>
+decltype(auto)
+with_scratch_policy(StepScratchArena<MemSpace::device>* arena, F&& func)
+{
+    if (arena)
+    {
+        return func(thrust::device(ThrustScratchAllocator{arena}));
+    }
+    return func(thrust::device);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,117 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/grid/EnergyGridLocator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/math/Quantity.hh"
+
+#include "UniformGrid.hh"
+#include "XsGridData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Cache the log of a particle energy and its location on a log energy grid.
+ *
+ * The cross section, energy loss, and range tables of a particle are
+ * usually tabulated on the same uniform log energy grid. Construct this class
+ * once from the particle energy and pass it to each table lookup: the log of
+ * the energy is calculated only once, and the bin index and bracketing grid
+ * energies of the most recently located grid are reused as long as
+ * subsequent grids have the same spacing.
+ *
+ * \code
+    EnergyGridLocator locate(particle.energy());
+    real_type xs = calc_xs(locate);
+    real_type range = calc_range(locate);
+   \endcode
+ */
+class EnergyGridLocator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using Energy = Quantity<XsGridData::EnergyUnits>;
+    //!@}
+
+    //! Bin on a grid and the energies at its edges
+    struct Bin
+    {
+        size_type index{};
+        real_type lower_energy{};
+        real_type upper_energy{};
+    };
+
+  public:
+    // Construct from the particle energy
+    explicit inline CELER_FUNCTION EnergyGridLocator(Energy energy);
+
+    //! Particle energy
+    CELER_FORCEINLINE_FUNCTION Energy energy() const { return energy_; }
+
+    //! Log of the particle energy
+    CELER_FORCEINLINE_FUNCTION real_type log_energy() const { return loge_; }
+
+    // Find the bin on the given grid (energy *must* be in bounds)
+    inline CELER_FUNCTION const Bin& find(const UniformGrid& loge_grid);
+
+  private:
+    Energy    energy_;
+    real_type loge_;
+
+    // Spacing of the cached grid
+    real_type front_{0};
+    real_type delta_{0};
+    Bin       bin_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from the particle energy.
+ *
+ * A zero energy (e.g. a stopped particle) has a log energy of -infinity,
+ * which is below the lower bound of any grid.
+ */
+CELER_FUNCTION EnergyGridLocator::EnergyGridLocator(Energy energy)
+    : energy_(energy), loge_(std::log(energy.value()))
+{
+    CELER_EXPECT(energy >= zero_quantity());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the bin on the given grid.
+ *
+ * As with \c UniformGrid::find , the energy must be inside the grid bounds.
+ * The bin is recalculated only if the grid spacing differs from the last grid
+ * that was located.
+ */
+CELER_FUNCTION auto EnergyGridLocator::find(const UniformGrid& loge_grid)
+    -> const Bin&
+{
+    if (loge_grid.data().delta != delta_ || loge_grid.front() != front_)
+    {
+        front_            = loge_grid.front();
+        delta_            = loge_grid.data().delta;
+        bin_.index        = loge_grid.find(loge_);
+        bin_.lower_energy = std::exp(loge_grid[bin_.index]);
+        bin_.upper_energy = std::exp(loge_grid[bin_.index + 1]);
+    }
+    CELER_ENSURE(bin_.index + 1 < loge_grid.size());
+    return bin_;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -12,6 +12,7 @@
 #include "corecel/data/Collection.hh"
 #include "corecel/math/Quantity.hh"
 
+#include "EnergyGridLocator.hh"
 #include "Interpolator.hh"
 #include "UniformGrid.hh"
 #include "XsGridData.hh"
@@ -50,6 +51,9 @@ class RangeCalculator
     // Find and interpolate from the energy
     inline CELER_FUNCTION real_type operator()(Energy energy) const;
 
+    // Find and interpolate using a cached energy grid location
+    inline CELER_FUNCTION real_type operator()(EnergyGridLocator& locate) const;
+
   private:
     const XsGridData& data_;
     const Values&     reals_;
@@ -79,9 +83,20 @@ RangeCalculator::RangeCalculator(const XsGridData& grid, const Values& values)
  */
 CELER_FUNCTION real_type RangeCalculator::operator()(Energy energy) const
 {
-    CELER_ASSERT(energy > zero_quantity());
+    EnergyGridLocator locate(energy);
+    return (*this)(locate);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the range using a cached energy grid location.
+ */
+CELER_FUNCTION real_type
+RangeCalculator::operator()(EnergyGridLocator& locate) const
+{
+    CELER_ASSERT(locate.energy() > zero_quantity());
     UniformGrid     loge_grid(data_.log_energy);
-    const real_type loge = std::log(energy.value());
+    const real_type loge = locate.log_energy();
 
     if (loge <= loge_grid.front())
     {
@@ -97,14 +112,13 @@ CELER_FUNCTION real_type RangeCalculator::operator()(Energy energy) const
     }
 
     // Locate the energy bin
-    auto idx = loge_grid.find(loge);
-    CELER_ASSERT(idx + 1 < loge_grid.size());
+    const auto& bin = locate.find(loge_grid);
 
     // Interpolate *linearly* on energy
     LinearInterpolator<real_type> interpolate_xs(
-        {std::exp(loge_grid[idx]), this->get(idx)},
-        {std::exp(loge_grid[idx + 1]), this->get(idx + 1)});
-    return interpolate_xs(energy.value());
+        {bin.lower_energy, this->get(bin.index)},
+        {bin.upper_energy, this->get(bin.index + 1)});
+    return interpolate_xs(locate.energy().value());
 }
 
 //---------------------------------------------------------------------------//
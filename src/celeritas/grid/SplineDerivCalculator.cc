@@ -0,0 +1,92 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/grid/SplineDerivCalculator.cc
+//---------------------------------------------------------------------------//
+#include "SplineDerivCalculator.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the second derivatives.
+ */
+auto SplineDerivCalculator::operator()(SpanConstReal x, SpanConstReal y) const
+    -> VecReal
+{
+    CELER_EXPECT(x.size() >= 2);
+    CELER_EXPECT(y.size() == x.size());
+
+    const size_type num_points = x.size();
+    VecReal         h(num_points - 1);
+    for (auto i : range(h.size()))
+    {
+        h[i] = x[i + 1] - x[i];
+        CELER_ASSERT(h[i] > 0);
+    }
+
+    if (num_points == 2)
+    {
+        return VecReal(num_points, 0);
+    }
+    if (num_points == 3)
+    {
+        // Constant second derivative of the interpolating parabola
+        real_type deriv = 2 * ((y[2] - y[1]) / h[1] - (y[1] - y[0]) / h[0])
+                          / (h[0] + h[1]);
+        return VecReal(num_points, deriv);
+    }
+
+    // Construct the tridiagonal system for the interior points
+    const size_type num_inner = num_points - 2;
+    VecReal         lower(num_inner);
+    VecReal         diag(num_inner);
+    VecReal         upper(num_inner);
+    VecReal         rhs(num_inner);
+    for (auto k : range(num_inner))
+    {
+        const size_type i = k + 1;
+        lower[k]          = h[i - 1];
+        diag[k]           = 2 * (h[i - 1] + h[i]);
+        upper[k]          = h[i];
+        rhs[k] = 6 * ((y[i + 1] - y[i]) / h[i] - (y[i] - y[i - 1]) / h[i - 1]);
+    }
+
+    // Eliminate the end points using the not-a-knot conditions
+    const size_type n = num_points - 1;
+    diag.front() += h[0] * (h[0] + h[1]) / h[1];
+    upper.front() -= h[0] * h[0] / h[1];
+    diag.back() += h[n - 1] * (h[n - 2] + h[n - 1]) / h[n - 2];
+    lower.back() -= h[n - 1] * h[n - 1] / h[n - 2];
+
+    // Forward elimination
+    for (auto k : range<size_type>(1, num_inner))
+    {
+        const real_type factor = lower[k] / diag[k - 1];
+        diag[k] -= factor * upper[k - 1];
+        rhs[k] -= factor * rhs[k - 1];
+    }
+
+    // Back substitution
+    VecReal result(num_points);
+    result[num_inner] = rhs.back() / diag.back();
+    for (size_type k = num_inner - 1; k-- > 0;)
+    {
+        result[k + 1] = (rhs[k] - upper[k] * result[k + 2]) / diag[k];
+    }
+
+    // Extrapolate to the end points
+    result[0] = ((h[0] + h[1]) * result[1] - h[0] * result[2]) / h[1];
+    result[n] = ((h[n - 2] + h[n - 1]) * result[n - 1]
+                 - h[n - 1] * result[n - 2])
+                / h[n - 2];
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
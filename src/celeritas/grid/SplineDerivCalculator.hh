@@ -0,0 +1,46 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/grid/SplineDerivCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the second derivatives of an interpolating cubic spline.
+ *
+ * Given values \f$ y_i \f$ on an increasing grid \f$ x_i \f$, this solves the
+ * tridiagonal system for the second derivatives \f$ y''_i \f$ of the cubic
+ * spline with continuous first and second derivatives. The "not-a-knot"
+ * boundary conditions (a continuous third derivative at the second and
+ * next-to-last points) make the spline exact for cubic polynomials, which is
+ * also the default in Geant4's \c G4PhysicsVector::FillSecondDerivatives .
+ *
+ * With three points the spline is the interpolating parabola, and with two
+ * points it is linear.
+ */
+class SplineDerivCalculator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using SpanConstReal = Span<const real_type>;
+    using VecReal       = std::vector<real_type>;
+    //!@}
+
+  public:
+    // Calculate the second derivatives
+    VecReal operator()(SpanConstReal x, SpanConstReal y) const;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -230,6 +230,41 @@ auto ValueGridLogBuilder::from_range(SpanConstReal energy, SpanConstReal value)
     return ValueGridLogBuilder::from_geant(energy, value);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct by joining grids over adjacent energy ranges.
+ *
+ * The upper energy of the lower grid must be the lower energy of the upper
+ * grid. The values are interpolated onto a single log grid spanning both
+ * ranges, with the finer of the two grid spacings.
+ */
+auto ValueGridLogBuilder::from_joined(const ValueGridLogBuilder& lower,
+                                      const ValueGridLogBuilder& upper)
+    -> UPLogBuilder
+{
+    CELER_EXPECT(soft_equal(lower.log_emax_, upper.log_emin_));
+
+    auto calc_log_delta = [](const ValueGridLogBuilder& b) {
+        return (b.log_emax_ - b.log_emin_) / (b.value_.size() - 1);
+    };
+    const real_type log_delta
+        = std::min(calc_log_delta(lower), calc_log_delta(upper));
+    const size_type size
+        = std::ceil((upper.log_emax_ - lower.log_emin_) / log_delta) + 1;
+
+    UniformGrid loge_grid{
+        UniformGridData::from_bounds(lower.log_emin_, upper.log_emax_, size)};
+    VecReal value(size);
+    for (auto i : range(size))
+    {
+        const real_type loge = loge_grid[i];
+        value[i] = (loge < upper.log_emin_ ? lower : upper).calc_value(loge);
+    }
+    return std::make_unique<ValueGridLogBuilder>(std::exp(lower.log_emin_),
+                                                 std::exp(upper.log_emax_),
+                                                 std::move(value));
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct from raw data.
@@ -266,6 +301,27 @@ auto ValueGridLogBuilder::value() const -> SpanConstReal
     return make_span(value_);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolate linearly in energy, snapping to the closest grid bounds.
+ */
+real_type ValueGridLogBuilder::calc_value(real_type log_energy) const
+{
+    UniformGrid loge_grid{
+        UniformGridData::from_bounds(log_emin_, log_emax_, value_.size())};
+    if (log_energy <= loge_grid.front())
+        return value_.front();
+    if (log_energy >= loge_grid.back())
+        return value_.back();
+
+    const size_type i       = loge_grid.find(log_energy);
+    const real_type lower_e = std::exp(loge_grid[i]);
+    const real_type upper_e = std::exp(loge_grid[i + 1]);
+    const real_type frac    = (std::exp(log_energy) - lower_e)
+                           / (upper_e - lower_e);
+    return (1 - frac) * value_[i] + frac * value_[i + 1];
+}
+
 //---------------------------------------------------------------------------//
 // GENERIC BUILDER
 //---------------------------------------------------------------------------//
@@ -122,6 +122,11 @@ class ValueGridLogBuilder : public ValueGridBuilder
     // Construct from range
     static UPLogBuilder from_range(SpanConstReal energy, SpanConstReal range);
 
+    // Construct by joining grids over adjacent energy ranges
+    static UPLogBuilder
+    from_joined(const ValueGridLogBuilder& lower,
+                const ValueGridLogBuilder& upper);
+
     // Construct
     ValueGridLogBuilder(real_type emin, real_type emax, VecReal value);
 
@@ -135,6 +140,8 @@ class ValueGridLogBuilder : public ValueGridBuilder
     real_type log_emin_;
     real_type log_emax_;
     VecReal   value_;
+
+    real_type calc_value(real_type log_energy) const;
 };
 
 //---------------------------------------------------------------------------//
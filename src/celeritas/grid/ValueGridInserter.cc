@@ -7,21 +7,84 @@
 //---------------------------------------------------------------------------//
 #include "ValueGridInserter.hh"
 
+#include <algorithm>
+#include <cmath>
+
 #include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
 
+#include "SplineDerivCalculator.hh"
+#include "UniformGrid.hh"
+#include "XsCalculator.hh"
 #include "XsGridData.hh"
 
 namespace celeritas
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Xs grid data reduced to every n-th point.
+ */
+struct ResampledGrid
+{
+    UniformGridData        log_grid;
+    size_type              prime_index;
+    std::vector<real_type> values;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Keep every \c stride -th point of a uniform log grid.
+ */
+ResampledGrid resample(const UniformGridData& log_grid,
+                       size_type              prime_index,
+                       Span<const real_type>  values,
+                       size_type              stride)
+{
+    CELER_EXPECT(stride > 0 && (values.size() - 1) % stride == 0);
+    CELER_EXPECT(prime_index >= values.size() || prime_index % stride == 0);
+
+    ResampledGrid result;
+    for (size_type i = 0; i < values.size(); i += stride)
+    {
+        result.values.push_back(values[i]);
+    }
+    result.log_grid = UniformGridData::from_bounds(
+        log_grid.front, log_grid.back, result.values.size());
+    if (prime_index < values.size())
+    {
+        result.prime_index = prime_index / stride;
+    }
+    else if (prime_index == XsGridData::no_scaling())
+    {
+        result.prime_index = prime_index;
+    }
+    else
+    {
+        result.prime_index = result.values.size();
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct with a reference to mutable host data.
  */
 ValueGridInserter::ValueGridInserter(RealCollection*   real_data,
-                                     XsGridCollection* xs_grid)
-    : values_(real_data), xs_grids_(xs_grid)
+                                     XsGridCollection* xs_grid,
+                                     bool              spline,
+                                     real_type         tolerance)
+    : values_(real_data)
+    , xs_grids_(xs_grid)
+    , spline_(spline)
+    , tolerance_(tolerance)
 {
     CELER_EXPECT(real_data && xs_grid);
+    CELER_EXPECT(tolerance >= 0 && (spline || tolerance == 0));
 }
 
 //---------------------------------------------------------------------------//
@@ -37,11 +100,17 @@ auto ValueGridInserter::operator()(const UniformGridData& log_grid,
     CELER_EXPECT(prime_index <= log_grid.size
                  || prime_index == XsGridData::no_scaling());
 
-    XsGridData grid;
-    grid.log_energy  = log_grid;
-    grid.prime_index = prime_index;
-    grid.value       = values_.insert_back(values.begin(), values.end());
-    return xs_grids_.push_back(grid);
+    if (spline_ && tolerance_ > 0)
+    {
+        size_type stride = this->calc_stride(log_grid, prime_index, values);
+        if (stride > 1)
+        {
+            auto coarse = resample(log_grid, prime_index, values, stride);
+            return this->insert_xs(
+                coarse.log_grid, coarse.prime_index, make_span(coarse.values));
+        }
+    }
+    return this->insert_xs(log_grid, prime_index, values);
 }
 
 //---------------------------------------------------------------------------//
@@ -64,5 +133,137 @@ auto ValueGridInserter::operator()(InterpolatedGrid, InterpolatedGrid)
     CELER_NOT_IMPLEMENTED("generic grids");
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Store xs grid values and spline coefficients without resampling.
+ */
+auto ValueGridInserter::insert_xs(const UniformGridData& log_grid,
+                                  size_type              prime_index,
+                                  SpanConstReal          values) -> XsIndex
+{
+    XsGridData grid;
+    grid.log_energy  = log_grid;
+    grid.prime_index = prime_index;
+    grid.value       = values_.insert_back(values.begin(), values.end());
+    if (spline_)
+    {
+        auto deriv = this->calc_second_deriv(log_grid, prime_index, values);
+        grid.second_deriv = values_.insert_back(deriv.begin(), deriv.end());
+    }
+    return xs_grids_.push_back(grid);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the largest stride that resamples a grid to within the tolerance.
+ *
+ * Only strides that divide the grid evenly and keep the prime energy on the
+ * grid are considered. The resampled spline is compared against the original
+ * cross sections at every original grid point. A stride of one means the grid
+ * is kept as is.
+ */
+size_type ValueGridInserter::calc_stride(const UniformGridData& log_grid,
+                                         size_type              prime_index,
+                                         SpanConstReal          values) const
+{
+    using Energy = XsCalculator::Energy;
+
+    const size_type num_points = values.size();
+
+    // Get the unscaled cross sections and the error floor
+    const UniformGrid      loge_grid(log_grid);
+    std::vector<real_type> energy(num_points);
+    std::vector<real_type> xs(num_points);
+    real_type              floor = 0;
+    for (auto i : range(num_points))
+    {
+        energy[i] = std::exp(loge_grid[i]);
+        xs[i]     = values[i];
+        if (i >= prime_index)
+        {
+            xs[i] /= energy[i];
+        }
+        floor = std::max(floor, real_type(1e-3) * std::fabs(xs[i]));
+    }
+
+    for (size_type stride = num_points - 1; stride > 1; --stride)
+    {
+        if ((num_points - 1) % stride != 0
+            || (prime_index < num_points && prime_index % stride != 0))
+        {
+            continue;
+        }
+
+        // Spline the resampled values in temporary storage
+        auto coarse = resample(log_grid, prime_index, values, stride);
+        RealCollection    reals;
+        XsGridCollection  grids;
+        ValueGridInserter insert(&reals, &grids, true);
+        auto grid_id = insert(
+            coarse.log_grid, coarse.prime_index, make_span(coarse.values));
+        Collection<real_type, Ownership::const_reference, MemSpace::host> ref;
+        ref = reals;
+        XsCalculator calc_xs(grids[grid_id], ref);
+
+        bool within_tol = true;
+        for (size_type i = 0; within_tol && i < num_points; ++i)
+        {
+            real_type err = std::fabs(calc_xs(Energy{energy[i]}) - xs[i]);
+            within_tol = err <= tolerance_ * std::max(std::fabs(xs[i]), floor);
+        }
+        if (within_tol)
+        {
+            return stride;
+        }
+    }
+    return 1;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate spline second derivatives in log energy.
+ *
+ * Values below and above the prime index are splined separately: the lower
+ * spline ends at the prime energy using the unscaled value there, and its
+ * second derivative at that point is not stored.
+ */
+auto ValueGridInserter::calc_second_deriv(const UniformGridData& log_grid,
+                                          size_type              prime_index,
+                                          SpanConstReal          values) const
+    -> std::vector<real_type>
+{
+    const UniformGrid      loge_grid(log_grid);
+    std::vector<real_type> loge(values.size());
+    for (auto i : range(loge.size()))
+    {
+        loge[i] = loge_grid[i];
+    }
+
+    SplineDerivCalculator  calc_deriv;
+    std::vector<real_type> result(values.size(), 0);
+    const size_type lower_end = std::min(prime_index, values.size() - 1);
+    if (lower_end >= 1)
+    {
+        // Spline the unscaled values up to and including the prime energy
+        std::vector<real_type> unscaled(values.begin(),
+                                        values.begin() + lower_end + 1);
+        if (lower_end == prime_index)
+        {
+            unscaled.back() /= std::exp(loge[lower_end]);
+        }
+        auto deriv = calc_deriv(make_span(loge).first(lower_end + 1),
+                                make_span(unscaled));
+        std::copy(deriv.begin(), deriv.end(), result.begin());
+    }
+    if (prime_index < values.size() - 1)
+    {
+        // Spline the scaled values from the prime energy
+        auto deriv = calc_deriv(make_span(loge).subspan(prime_index),
+                                values.subspan(prime_index));
+        std::copy(deriv.begin(), deriv.end(), result.begin() + prime_index);
+    }
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
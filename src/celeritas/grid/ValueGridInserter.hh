@@ -27,6 +27,14 @@ namespace celeritas
  * ValueGridXsBuilder::build method taking an instance of this class) it can be
  * extended to build additional grid types as well.
  *
+ * If \c spline is enabled, the second derivatives needed for cubic spline
+ * interpolation are calculated and stored alongside each xs grid. A positive
+ * \c tolerance additionally resamples each splined xs grid onto the coarsest
+ * uniform subset of its points (keeping every n-th point, including the
+ * prime energy) for which the spline reproduces all the original values to
+ * that relative tolerance. Values below 1e-3 of the grid's largest cross
+ * section are compared against that floor instead.
+ *
  * \code
     ValueGridInserter insert(&data.host.values, &data.host.grids);
     insert(uniform_grid, values);
@@ -51,7 +59,10 @@ class ValueGridInserter
 
   public:
     // Construct with a reference to mutable host data
-    ValueGridInserter(RealCollection* real_data, XsGridCollection* xs_grid);
+    ValueGridInserter(RealCollection*   real_data,
+                      XsGridCollection* xs_grid,
+                      bool              spline    = false,
+                      real_type         tolerance = 0);
 
     // Add a grid of xs-like data
     XsIndex operator()(const UniformGridData& log_grid,
@@ -67,6 +78,21 @@ class ValueGridInserter
   private:
     CollectionBuilder<real_type, MemSpace::host, ItemId<real_type>>   values_;
     CollectionBuilder<XsGridData, MemSpace::host, ItemId<XsGridData>> xs_grids_;
+
+    bool      spline_;
+    real_type tolerance_;
+
+    XsIndex insert_xs(const UniformGridData& log_grid,
+                      size_type              prime_index,
+                      SpanConstReal          values);
+
+    size_type calc_stride(const UniformGridData& log_grid,
+                          size_type              prime_index,
+                          SpanConstReal          values) const;
+
+    std::vector<real_type> calc_second_deriv(const UniformGridData& log_grid,
+                                             size_type     prime_index,
+                                             SpanConstReal values) const;
 };
 
 //---------------------------------------------------------------------------//
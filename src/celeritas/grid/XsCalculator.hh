@@ -9,8 +9,10 @@
 
 #include <cmath>
 
+#include "corecel/math/Algorithms.hh"
 #include "corecel/math/Quantity.hh"
 
+#include "EnergyGridLocator.hh"
 #include "Interpolator.hh"
 #include "UniformGrid.hh"
 #include "XsGridData.hh"
@@ -21,6 +23,9 @@ namespace celeritas
 /*!
  * Find and interpolate cross sections on a uniform log grid.
  *
+ * Values are linearly interpolated in energy, or with a cubic spline in log
+ * energy if the grid stores second derivatives.
+ *
  * \todo Currently this is hard-coded to use "cross section grid data"
  * which have energy coordinates uniform in log space. This should
  * be expanded to handle multiple parameterizations of the energy grid (e.g.,
@@ -34,6 +39,9 @@ namespace celeritas
     XsCalculator calc_xs(xs_grid, xs_params.reals);
     real_type xs = calc_xs(particle);
    \endcode
+ *
+ * An \c EnergyGridLocator can be passed instead of the energy to share the
+ * log energy and grid location between several lookups at the same energy.
  */
 class XsCalculator
 {
@@ -53,6 +61,9 @@ class XsCalculator
     // Find and interpolate from the energy
     inline CELER_FUNCTION real_type operator()(Energy energy) const;
 
+    // Find and interpolate using a cached energy grid location
+    inline CELER_FUNCTION real_type operator()(EnergyGridLocator& locate) const;
+
     // Get the cross section at the given index
     inline CELER_FUNCTION real_type operator[](size_type index) const;
 
@@ -61,6 +72,10 @@ class XsCalculator
     const Values&     reals_;
 
     CELER_FORCEINLINE_FUNCTION real_type get(size_type index) const;
+    CELER_FORCEINLINE_FUNCTION real_type deriv(size_type index) const;
+    inline CELER_FUNCTION real_type interpolate_spline(size_type lower_idx,
+                                                       real_type upper_xs,
+                                                       real_type frac) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -80,14 +95,26 @@ XsCalculator::XsCalculator(const XsGridData& grid, const Values& values)
 //---------------------------------------------------------------------------//
 /*!
  * Calculate the cross section.
- *
- * If needed, we can add a "log(energy/MeV)" accessor if we constantly reuse
- * that value and don't want to repeat the `std::log` operation.
  */
 CELER_FUNCTION real_type XsCalculator::operator()(Energy energy) const
+{
+    EnergyGridLocator locate(energy);
+    return (*this)(locate);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the cross section using a cached energy grid location.
+ *
+ * The location is shared with other lookups at the same energy, so the log
+ * energy and bracketing grid energies are reused if the grids are the same.
+ */
+CELER_FUNCTION real_type
+XsCalculator::operator()(EnergyGridLocator& locate) const
 {
     const UniformGrid loge_grid(data_.log_energy);
-    const real_type   loge = std::log(energy.value());
+    const real_type   loge   = locate.log_energy();
+    const real_type   energy = locate.energy().value();
 
     // Snap out-of-bounds values to closest grid points
     size_type lower_idx;
@@ -105,28 +132,36 @@ CELER_FUNCTION real_type XsCalculator::operator()(Energy energy) const
     else
     {
         // Locate the energy bin
-        lower_idx = loge_grid.find(loge);
-        CELER_ASSERT(lower_idx + 1 < loge_grid.size());
+        const auto& bin = locate.find(loge_grid);
+        lower_idx       = bin.index;
 
-        const real_type upper_energy = std::exp(loge_grid[lower_idx + 1]);
-        real_type       upper_xs     = this->get(lower_idx + 1);
+        real_type upper_xs = this->get(lower_idx + 1);
         if (lower_idx + 1 == data_.prime_index)
         {
             // Cross section data for the upper point has *already* been scaled
             // by E -- undo the scaling.
-            upper_xs /= upper_energy;
+            upper_xs /= bin.upper_energy;
         }
 
-        // Interpolate *linearly* on energy using the lower_idx data.
-        LinearInterpolator<real_type> interpolate_xs(
-            {std::exp(loge_grid[lower_idx]), this->get(lower_idx)},
-            {upper_energy, upper_xs});
-        result = interpolate_xs(energy.value());
+        if (data_.second_deriv.empty())
+        {
+            // Interpolate *linearly* on energy using the lower_idx data.
+            LinearInterpolator<real_type> interpolate_xs(
+                {bin.lower_energy, this->get(lower_idx)},
+                {bin.upper_energy, upper_xs});
+            result = interpolate_xs(energy);
+        }
+        else
+        {
+            real_type frac = (loge - loge_grid[lower_idx])
+                             / data_.log_energy.delta;
+            result = this->interpolate_spline(lower_idx, upper_xs, frac);
+        }
     }
 
     if (lower_idx >= data_.prime_index)
     {
-        result /= energy.value();
+        result /= energy;
     }
     return result;
 }
@@ -158,5 +193,54 @@ CELER_FUNCTION real_type XsCalculator::get(size_type index) const
     return reals_[data_.value[index]];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolate with a cubic spline in log energy.
+ *
+ * The upper value must already be unscaled if it is at the prime index. In
+ * that case the second derivative of the lower spline at the prime index is
+ * reconstructed from the not-a-knot condition, which requires the last two
+ * intervals of the lower spline to share a single cubic.
+ */
+CELER_FUNCTION real_type XsCalculator::interpolate_spline(size_type lower_idx,
+                                                          real_type upper_xs,
+                                                          real_type frac) const
+{
+    const real_type lower_deriv = this->deriv(lower_idx);
+    real_type       upper_deriv;
+    if (lower_idx + 1 != data_.prime_index)
+    {
+        upper_deriv = this->deriv(lower_idx + 1);
+    }
+    else if (lower_idx > 0)
+    {
+        upper_deriv = 2 * lower_deriv - this->deriv(lower_idx - 1);
+    }
+    else
+    {
+        upper_deriv = 0;
+    }
+
+    const real_type lower = 1 - frac;
+    const real_type upper = frac;
+    real_type result = lower * this->get(lower_idx) + upper * upper_xs
+                       + ((ipow<3>(lower) - lower) * lower_deriv
+                          + (ipow<3>(upper) - upper) * upper_deriv)
+                             * ipow<2>(data_.log_energy.delta) / 6;
+
+    // Prevent spline overshoot near sharp thresholds
+    return celeritas::max<real_type>(result, 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the spline second derivative at a particular index.
+ */
+CELER_FUNCTION real_type XsCalculator::deriv(size_type index) const
+{
+    CELER_EXPECT(index < data_.second_deriv.size());
+    return reals_[data_.second_deriv[index]];
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -25,6 +25,12 @@ namespace celeritas
  *
  * Interpolation is linear-linear after transforming to log-E space and before
  * scaling the value by E (if the grid point is above prime_index).
+ *
+ * If \c second_deriv is assigned, the values are instead interpolated with a
+ * cubic spline in log-E space, which allows much coarser grids for the same
+ * accuracy. The values below and above \c prime_index are splined
+ * separately, and the stored second derivative *at* the prime index belongs
+ * to the upper (scaled) spline.
  */
 struct XsGridData
 {
@@ -40,13 +46,16 @@ struct XsGridData
     UniformGridData      log_energy;
     size_type            prime_index{no_scaling()};
     ItemRange<real_type> value;
+    ItemRange<real_type> second_deriv; //!< Optional spline coefficients
 
     //! Whether the interface is initialized and valid
     explicit CELER_FUNCTION operator bool() const
     {
         return log_energy && (value.size() >= 2)
                && (prime_index < log_energy.size || prime_index == no_scaling())
-               && log_energy.size == value.size();
+               && log_energy.size == value.size()
+               && (second_deriv.empty()
+                   || second_deriv.size() == value.size());
     }
 };
 
@@ -188,5 +188,16 @@ inline void resize(MaterialStateData<Ownership::value, M>* data,
     resize(&data->element_scratch, size * params.max_element_components);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a function to the persistent per-track collections of the state.
+ */
+template<Ownership W, MemSpace M, class F>
+inline void
+for_each_track_items(const MaterialStateData<W, M>& state, F&& visit)
+{
+    visit(state.state);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -161,5 +161,16 @@ inline void resize(ParticleStateData<Ownership::value, M>* data,
     resize(&data->state, size);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a function to the persistent per-track collections of the state.
+ */
+template<Ownership W, MemSpace M, class F>
+inline void
+for_each_track_items(const ParticleStateData<W, M>& state, F&& visit)
+{
+    visit(state.state);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -369,6 +369,7 @@ struct PhysicsParamsData
  * - Within-step energy loss range
  * - Secondaries emitted from an interaction
  * - Discrete process element selection
+ * - Whether the per-process cross sections are majorants
  */
 struct PhysicsTrackState
 {
@@ -379,8 +380,10 @@ struct PhysicsTrackState
     real_type energy_deposition; //!< Local energy deposition in a step [MeV]
     real_type dedx_range;        //!< Local energy loss range [cm]
     MscRange  msc_range;         //!< Range properties for multiple scattering
-    Span<Secondary>    secondaries; //!< Emitted secondaries
-    ElementComponentId element;     //!< Element sampled for interaction
+    Span<Secondary>    secondaries;       //!< Emitted secondaries
+    ElementComponentId element;           //!< Element sampled for interaction
+    bool               majorant_xs;       //!< Reject collisions with local xs
+    bool               retry_interaction; //!< Resample a failed interaction
 };
 
 //---------------------------------------------------------------------------//
@@ -470,5 +473,20 @@ inline void resize(PhysicsStateData<Ownership::value, M>* state,
     resize(&state->secondaries, size * params.scalars.secondary_stack_factor);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a function to the persistent per-track collections of the state.
+ *
+ * The per-process cross sections and relaxation scratch space are rewritten
+ * during every step, and the secondary stack isn't indexed by track slot.
+ */
+template<Ownership W, MemSpace M, class F>
+inline void
+for_each_track_items(const PhysicsStateData<W, M>& state, F&& visit)
+{
+    visit(state.state);
+    visit(state.msc_step);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
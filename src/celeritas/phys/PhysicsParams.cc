@@ -8,6 +8,7 @@
 #include "PhysicsParams.hh"
 
 #include <algorithm>
+#include <cmath>
 #include <map>
 #include <tuple>
 
@@ -18,13 +19,13 @@
 #include "corecel/math/Algorithms.hh"
 #include "corecel/math/VectorUtils.hh"
 #include "celeritas/em/AtomicRelaxationParams.hh" // IWYU pragma: keep
-#include "celeritas/em/model/CombinedBremModel.hh"
 #include "celeritas/em/model/EPlusGGModel.hh"
 #include "celeritas/em/model/LivermorePEModel.hh"
 #include "celeritas/em/process/MultipleScatteringProcess.hh"
 #include "celeritas/global/ActionInterface.hh"
 #include "celeritas/global/ActionRegistry.hh"
 #include "celeritas/grid/ValueGridBuilder.hh"
+#include "celeritas/grid/UniformGrid.hh"
 #include "celeritas/grid/ValueGridInserter.hh"
 #include "celeritas/grid/XsCalculator.hh"
 #include "celeritas/mat/MaterialParams.hh"
@@ -45,6 +46,90 @@ class ImplicitPhysicsAction final : public ImplicitActionInterface,
     // Construct with ID and label
     using ConcreteAction::ConcreteAction;
 };
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the energy of the largest cross section on a grid.
+ *
+ * Linearly interpolated cross sections peak at a grid point, but a spline can
+ * peak between grid points. For splined grids, the largest of several samples
+ * per bin is refined with a golden-section search.
+ */
+real_type
+find_energy_max_xs(const XsGridData& grid_data, const XsCalculator& calc_xs)
+{
+    const UniformGrid loge_grid(grid_data.log_energy);
+
+    real_type xs_max      = 0;
+    real_type loge_max_xs = loge_grid.front();
+    for (auto i : range(loge_grid.size()))
+    {
+        real_type xs = calc_xs[i];
+        if (xs > xs_max)
+        {
+            xs_max      = xs;
+            loge_max_xs = loge_grid[i];
+        }
+    }
+    if (grid_data.second_deriv.empty())
+    {
+        return std::exp(loge_max_xs);
+    }
+
+    auto calc_xs_loge = [&calc_xs](real_type loge) {
+        return calc_xs(XsCalculator::Energy{std::exp(loge)});
+    };
+
+    // Sample within each bin
+    constexpr size_type num_bin_samples = 16;
+    const real_type     dloge = grid_data.log_energy.delta / num_bin_samples;
+    for (auto i : range((loge_grid.size() - 1) * num_bin_samples))
+    {
+        real_type loge = loge_grid.front() + i * dloge;
+        real_type xs   = calc_xs_loge(loge);
+        if (xs > xs_max)
+        {
+            xs_max      = xs;
+            loge_max_xs = loge;
+        }
+    }
+
+    // Refine the maximum between the neighboring samples
+    const real_type inv_phi  = (std::sqrt(real_type(5)) - 1) / 2;
+    real_type       lower    = max(loge_max_xs - dloge, loge_grid.front());
+    real_type       upper    = min(loge_max_xs + dloge, loge_grid.back());
+    real_type       left     = upper - inv_phi * (upper - lower);
+    real_type       right    = lower + inv_phi * (upper - lower);
+    real_type       xs_left  = calc_xs_loge(left);
+    real_type       xs_right = calc_xs_loge(right);
+    for (CELER_MAYBE_UNUSED auto i : range(64))
+    {
+        if (xs_left > xs_right)
+        {
+            upper    = right;
+            right    = left;
+            xs_right = xs_left;
+            left     = upper - inv_phi * (upper - lower);
+            xs_left  = calc_xs_loge(left);
+        }
+        else
+        {
+            lower    = left;
+            left     = right;
+            xs_left  = xs_right;
+            right    = lower + inv_phi * (upper - lower);
+            xs_right = calc_xs_loge(right);
+        }
+    }
+    real_type loge = (lower + upper) / 2;
+    if (calc_xs_loge(loge) > xs_max)
+    {
+        loge_max_xs = loge;
+    }
+    return std::exp(loge_max_xs);
+}
+
+//---------------------------------------------------------------------------//
 } // namespace
 
 //---------------------------------------------------------------------------//
@@ -206,6 +291,11 @@ void PhysicsParams::build_options(const Options& opts, HostValue* data) const
     CELER_VALIDATE(opts.secondary_stack_factor > 0,
                    << "invalid secondary_stack_factor="
                    << opts.secondary_stack_factor << " (should be positive)");
+    CELER_VALIDATE(!opts.spline_tables[ValueGridType::range],
+                   << "range tables cannot use spline interpolation");
+    CELER_VALIDATE(opts.spline_tolerance >= 0,
+                   << "invalid spline_tolerance=" << opts.spline_tolerance
+                   << " (should be nonnegative)");
     data->scalars.min_range              = opts.min_range;
     data->scalars.max_step_over_range    = opts.max_step_over_range;
     data->scalars.min_eprime_over_e      = opts.min_eprime_over_e;
@@ -387,12 +477,19 @@ void PhysicsParams::build_xs(const Options&        opts,
     using Energy        = Applicability::Energy;
 
     ValueGridInserter insert_grid(&data->reals, &data->value_grids);
+    ValueGridInserter insert_spline(
+        &data->reals, &data->value_grids, true, opts.spline_tolerance);
     auto              value_tables   = make_builder(&data->value_tables);
     auto              integral_xs    = make_builder(&data->integral_xs);
     auto              value_grid_ids = make_builder(&data->value_grid_ids);
     auto              build_grid
-        = [insert_grid](const UPGridBuilder& builder) -> ValueGridId {
-        return builder ? builder->build(insert_grid) : ValueGridId{};
+        = [&](ValueGridType vgt, const UPGridBuilder& builder) -> ValueGridId {
+        if (!builder)
+        {
+            return {};
+        }
+        return builder->build(opts.spline_tables[vgt] ? insert_spline
+                                                      : insert_grid);
     };
 
     Applicability applic;
@@ -466,7 +563,7 @@ void PhysicsParams::build_xs(const Options&        opts,
                 for (auto vgt : range(ValueGridType::size_))
                 {
                     temp_grid_ids[vgt][mat_id.get()]
-                        = build_grid(builders[vgt]);
+                        = build_grid(vgt, builders[vgt]);
                 }
 
                 if (processes[pp_idx] == data->hardwired.positron_annihilation)
@@ -486,7 +583,6 @@ void PhysicsParams::build_xs(const Options&        opts,
                 {
                     const auto&        grid_data = data->value_grids[grid_id];
                     auto               data_ref  = make_const_ref(*data);
-                    const UniformGrid  loge_grid(grid_data.log_energy);
                     const XsCalculator calc_xs(grid_data, data_ref.reals);
 
                     // Check if the particle can have a discrete interaction at
@@ -497,20 +593,8 @@ void PhysicsParams::build_xs(const Options&        opts,
                     // for this material if the integral approach is used
                     if (use_integral_xs)
                     {
-                        // Find the energy of the largest cross section
-                        real_type xs_max = 0;
-                        real_type e_max  = 0;
-                        for (auto i : range(loge_grid.size()))
-                        {
-                            real_type xs = calc_xs[i];
-                            if (xs > xs_max)
-                            {
-                                xs_max = xs;
-                                e_max  = std::exp(loge_grid[i]);
-                            }
-                        }
-                        CELER_ASSERT(e_max > 0);
-                        energy_max_xs[mat_id.get()] = e_max;
+                        energy_max_xs[mat_id.get()]
+                            = find_energy_max_xs(grid_data, calc_xs);
                     }
                 }
 
@@ -601,16 +685,6 @@ void PhysicsParams::build_model_xs(const MaterialParams& mats,
                 applic.material = mat_id;
                 auto material   = mats.get(mat_id);
 
-                // TODO: Create combined SB + RB micro xs grids or possibly
-                // remove combined bremsstrahlung model
-                CELER_VALIDATE(!(dynamic_cast<const CombinedBremModel*>(&model)
-                                 && material.num_elements() > 1),
-                               << "model '" << model.label()
-                               << "' cannot be used with materials composed "
-                                  "of more than one element (material '"
-                               << mats.id_to_label(mat_id) << "' has "
-                               << material.num_elements() << " elements)");
-
                 // Construct microscopic cross section builders
                 auto builders = model.micro_xs(applic);
                 if (builders.empty())
@@ -16,6 +16,7 @@
 #include "celeritas/Types.hh"
 #include "celeritas/Units.hh"
 #include "celeritas/global/ActionInterface.hh"
+#include "celeritas/grid/ValueGridData.hh"
 
 #include "Model.hh"
 #include "PhysicsData.hh"
@@ -56,6 +57,12 @@ class ParticleParams;
  *   processes use MC integration to sample the discrete interaction length
  *   with the correct probability. Disable this integral approach for all
  *   processes.
+ * - \c spline_tables: interpolate tables of the given type with cubic splines
+ *   rather than linearly. Range tables are always linear since they must be
+ *   inverted. On its own this only adds memory for the spline coefficients.
+ * - \c spline_tolerance: if positive, resample each splined table onto the
+ *   coarsest subset of its grid that reproduces the original values to this
+ *   relative tolerance (see \c ValueGridInserter and \c celer-dump-data).
  *
  * NOTE: min_range/max_step_over_range are not accessible through Geant4, and
  * they can also be set to be different for electrons, mu/hadrons, and ions.
@@ -80,6 +87,9 @@ struct PhysicsParamsOptions
 
     real_type secondary_stack_factor = 3;
     bool      disable_integral_xs    = false;
+
+    ValueGridArray<bool> spline_tables{};
+    real_type            spline_tolerance = 0;
 };
 
 //---------------------------------------------------------------------------//
@@ -99,7 +109,7 @@ struct PhysicsParamsOptions
  * - "along-step": propagate, apply energy loss, multiple scatter
  * - "range": limit step by energy loss
  * - "discrete-select": sample a process for a discrete interaction, or reject
- *   due to integral cross sectionl
+ *   due to an integral or majorant cross section
  * - "integral-rejected": do not apply a discrete interaction
  * - "failure": model failed to allocate secondaries
  */
@@ -14,6 +14,7 @@
 #include "corecel/math/Algorithms.hh"
 #include "corecel/math/NumericLimits.hh"
 #include "celeritas/Types.hh"
+#include "celeritas/grid/EnergyGridLocator.hh"
 #include "celeritas/grid/EnergyLossCalculator.hh"
 #include "celeritas/grid/InverseRangeCalculator.hh"
 #include "celeritas/grid/RangeCalculator.hh"
@@ -49,6 +50,9 @@ calc_physics_step_limit(const MaterialTrackView& material,
     // decay probability, dividing decay constant by speed to become 1/cm to
     // compete with interactions
 
+    // Calculate the log energy and its grid location once for all processes
+    EnergyGridLocator locate(particle.energy());
+
     // Loop over all processes that apply to this track (based on particle
     // type) and calculate cross section and particle range.
     real_type total_macro_xs = 0;
@@ -60,13 +64,13 @@ calc_physics_step_limit(const MaterialTrackView& material,
             // If the integral approach is used and this particle has an energy
             // loss process, estimate the maximum cross section over the step
             process_xs = physics.calc_max_xs(
-                process, ppid, material.make_material_view(), particle.energy());
+                process, ppid, material.make_material_view(), locate);
         }
         else
         {
             // Calculate the macroscopic cross section for this process
-            process_xs = physics.calc_xs(
-                ppid, material.make_material_view(), particle.energy());
+            process_xs
+                = physics.calc_xs(ppid, material.make_material_view(), locate);
         }
         // Accumulate process cross section into the total cross section and
         // save it for later
@@ -82,13 +86,22 @@ calc_physics_step_limit(const MaterialTrackView& material,
     limit.action = physics.scalars().discrete_action();
     if (!particle.is_stopped())
     {
-        limit.step = physics.interaction_mfp() / total_macro_xs;
+        if (total_macro_xs > 0)
+        {
+            limit.step = physics.interaction_mfp() / total_macro_xs;
+        }
+        else
+        {
+            // No discrete interaction can occur in this material
+            limit.step   = numeric_limits<real_type>::infinity();
+            limit.action = {};
+        }
 
         if (auto ppid = physics.eloss_ppid())
         {
             auto grid_id    = physics.value_grid(VGT::range, ppid);
             auto calc_range = physics.make_calculator<RangeCalculator>(grid_id);
-            real_type range = calc_range(particle.energy());
+            real_type range = calc_range(locate);
             // Save range for the current step and reuse it elsewhere
             physics.dedx_range(range);
 
@@ -239,6 +252,10 @@ inline CELER_FUNCTION ParticleTrackView::Energy
  *   section is constant along the step is no longer valid. Use the "integral
  *   approach" to sample the discrete interaction from the correct probability
  *   distribution (section 7.4 of the Geant4 Physics Reference release 10.6).
+ * - If the per-process cross sections are majorants over a Woodcock tracking
+ *   region, the track may now be in a different material: the collision is
+ *   likewise accepted with probability \f$ \sigma / \sigma_\mathrm{maj} \f$
+ *   using the cross section of the current material.
  */
 template<class Engine>
 CELER_FUNCTION ActionId
@@ -259,10 +276,11 @@ select_discrete_interaction(const MaterialView&      material,
         pstep.macro_xs())(rng);
 
     // Determine if the discrete interaction occurs for particles with energy
-    // loss processes
-    if (physics.integral_xs_process(ppid))
+    // loss processes or a virtual collision in a Woodcock tracking region
+    if (physics.integral_xs_process(ppid) || pstep.majorant_xs())
     {
         // Recalculate the cross section at the post-step energy \f$ E_1 \f$
+        // and material
         real_type xs = physics.calc_xs(ppid, material, particle.energy());
 
         // The discrete interaction occurs with probability \f$ \sigma(E_1) /
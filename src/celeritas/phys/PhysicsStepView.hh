@@ -57,6 +57,12 @@ class PhysicsStepView
     // Set the sampled element
     inline CELER_FUNCTION void element(ElementComponentId);
 
+    // Set whether the per-process cross sections are majorants
+    inline CELER_FUNCTION void majorant_xs(bool);
+
+    // Set whether a failed interaction is being resampled
+    inline CELER_FUNCTION void retry_interaction(bool);
+
     // Save MSC step data
     inline CELER_FUNCTION void msc_step(const MscStep&);
 
@@ -78,6 +84,12 @@ class PhysicsStepView
     // Sampled element for discrete interaction
     CELER_FORCEINLINE_FUNCTION ElementComponentId element() const;
 
+    // Whether the per-process cross sections are majorants
+    CELER_FORCEINLINE_FUNCTION bool majorant_xs() const;
+
+    // Whether a failed interaction is being resampled
+    CELER_FORCEINLINE_FUNCTION bool retry_interaction() const;
+
     // Retrieve MSC step data
     inline CELER_FUNCTION const MscStep& msc_step() const;
 
@@ -146,6 +158,32 @@ CELER_FUNCTION void PhysicsStepView::element(ElementComponentId elcomp_id)
     this->state().element = elcomp_id;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Set whether the per-process cross sections are majorants.
+ *
+ * Majorant cross sections bound the cross sections everywhere along the step,
+ * for example in a Woodcock tracking region, so a collision is "virtual" and
+ * must be rejected with a probability based on the local cross section.
+ */
+CELER_FUNCTION void PhysicsStepView::majorant_xs(bool is_majorant)
+{
+    this->state().majorant_xs = is_majorant;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Set whether a failed interaction is being resampled.
+ *
+ * An interaction that could not allocate its secondaries is retried on the
+ * next step at the same position, so the step has zero length even though
+ * the track is not stopped.
+ */
+CELER_FUNCTION void PhysicsStepView::retry_interaction(bool is_retry)
+{
+    this->state().retry_interaction = is_retry;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Save MSC step limit data.
@@ -219,6 +257,24 @@ CELER_FUNCTION ElementComponentId PhysicsStepView::element() const
     return this->state().element;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Whether the per-process cross sections are majorants.
+ */
+CELER_FUNCTION bool PhysicsStepView::majorant_xs() const
+{
+    return this->state().majorant_xs;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether a failed interaction is being resampled.
+ */
+CELER_FUNCTION bool PhysicsStepView::retry_interaction() const
+{
+    return this->state().retry_interaction;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Access calculated MSC step data.
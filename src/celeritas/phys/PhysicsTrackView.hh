@@ -15,6 +15,7 @@
 #include "celeritas/Types.hh"
 #include "celeritas/em/xs/EPlusGGMacroXsCalculator.hh"
 #include "celeritas/em/xs/LivermorePEMacroXsCalculator.hh"
+#include "celeritas/grid/EnergyGridLocator.hh"
 #include "celeritas/grid/GridIdFinder.hh"
 #include "celeritas/grid/XsCalculator.hh"
 #include "celeritas/mat/MaterialView.hh"
@@ -102,12 +103,24 @@ class PhysicsTrackView
                                             const MaterialView& material,
                                             Energy              energy) const;
 
+    // Calculate macroscopic cross section using a cached grid location
+    inline CELER_FUNCTION real_type calc_xs(ParticleProcessId   ppid,
+                                            const MaterialView& material,
+                                            EnergyGridLocator&  locate) const;
+
     // Estimate maximum macroscopic cross section for the process over the step
     inline CELER_FUNCTION real_type calc_max_xs(const IntegralXsProcess& process,
                                                 ParticleProcessId        ppid,
                                                 const MaterialView& material,
                                                 Energy energy) const;
 
+    // Estimate maximum cross section using a cached grid location
+    inline CELER_FUNCTION real_type
+    calc_max_xs(const IntegralXsProcess& process,
+                ParticleProcessId        ppid,
+                const MaterialView&      material,
+                EnergyGridLocator&       locate) const;
+
     // Models that apply to the given process ID
     inline CELER_FUNCTION
         ModelFinder make_model_finder(ParticleProcessId) const;
@@ -203,8 +216,10 @@ PhysicsTrackView::PhysicsTrackView(const PhysicsParamsRef& params,
 CELER_FUNCTION PhysicsTrackView&
 PhysicsTrackView::operator=(const Initializer_t&)
 {
-    this->state().interaction_mfp = 0;
-    this->state().msc_range       = {};
+    this->state().interaction_mfp   = 0;
+    this->state().msc_range         = {};
+    this->state().majorant_xs       = false;
+    this->state().retry_interaction = false;
     return *this;
 }
 
@@ -388,9 +403,25 @@ PhysicsTrackView::integral_xs_process(ParticleProcessId ppid) const
 CELER_FUNCTION real_type PhysicsTrackView::calc_xs(ParticleProcessId   ppid,
                                                    const MaterialView& material,
                                                    Energy energy) const
+{
+    EnergyGridLocator locate(energy);
+    return this->calc_xs(ppid, material, locate);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate macroscopic cross section using a cached grid location.
+ *
+ * Tabulated cross sections reuse the log energy and grid bin of the locator.
+ */
+CELER_FUNCTION real_type
+PhysicsTrackView::calc_xs(ParticleProcessId   ppid,
+                          const MaterialView& material,
+                          EnergyGridLocator&  locate) const
 {
     real_type result = 0;
 
+    const Energy energy = locate.energy();
     if (auto model_id = this->hardwired_model(ppid, energy))
     {
         // Calculate macroscopic cross section on the fly for special
@@ -412,7 +443,7 @@ CELER_FUNCTION real_type PhysicsTrackView::calc_xs(ParticleProcessId   ppid,
     {
         // Calculate cross section from the tabulated data
         auto calc_xs = this->make_calculator<XsCalculator>(grid_id);
-        result       = calc_xs(energy);
+        result       = calc_xs(locate);
     }
 
     CELER_ENSURE(result >= 0);
@@ -440,18 +471,35 @@ PhysicsTrackView::calc_max_xs(const IntegralXsProcess& process,
                               ParticleProcessId        ppid,
                               const MaterialView&      material,
                               Energy                   energy) const
+{
+    EnergyGridLocator locate(energy);
+    return this->calc_max_xs(process, ppid, material, locate);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Estimate maximum cross section using a cached grid location.
+ *
+ * The locator is only used for the cross section at the pre-step energy.
+ */
+CELER_FUNCTION real_type
+PhysicsTrackView::calc_max_xs(const IntegralXsProcess& process,
+                              ParticleProcessId        ppid,
+                              const MaterialView&      material,
+                              EnergyGridLocator&       locate) const
 {
     CELER_EXPECT(process);
     CELER_EXPECT(material_ < process.energy_max_xs.size());
 
-    real_type energy_max_xs
+    const real_type energy = locate.energy().value();
+    real_type       energy_max_xs
         = params_.reals[process.energy_max_xs[material_.get()]];
-    real_type energy_xi = energy.value() * params_.scalars.min_eprime_over_e;
-    if (energy_max_xs >= energy_xi && energy_max_xs < energy.value())
+    real_type energy_xi = energy * params_.scalars.min_eprime_over_e;
+    if (energy_max_xs >= energy_xi && energy_max_xs < energy)
     {
         return this->calc_xs(ppid, material, Energy{energy_max_xs});
     }
-    return max(this->calc_xs(ppid, material, energy),
+    return max(this->calc_xs(ppid, material, locate),
                this->calc_xs(ppid, material, Energy{energy_xi}));
 }
 
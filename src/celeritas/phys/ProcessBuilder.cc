@@ -35,6 +35,7 @@ ProcessBuilder::ProcessBuilder(const ImportData& data,
     : particle_(std::move(particle))
     , material_(std::move(material))
     , brem_combined_(options.brem_combined)
+    , brem_sb_cdf_tables_(options.brem_sb_cdf_tables)
     , enable_lpm_(data.em_params.lpm)
     , use_integral_xs_(data.em_params.integral_approach)
 {
@@ -118,6 +119,7 @@ auto ProcessBuilder::build_ebrems() -> SPProcess
     options.combined_model  = brem_combined_;
     options.enable_lpm      = enable_lpm_;
     options.use_integral_xs = use_integral_xs_;
+    options.sb_cdf_tables   = brem_sb_cdf_tables_;
 
     return std::make_shared<BremsstrahlungProcess>(
         particle_, material_, processes_, read_sb_, options);
@@ -43,6 +43,7 @@ class ProcessBuilder
     struct Options
     {
         bool brem_combined{false};
+        bool brem_sb_cdf_tables{false};
     };
 
   public:
@@ -68,6 +69,7 @@ class ProcessBuilder
     std::function<ImportLivermorePE(AtomicNumber)> read_livermore_;
 
     bool brem_combined_;
+    bool brem_sb_cdf_tables_;
     bool enable_lpm_;
     bool use_integral_xs_;
 
@@ -39,22 +39,26 @@ struct InteractionLauncherImpl
 
     //// METHODS ////
 
-    CELER_FUNCTION void operator()(ThreadId thread) const;
+    CELER_FUNCTION void operator()(ThreadId slot) const;
 };
 
 //---------------------------------------------------------------------------//
 // INLINE DEFINITIONS
 //---------------------------------------------------------------------------//
 /*!
- * Apply the interaction to the track with the given thread ID.
+ * Apply the interaction to the track in the given slot.
+ *
+ * The generated launchers usually only visit the track slots sorted into this
+ * model's action range (see \c TrackSortStateData ), but tracks with other
+ * actions are skipped so that unsorted slots can also be passed.
  */
 template<class D, class F>
 CELER_FUNCTION void
-InteractionLauncherImpl<D, F>::operator()(ThreadId thread) const
+InteractionLauncherImpl<D, F>::operator()(ThreadId slot) const
 {
-    CELER_ASSERT(thread < this->core_data.states.size());
+    CELER_ASSERT(slot < this->core_data.states.size());
     const celeritas::CoreTrackView track(
-        this->core_data.params, this->core_data.states, thread);
+        this->core_data.params, this->core_data.states, slot);
 
     auto sim = track.make_sim_view();
     if (sim.step_limit().action != model_data.ids.action)
@@ -91,9 +95,11 @@ InteractionLauncherImpl<D, F>::operator()(ThreadId thread) const
     {
         auto phys = track.make_physics_view();
         // Particle already moved to the collision site, but an out-of-memory
-        // (allocation failure) occurred. Someday we can add error handling,
-        // but for now use the "failure" action in the physics and set the step
-        // limit to zero since it needs to interact again at this location.
+        // (allocation failure) occurred. Use the "failure" action in the
+        // physics and set the step limit to zero since it needs to interact
+        // again at this location: the stepper grows the secondary storage at
+        // the end of the step and the interaction is resampled at the next
+        // pre-step.
         sim.step_limit({0, phys.scalars().failure_action()});
     }
 }
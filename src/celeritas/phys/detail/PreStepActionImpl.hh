@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "celeritas_config.h"
 #include "corecel/Macros.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/global/CoreTrackView.hh"
@@ -23,17 +24,18 @@ namespace detail
  * Set up the beginning of a physics step.
  *
  * - Reset track properties (todo: move to track initialization?)
+ * - Select the random number stream for this step if the RNG is counter-based
  * - Sample the mean free path and calculate the physics step limits.
+ * - Retry an interaction that failed to allocate secondaries during the
+ *   previous step: the track is already at the collision site, so the step
+ *   limit is zero and the discrete interaction is resampled.
+ *
+ * The secondary stack is cleared by the stepper before the step's actions are
+ * executed, since this may run concurrently with interactions on other track
+ * slots when actions are fused.
  */
 inline CELER_FUNCTION void pre_step_track(celeritas::CoreTrackView const& track)
 {
-    if (track.thread_id() == ThreadId{0})
-    {
-        // Clear secondary storage on a single thread
-        auto alloc = track.make_physics_step_view().make_secondary_allocator();
-        alloc.clear();
-    }
-
     auto sim = track.make_sim_view();
     if (sim.status() == TrackStatus::inactive)
     {
@@ -50,14 +52,32 @@ inline CELER_FUNCTION void pre_step_track(celeritas::CoreTrackView const& track)
 
     auto step = track.make_physics_step_view();
     {
-        // Clear out energy deposition, secondary pointers, and sampled element
+        // Clear out energy deposition, secondary pointers, sampled element,
+        // majorant cross sections from a previous Woodcock step, and retry
         step.reset_energy_deposition();
         step.secondaries({});
         step.element({});
+        step.majorant_xs(false);
+        step.retry_interaction(false);
     }
 
+#if CELERITAS_RNG == CELERITAS_RNG_PHILOX
+    {
+        // Key the random numbers on the event, track lineage, and step
+        // rather than the track slot
+        RngEngine::Initializer_t init;
+        init.event_id = sim.event_id().get();
+        init.lineage  = sim.lineage();
+        init.step     = sim.num_steps();
+
+        auto rng = track.make_rng_engine();
+        rng      = init;
+    }
+#endif
+
     // Sample mean free path
-    auto phys = track.make_physics_view();
+    auto phys  = track.make_physics_view();
+    bool retry = (sim.step_limit().action == phys.scalars().failure_action());
     if (!phys.has_interaction_mfp())
     {
         auto                               rng = track.make_rng_engine();
@@ -69,6 +89,13 @@ inline CELER_FUNCTION void pre_step_track(celeritas::CoreTrackView const& track)
     auto      mat      = track.make_material_view();
     auto      particle = track.make_particle_view();
     StepLimit limit    = calc_physics_step_limit(mat, particle, phys, step);
+    if (CELER_UNLIKELY(retry))
+    {
+        // Interact again without moving
+        limit.step   = 0;
+        limit.action = phys.scalars().discrete_action();
+        step.retry_interaction(true);
+    }
     sim.reset_step_limit(limit);
 }
 
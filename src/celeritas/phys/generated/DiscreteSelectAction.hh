@@ -18,7 +18,7 @@ namespace celeritas
 namespace generated
 {
 //---------------------------------------------------------------------------//
-class DiscreteSelectAction final : public ExplicitActionInterface, public ConcreteAction
+class DiscreteSelectAction final : public FusibleActionInterface, public ConcreteAction
 {
 public:
   // Construct with ID and label
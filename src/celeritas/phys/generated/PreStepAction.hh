@@ -18,7 +18,7 @@ namespace celeritas
 namespace generated
 {
 //---------------------------------------------------------------------------//
-class PreStepAction final : public ExplicitActionInterface, public ConcreteAction
+class PreStepAction final : public FusibleActionInterface, public ConcreteAction
 {
 public:
   // Construct with ID and label
@@ -146,4 +146,15 @@ void resize(CuHipRngStateData<Ownership::value, M>* state,
             const HostCRef<CuHipRngParamsData>&     params,
             size_type                               size);
 
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a function to the persistent per-track collections of the state.
+ */
+template<Ownership W, MemSpace M, class F>
+inline void
+for_each_track_items(const CuHipRngStateData<W, M>& state, F&& visit)
+{
+    visit(state.rng);
+}
+
 } // namespace celeritas
@@ -0,0 +1,71 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/random/PhiloxRngData.cc
+//---------------------------------------------------------------------------//
+#include "PhiloxRngData.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/data/CollectionBuilder.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Resize and initialize with the seed stored in params.
+ *
+ * The second key word is set to the maximum value, which is never a valid
+ * event ID, so that the initial per-slot streams never overlap with the
+ * per-track streams.
+ */
+template<MemSpace M>
+void resize(PhiloxRngStateData<Ownership::value, M>* state,
+            const HostCRef<PhiloxRngParamsData>&     params,
+            size_type                                size)
+{
+    CELER_EXPECT(size > 0);
+    CELER_EXPECT(params);
+
+    using uint_t = PhiloxState::uint_t;
+
+    HostVal<PhiloxRngStateData> host_state;
+    resize(&host_state.state, size);
+
+    uint_t slot = 0;
+    for (PhiloxState& init : host_state.state[AllItems<PhiloxState>{}])
+    {
+        init.key     = {params.seed[0], static_cast<uint_t>(-1)};
+        init.counter = {0, 0, slot++, 0};
+        init.output  = {0, 0, 0, 0};
+        init.index   = 4;
+    }
+
+    // Move or copy to input
+    if (M == MemSpace::host)
+    {
+        state->state = std::move(host_state.state);
+    }
+    else
+    {
+        *state = host_state;
+    }
+
+    CELER_ENSURE(*state);
+    CELER_ENSURE(state->size() == size);
+}
+
+//---------------------------------------------------------------------------//
+// Explicit instantiations
+template void resize(HostVal<PhiloxRngStateData>*,
+                     const HostCRef<PhiloxRngParamsData>&,
+                     size_type);
+
+template void resize(PhiloxRngStateData<Ownership::value, MemSpace::device>*,
+                     const HostCRef<PhiloxRngParamsData>&,
+                     size_type);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
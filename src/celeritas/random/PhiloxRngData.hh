@@ -0,0 +1,138 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/random/PhiloxRngData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/data/Collection.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Persistent data for the Philox generator.
+ *
+ * The seed is the first word of the Philox key and is shared by all streams.
+ */
+template<Ownership W, MemSpace M>
+struct PhiloxRngParamsData
+{
+    Array<unsigned int, 1> seed;
+
+    //// METHODS ////
+
+    //! Whether the data is assigned
+    explicit CELER_FUNCTION operator bool() const { return true; }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    PhiloxRngParamsData& operator=(const PhiloxRngParamsData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        seed = other.seed;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Individual RNG state.
+ *
+ * The key is (seed, event) and the counter is (block, step, track, 0), where
+ * the block is incremented each time four new 32-bit values are generated.
+ * The most recently generated block is buffered in \c output .
+ */
+struct PhiloxState
+{
+    using uint_t = unsigned int;
+    static_assert(sizeof(uint_t) == 4, "Expected 32-bit int");
+
+    Array<uint_t, 2> key;
+    Array<uint_t, 4> counter;
+    Array<uint_t, 4> output;
+    uint_t           index; //!< Next output element, 4 if exhausted
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Select an independent random stream for a step of a track.
+ *
+ * The stream is a function only of the seed and the values here, so it does
+ * not depend on the track slot, the number of track slots, or the thread.
+ * Tracks are identified by their 64-bit lineage rather than their track ID,
+ * since secondary track IDs are assigned in a nondeterministic order.
+ */
+struct PhiloxRngInitializer
+{
+    using uint_t = PhiloxState::uint_t;
+
+    uint_t  event_id{0};
+    ull_int lineage{0};
+    uint_t  step{0};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Philox generator states for all threads.
+ */
+template<Ownership W, MemSpace M>
+struct PhiloxRngStateData
+{
+    //// TYPES ////
+
+    template<class T>
+    using StateItems = StateCollection<T, W, M>;
+
+    //// DATA ////
+
+    StateItems<PhiloxState> state; //!< Track state [track]
+
+    //// METHODS ////
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const { return !state.empty(); }
+
+    //! State size
+    CELER_FUNCTION size_type size() const { return state.size(); }
+
+    //! Assign from another set of states
+    template<Ownership W2, MemSpace M2>
+    PhiloxRngStateData& operator=(PhiloxRngStateData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        state = other.state;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Resize and seed the RNG states.
+ *
+ * Until a state is assigned a \c PhiloxRngInitializer, it draws from a stream
+ * keyed on its track slot that is distinct from all per-track streams.
+ */
+template<MemSpace M>
+void resize(PhiloxRngStateData<Ownership::value, M>* state,
+            const HostCRef<PhiloxRngParamsData>&     params,
+            size_type                                size);
+
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a function to the persistent per-track collections of the state.
+ */
+template<Ownership W, MemSpace M, class F>
+inline void
+for_each_track_items(const PhiloxRngStateData<W, M>& state, F&& visit)
+{
+    visit(state.state);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,172 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/random/PhiloxRngEngine.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/OpaqueId.hh"
+#include "corecel/Types.hh"
+#include "corecel/sys/ThreadId.hh"
+
+#include "PhiloxRngData.hh"
+#include "detail/GenerateCanonical32.hh"
+#include "distribution/GenerateCanonical.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Generate random data using the Philox4x32-10 counter-based algorithm.
+ *
+ * Each block of four 32-bit values is a bijection of a 128-bit counter and a
+ * 64-bit key, so a stream is completely determined by its key and starting
+ * counter rather than by the history of a particular track slot. Assigning a
+ * \c PhiloxRngInitializer selects the stream for one step of one track:
+ * \code
+    auto rng = track.make_rng_engine();
+    rng = PhiloxRngInitializer{event_id, lineage, num_steps};
+   \endcode
+ * Up to \f$ 2^{34} \f$ values can be drawn from each stream.
+ *
+ * See Salmon et al., "Parallel random numbers: as easy as 1, 2, 3" (SC11).
+ * https://doi.org/10.1145/2063384.2063405
+ */
+class PhiloxRngEngine
+{
+  public:
+    //!@{
+    //! Type aliases
+    using result_type   = unsigned int;
+    using Initializer_t = PhiloxRngInitializer;
+    using StateRef      = NativeRef<PhiloxRngStateData>;
+    using uint_t        = PhiloxState::uint_t;
+    using Block         = Array<uint_t, 4>;
+    using Key           = Array<uint_t, 2>;
+    //!@}
+
+  public:
+    //! Lowest value potentially generated
+    static CELER_CONSTEXPR_FUNCTION result_type min() { return 0u; }
+    //! Highest value potentially generated
+    static CELER_CONSTEXPR_FUNCTION result_type max() { return 0xffffffffu; }
+
+    // Apply the Philox4x32-10 bijection to a counter
+    static inline CELER_FUNCTION Block philox(Block counter, Key key);
+
+    // Construct from state
+    inline CELER_FUNCTION
+    PhiloxRngEngine(const StateRef& state, const ThreadId& id);
+
+    // Select the stream for a step of a track
+    inline CELER_FUNCTION PhiloxRngEngine& operator=(const Initializer_t& s);
+
+    // Generate a 32-bit pseudorandom number
+    inline CELER_FUNCTION result_type operator()();
+
+  private:
+    PhiloxState* state_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Specialization of GenerateCanonical for PhiloxRngEngine.
+ */
+template<class RealType>
+class GenerateCanonical<PhiloxRngEngine, RealType>
+{
+  public:
+    //!@{
+    //! Type aliases
+    using real_type   = RealType;
+    using result_type = RealType;
+    //!@}
+
+  public:
+    //! Sample a random number on [0, 1)
+    CELER_FORCEINLINE_FUNCTION result_type operator()(PhiloxRngEngine& rng)
+    {
+        return detail::GenerateCanonical32<RealType>()(rng);
+    }
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the Philox4x32-10 bijection to a counter.
+ */
+CELER_FUNCTION auto PhiloxRngEngine::philox(Block counter, Key key) -> Block
+{
+    constexpr ull_int mult[] = {0xd2511f53u, 0xcd9e8d57u};
+    constexpr uint_t  weyl[] = {0x9e3779b9u, 0xbb67ae85u};
+
+    for (int round = 0; round < 10; ++round)
+    {
+        if (round > 0)
+        {
+            key[0] += weyl[0];
+            key[1] += weyl[1];
+        }
+        const ull_int prod0 = mult[0] * counter[0];
+        const ull_int prod1 = mult[1] * counter[2];
+
+        counter = {static_cast<uint_t>(prod1 >> 32u) ^ counter[1] ^ key[0],
+                   static_cast<uint_t>(prod1),
+                   static_cast<uint_t>(prod0 >> 32u) ^ counter[3] ^ key[1],
+                   static_cast<uint_t>(prod0)};
+    }
+    return counter;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from state.
+ */
+CELER_FUNCTION
+PhiloxRngEngine::PhiloxRngEngine(const StateRef& state, const ThreadId& id)
+{
+    CELER_EXPECT(id < state.state.size());
+    state_ = &state.state[id];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Select the stream for a step of a track.
+ *
+ * The seed is retained from the original state.
+ */
+CELER_FUNCTION PhiloxRngEngine&
+PhiloxRngEngine::operator=(const Initializer_t& s)
+{
+    state_->key[1]  = s.event_id;
+    state_->counter = {0,
+                       s.step,
+                       static_cast<uint_t>(s.lineage),
+                       static_cast<uint_t>(s.lineage >> 32u)};
+    state_->index   = 4;
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Generate a 32-bit pseudorandom number.
+ *
+ * A new block of four values is generated when the buffered one is exhausted.
+ */
+CELER_FUNCTION auto PhiloxRngEngine::operator()() -> result_type
+{
+    if (state_->index == 4)
+    {
+        state_->output = philox(state_->counter, state_->key);
+        ++state_->counter[0];
+        state_->index = 0;
+    }
+    return state_->output[state_->index++];
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,25 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/random/PhiloxRngParams.cc
+//---------------------------------------------------------------------------//
+#include "PhiloxRngParams.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a low-entropy seed.
+ */
+PhiloxRngParams::PhiloxRngParams(unsigned int seed)
+{
+    HostVal<PhiloxRngParamsData> host_data;
+    host_data.seed = {seed};
+    CELER_ASSERT(host_data);
+    data_ = CollectionMirror<PhiloxRngParamsData>{std::move(host_data)};
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
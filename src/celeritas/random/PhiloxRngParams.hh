@@ -0,0 +1,46 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/random/PhiloxRngParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Types.hh"
+#include "corecel/data/CollectionMirror.hh"
+
+#include "PhiloxRngData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Shared data for the Philox counter-based random number generator.
+ */
+class PhiloxRngParams
+{
+  public:
+    //!@{
+    //! References to constructed data
+    using HostRef   = HostCRef<PhiloxRngParamsData>;
+    using DeviceRef = DeviceCRef<PhiloxRngParamsData>;
+    //!@}
+
+  public:
+    // Construct with a low-entropy seed
+    explicit PhiloxRngParams(unsigned int seed);
+
+    //! Access RNG properties on the host
+    const HostRef& host_ref() const { return data_.host(); }
+
+    //! Access RNG properties on the device
+    const DeviceRef& device_ref() const { return data_.device(); }
+
+  private:
+    // Host/device storage and reference
+    CollectionMirror<PhiloxRngParamsData> data_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
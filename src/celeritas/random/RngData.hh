@@ -30,5 +30,14 @@ using RngParamsData = XorwowRngParamsData<W, M>;
 template<Ownership W, MemSpace M>
 using RngStateData = XorwowRngStateData<W, M>;
 } // namespace celeritas
+#elif (CELERITAS_RNG == CELERITAS_RNG_PHILOX)
+#    include "PhiloxRngData.hh"
+namespace celeritas
+{
+template<Ownership W, MemSpace M>
+using RngParamsData = PhiloxRngParamsData<W, M>;
+template<Ownership W, MemSpace M>
+using RngStateData = PhiloxRngStateData<W, M>;
+} // namespace celeritas
 #endif
 // IWYU pragma: end_exports
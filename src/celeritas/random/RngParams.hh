@@ -15,6 +15,8 @@
 #    include "CuHipRngParams.hh"
 #elif (CELERITAS_RNG == CELERITAS_RNG_XORWOW)
 #    include "XorwowRngParams.hh"
+#elif (CELERITAS_RNG == CELERITAS_RNG_PHILOX)
+#    include "PhiloxRngParams.hh"
 #endif
 
 #include "RngParamsFwd.hh"
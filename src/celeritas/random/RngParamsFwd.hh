@@ -20,5 +20,8 @@ using RngParams = CuHipRngParams;
 #elif (CELERITAS_RNG == CELERITAS_RNG_XORWOW)
 class XorwowRngParams;
 using RngParams = XorwowRngParams;
+#elif (CELERITAS_RNG == CELERITAS_RNG_PHILOX)
+class PhiloxRngParams;
+using RngParams = PhiloxRngParams;
 #endif
 } // namespace celeritas
@@ -104,5 +104,16 @@ void resize(XorwowRngStateData<Ownership::value, M>* state,
             const HostCRef<XorwowRngParamsData>&     params,
             size_type                                size);
 
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a function to the persistent per-track collections of the state.
+ */
+template<Ownership W, MemSpace M, class F>
+inline void
+for_each_track_items(const XorwowRngStateData<W, M>& state, F&& visit)
+{
+    visit(state.state);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -30,6 +30,7 @@ struct SimTrackState
     TrackId   track_id;     //!< Unique ID for this track
     TrackId   parent_id;    //!< ID of parent that created it
     EventId   event_id;     //!< ID of originating event
+    ull_int   lineage{0};   //!< Reproducible key derived from ancestry
     size_type num_steps{0}; //!< Total number of steps taken
     real_type time{0}; //!< Time elapsed in lab frame since start of event [s]
 
@@ -91,5 +92,15 @@ void resize(SimStateData<Ownership::value, M>* data, size_type size)
     CELER_ENSURE(*data);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a function to the persistent per-track collections of the state.
+ */
+template<Ownership W, MemSpace M, class F>
+inline void for_each_track_items(const SimStateData<W, M>& state, F&& visit)
+{
+    visit(state.state);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
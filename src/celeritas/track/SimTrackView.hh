@@ -73,6 +73,9 @@ class SimTrackView
     // Event ID
     CELER_FORCEINLINE_FUNCTION EventId event_id() const;
 
+    // Reproducible key derived from the track's ancestry
+    CELER_FORCEINLINE_FUNCTION ull_int lineage() const;
+
     // Total number of steps taken by the track
     CELER_FORCEINLINE_FUNCTION size_type num_steps() const;
 
@@ -246,6 +249,19 @@ CELER_FUNCTION EventId SimTrackView::event_id() const
     return states_.state[thread_].event_id;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Reproducible key derived from the track's ancestry.
+ *
+ * Unlike the track ID, which is assigned to secondaries in the order they are
+ * processed, this depends only on the primary's track ID and the step and
+ * index at which each ancestor was created.
+ */
+CELER_FUNCTION ull_int SimTrackView::lineage() const
+{
+    return states_.state[thread_].lineage;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Total number of steps taken by the track.
@@ -0,0 +1,44 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/SortTracksAction.cc
+//---------------------------------------------------------------------------//
+#include "SortTracksAction.hh"
+
+#include "corecel/Assert.hh"
+#include "celeritas/global/CoreTrackData.hh"
+
+#include "detail/TrackSortAlgorithms.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sort tracks on host.
+ *
+ * When actions are fused, the interactions visit every track slot in their
+ * chunk rather than the sorted ranges, so sorting is skipped.
+ */
+void SortTracksAction::execute(CoreHostRef const& data) const
+{
+    CELER_EXPECT(data);
+    if (!data.fused_slots.empty())
+        return;
+
+    detail::sort_by_action(data.states.sim, data.states.sort);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sort tracks on device.
+ */
+void SortTracksAction::execute(CoreDeviceRef const& data) const
+{
+    CELER_EXPECT(data);
+    detail::sort_by_action(data.states.sim, data.states.sort, data.scratch);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,41 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/SortTracksAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "celeritas/global/ActionInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Partition track slots by their post-step action.
+ *
+ * This is executed after the discrete interaction has been selected so that
+ * each post-step model kernel can be launched over only the contiguous range
+ * of tracks that it applies to rather than over every track slot. The sorted
+ * ranges are stored in \c TrackSortStateData .
+ */
+class SortTracksAction final : public FusibleActionInterface,
+                               public ConcreteAction
+{
+  public:
+    // Construct with ID and label
+    using ConcreteAction::ConcreteAction;
+
+    // Sort tracks on host
+    void execute(CoreHostRef const&) const final;
+
+    // Sort tracks on device
+    void execute(CoreDeviceRef const&) const final;
+
+    //! Dependency ordering of the action
+    ActionOrder order() const final { return ActionOrder::sort_post; }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
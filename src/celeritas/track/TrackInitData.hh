@@ -7,9 +7,12 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <vector>
+
 #include "corecel/Types.hh"
 #include "corecel/data/Collection.hh"
 #include "corecel/data/CollectionBuilder.hh"
+#include "corecel/data/PinnedAllocator.hh"
 #include "corecel/sys/Device.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "orange/Types.hh"
@@ -66,6 +69,18 @@ struct TrackInitializer
     ParticleTrackInitializer particle;
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Host storage for track initializers that do not fit in the state.
+ *
+ * When the state's initializer storage overflows, the oldest initializers
+ * (which are the last to be used) are spilled to the back of this buffer.
+ * They are copied back in batches when the state runs low, so tracks are
+ * initialized in the same order as they would be with unlimited capacity.
+ */
+using TrackInitSpill
+    = std::vector<TrackInitializer, PinnedAllocator<TrackInitializer>>;
+
 //---------------------------------------------------------------------------//
 /*!
  * StateCollection with a fixed capacity and dynamic size.
@@ -13,6 +13,7 @@
 #include "corecel/data/Ref.hh"
 #include "corecel/math/Algorithms.hh"
 #include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/global/StepScratchArena.hh"
 
 #include "TrackInitData.hh"
 #include "detail/TrackInitAlgorithms.hh"
@@ -25,30 +26,183 @@ namespace celeritas
 {
 //---------------------------------------------------------------------------//
 // HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Move a range of track initializers within the state's storage.
+ *
+ * The source and destination may overlap, so the initializers are copied
+ * through the step's scratch memory if available, or temporary storage
+ * otherwise.
+ */
+template<MemSpace M>
+inline void move_initializers(CoreRef<M>& core_data,
+                              size_type   src,
+                              size_type   dst,
+                              size_type   count)
+{
+    auto inits = core_data.states.init.initializers.data();
+    CELER_EXPECT(src + count <= inits.size() && dst + count <= inits.size());
+
+    if (count == 0 || src == dst)
+        return;
+
+    Collection<TrackInitializer, Ownership::value, M> temp_storage;
+    Span<TrackInitializer>                            temp;
+    if (core_data.scratch)
+    {
+        temp = core_data.scratch->template allocate<TrackInitializer>(count);
+    }
+    else
+    {
+        resize(&temp_storage, count);
+        temp = temp_storage[AllItems<TrackInitializer, M>{}];
+    }
+
+    Copier<TrackInitializer, M> copy_to_temp{inits.subspan(src, count)};
+    copy_to_temp(M, temp);
+    Copier<TrackInitializer, M> copy_from_temp{temp};
+    copy_from_temp(M, inits.subspan(dst, count));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move the oldest track initializers from the state to the host spill buffer.
+ *
+ * Initializers are used from the back of the state's storage, so the ones at
+ * the front are spilled, and the rest are moved down to take their place.
+ */
+template<MemSpace M>
+inline void spill_initializers(CoreRef<M>&     core_data,
+                               TrackInitSpill* spill,
+                               size_type       count)
+{
+    CELER_EXPECT(spill);
+
+    auto& inits = core_data.states.init.initializers;
+    CELER_EXPECT(count <= inits.size());
+
+    // Append the oldest initializers to the spill buffer
+    size_type start = spill->size();
+    spill->resize(start + count);
+    Copier<TrackInitializer, M> copy{inits.data().subspan(0, count)};
+    copy(MemSpace::host, make_span(*spill).subspan(start, count));
+
+    move_initializers(core_data, count, 0, inits.size() - count);
+    inits.resize(inits.size() - count);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Return as many spilled track initializers as fit to the state.
+ *
+ * The most recently spilled initializers are inserted at the front of the
+ * state's storage, below the initializers that are already there.
+ */
+template<MemSpace M>
+inline void refill_initializers(CoreRef<M>& core_data, TrackInitSpill* spill)
+{
+    CELER_EXPECT(spill);
+
+    auto&     inits = core_data.states.init.initializers;
+    size_type count
+        = min<size_type>(spill->size(), inits.capacity() - inits.size());
+    if (count == 0)
+        return;
+
+    size_type num_resident = inits.size();
+    inits.resize(num_resident + count);
+    move_initializers(core_data, 0, count, num_resident);
+
+    size_type start = spill->size() - count;
+    Copier<TrackInitializer, MemSpace::host> copy{
+        make_span(*spill).subspan(start, count)};
+    copy(M, inits.data().subspan(0, count));
+    spill->resize(start);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create track initializers from primaries already in the state's memory.
+ *
+ * The primaries are read by a (possibly asynchronous) kernel launch, so their
+ * storage must not be modified until the end of the step. If the optional
+ * spill buffer is given, older initializers are spilled to host to make room
+ * as needed, and the primaries are processed in batches if they exceed the
+ * capacity.
+ */
+template<MemSpace M>
+inline void extend_from_staged_primaries(CoreRef<M>&         core_data,
+                                         Span<const Primary> primaries,
+                                         TrackInitSpill*     spill = nullptr)
+{
+    CELER_EXPECT(core_data);
+    CELER_EXPECT(!primaries.empty());
+
+    auto& data = core_data.states.init;
+
+    // The newest initializers are no longer secondaries with a parent track
+    data.num_secondaries = 0;
+
+    const size_type capacity = data.initializers.capacity();
+    CELER_VALIDATE(spill
+                       || data.initializers.size() + primaries.size()
+                              <= capacity,
+                   << "insufficient initializer capacity (" << capacity
+                   << ") with size (" << data.initializers.size()
+                   << ") for primaries (" << primaries.size() << ")");
+
+    while (!primaries.empty())
+    {
+        size_type count    = min<size_type>(primaries.size(), capacity);
+        size_type required = data.initializers.size() + count;
+        if (required > capacity)
+        {
+            spill_initializers(core_data, spill, required - capacity);
+        }
+        data.initializers.resize(data.initializers.size() + count);
+
+        // Create track initializers from primaries
+        generated::process_primaries(core_data, primaries.subspan(0, count));
+        primaries = primaries.subspan(count, primaries.size() - count);
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Create track initializers from a vector of host primary particles.
+ *
+ * The primaries are copied synchronously into the step's scratch memory if
+ * available, or into temporary storage otherwise. \c Stepper instead uses
+ * persistent staging buffers and an asynchronous copy.
  */
 template<MemSpace M>
-inline void
-extend_from_primaries(CoreRef<M>& core_data, Span<const Primary> host_primaries)
+inline void extend_from_primaries(CoreRef<M>&         core_data,
+                                  Span<const Primary> host_primaries,
+                                  TrackInitSpill*     spill = nullptr)
 {
     CELER_EXPECT(core_data);
     CELER_EXPECT(!host_primaries.empty());
 
-    auto& data = core_data.states.init;
-    CELER_ASSERT(host_primaries.size() + data.initializers.size()
-                 <= data.initializers.capacity());
-    data.initializers.resize(data.initializers.size() + host_primaries.size());
+    Collection<Primary, Ownership::value, M> temp_primaries;
+    Span<Primary>                            primaries;
+    if (core_data.scratch)
+    {
+        primaries = core_data.scratch->template allocate<Primary>(
+            host_primaries.size());
+    }
+    else
+    {
+        resize(&temp_primaries, host_primaries.size());
+        primaries = temp_primaries[AllItems<Primary, M>{}];
+    }
 
-    // Allocate memory and copy primaries
-    Collection<Primary, Ownership::value, M> primaries;
-    resize(&primaries, host_primaries.size());
+    // Copy primaries
     Copier<Primary, MemSpace::host> copy{host_primaries};
-    copy(M, primaries[AllItems<Primary, M>{}]);
+    copy(M, primaries);
 
     // Create track initializers from primaries
-    generated::process_primaries(core_data, primaries[AllItems<Primary, M>{}]);
+    extend_from_staged_primaries(
+        core_data, Span<const Primary>{primaries}, spill);
 }
 
 //---------------------------------------------------------------------------//
@@ -59,26 +213,41 @@ extend_from_primaries(CoreRef<M>& core_data, Span<const Primary> host_primaries)
  * state copied over from the parent instead of initialized from the position.
  * If there are more empty slots than new secondaries, they will be filled by
  * any track initializers remaining from previous steps using the position.
+ *
+ * If the optional spill buffer is given, spilled initializers are returned to
+ * the state whenever there are fewer initializers than empty slots.
  */
 template<MemSpace M>
-inline void initialize_tracks(CoreRef<M>& core_data)
+inline void initialize_tracks(CoreRef<M>& core_data,
+                              TrackInitSpill* spill = nullptr)
 {
     CELER_EXPECT(core_data);
 
     auto& data = core_data.states.init;
 
-    // The number of new tracks to initialize is the smaller of the number of
-    // empty slots in the track vector and the number of track initializers
-    size_type num_tracks
-        = std::min(data.vacancies.size(), data.initializers.size());
-    if (num_tracks > 0)
+    while (true)
     {
-        // Launch a kernel to initialize tracks on device
-        auto num_vacancies
+        if (spill && data.initializers.size() < data.vacancies.size())
+        {
+            refill_initializers(core_data, spill);
+        }
+
+        // The number of new tracks to initialize is the smaller of the number
+        // of empty slots in the track vector and the number of track
+        // initializers
+        size_type num_tracks
             = min(data.vacancies.size(), data.initializers.size());
-        generated::init_tracks(core_data, num_vacancies);
+        if (num_tracks == 0)
+            break;
+
+        // Launch a kernel to initialize tracks on device
+        generated::init_tracks(core_data, num_tracks);
         data.initializers.resize(data.initializers.size() - num_tracks);
         data.vacancies.resize(data.vacancies.size() - num_tracks);
+
+        // Any initializers for the remaining empty slots must come from the
+        // spill buffer, so they have no parent in this step
+        data.num_secondaries = 0;
     }
 }
 
@@ -138,9 +307,13 @@ inline void initialize_tracks(CoreRef<M>& core_data)
    vacancies          | 1  4
 
    \endverbatim
+ *
+ * If the optional spill buffer is given and the new initializers don't fit,
+ * the oldest initializers are spilled to host to make room.
  */
 template<MemSpace M>
-inline void extend_from_secondaries(CoreRef<M>& core_data)
+inline void extend_from_secondaries(CoreRef<M>&     core_data,
+                                    TrackInitSpill* spill = nullptr)
 {
     CELER_EXPECT(core_data);
 
@@ -155,7 +328,8 @@ inline void extend_from_secondaries(CoreRef<M>& core_data)
 
     // Remove all elements in the vacancy vector that were flagged as active
     // tracks, leaving the (sorted) indices of the empty slots
-    size_type num_vac = detail::remove_if_alive<M>(data.vacancies.data());
+    size_type num_vac = detail::remove_if_alive<M>(data.vacancies.data(),
+                                                   core_data.scratch);
     data.vacancies.resize(num_vac);
 
     // The exclusive prefix sum of the number of secondaries produced by each
@@ -164,17 +338,22 @@ inline void extend_from_secondaries(CoreRef<M>& core_data)
     // initializers from all surviving secondaries produced in its
     // interaction.
     data.num_secondaries = detail::exclusive_scan_counts<M>(
-        data.secondary_counts[AllItems<size_type, M>{}]);
+        data.secondary_counts[AllItems<size_type, M>{}], core_data.scratch);
 
-    // TODO: if we don't have space for all the secondaries, we will need to
-    // buffer the current track initializers to create room
-    CELER_VALIDATE(data.num_secondaries + data.initializers.size()
-                       <= data.initializers.capacity(),
-                   << "insufficient capacity (" << data.initializers.capacity()
+    // Spill the oldest initializers to host if the new ones don't fit
+    const size_type capacity = data.initializers.capacity();
+    size_type       required = data.num_secondaries + data.initializers.size();
+    if (spill && required > capacity && data.num_secondaries <= capacity)
+    {
+        spill_initializers(core_data, spill, required - capacity);
+        required = capacity;
+    }
+    CELER_VALIDATE(required <= capacity,
+                   << "insufficient capacity (" << capacity
                    << ") for track initializers (created "
                    << data.num_secondaries
                    << " new secondaries for a total capacity requirement of "
-                   << data.num_secondaries + data.initializers.size() << ")");
+                   << required << ")");
 
     // Launch a kernel to create track initializers from secondaries
     data.initializers.resize(data.initializers.size() + data.num_secondaries);
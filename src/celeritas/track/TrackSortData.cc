@@ -0,0 +1,95 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/TrackSortData.cc
+//---------------------------------------------------------------------------//
+#include "TrackSortData.hh"
+
+#include "celeritas_config.h"
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+
+#include "corecel/Assert.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
+#include "corecel/data/CollectionBuilder.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Number of independently counted chunks of track slots.
+ *
+ * On host, each OpenMP thread counts a contiguous chunk of slots into its own
+ * row of the scratch space. On device, a single row is updated atomically.
+ */
+size_type num_sort_chunks(MemSpace m)
+{
+#if CELERITAS_USE_OPENMP
+    if (m == MemSpace::host)
+    {
+        return omp_get_max_threads();
+    }
+#else
+    (void)sizeof(m);
+#endif
+    return 1;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Resize the sorting data and set the initial slot ordering to identity.
+ *
+ * Every action ID below \c num_actions gets its own range of sorted threads.
+ * All ranges are empty until the first sort.
+ */
+template<MemSpace M>
+void resize(TrackSortStateData<Ownership::value, M>* data,
+            ActionId::size_type                      num_actions,
+            size_type                                size)
+{
+    CELER_EXPECT(data);
+    CELER_EXPECT(num_actions > 0);
+    CELER_EXPECT(size > 0);
+
+    // Initialize slot ordering to identity
+    StateCollection<ThreadId, Ownership::value, MemSpace::host> track_slots;
+    resize(&track_slots, size);
+    for (auto i : range(size))
+    {
+        track_slots[ThreadId{i}] = ThreadId{i};
+    }
+    data->track_slots = track_slots;
+
+    // Allocate scratch space for counting: one extra bucket for tracks
+    // without a valid post-step action
+    const size_type num_buckets = num_actions + 1;
+    resize(&data->counts, num_sort_chunks(M) * num_buckets);
+
+    // Start with every action range empty
+    resize(&data->offsets, num_buckets + 1);
+    fill(ThreadId::size_type(0), &data->offsets);
+
+    CELER_ENSURE(*data);
+    CELER_ENSURE(data->num_actions() == num_actions);
+}
+
+//---------------------------------------------------------------------------//
+// Explicit instantiations
+template void resize(HostVal<TrackSortStateData>*,
+                     ActionId::size_type,
+                     size_type);
+
+template void resize(TrackSortStateData<Ownership::value, MemSpace::device>*,
+                     ActionId::size_type,
+                     size_type);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,112 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/TrackSortData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/sys/ThreadId.hh"
+#include "celeritas/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Track slot indices partitioned by post-step action.
+ *
+ * After the tracks are sorted (see \c SortTracksAction ), the track slots for
+ * each post-step action are stored contiguously so that an action's kernel can
+ * be launched over only the tracks it applies to.
+ * - \c track_slots maps a "sorted thread" index to a track slot
+ * - \c counts is scratch space for the counting sort: one row of per-action
+ *   counts for each chunk of track slots on host, or a single row on device
+ * - \c offsets is the start of each action's range in \c track_slots, always
+ *   stored in host memory so that kernel launches can be sized. The last
+ *   bucket holds tracks with no valid post-step action.
+ */
+template<Ownership W, MemSpace M>
+struct TrackSortStateData
+{
+    //// TYPES ////
+
+    template<class T>
+    using Items = Collection<T, W, M>;
+    template<class T>
+    using StateItems = StateCollection<T, W, M>;
+    template<class T>
+    using HostActionItems = Collection<T, W, MemSpace::host, ActionId>;
+
+    //// DATA ////
+
+    StateItems<ThreadId>                 track_slots;
+    Items<ThreadId::size_type>           counts;
+    HostActionItems<ThreadId::size_type> offsets;
+
+    //// METHODS ////
+
+    //! Whether the data are assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !track_slots.empty() && !counts.empty() && offsets.size() >= 2;
+    }
+
+    //! State size
+    CELER_FUNCTION size_type size() const { return track_slots.size(); }
+
+    //! Number of actions that can be partitioned
+    CELER_FUNCTION ActionId::size_type num_actions() const
+    {
+        return offsets.size() - 2;
+    }
+
+    //! Number of sorting bins, including one for unassigned actions
+    CELER_FUNCTION size_type num_buckets() const { return offsets.size() - 1; }
+
+    // Sorted thread indices for tracks whose post-step action is the given ID
+    inline Range<ThreadId> action_threads(ActionId action) const;
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    TrackSortStateData& operator=(TrackSortStateData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        track_slots = other.track_slots;
+        counts      = other.counts;
+        offsets     = other.offsets;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// Resize and set identity ordering
+template<MemSpace M>
+void resize(TrackSortStateData<Ownership::value, M>* data,
+            ActionId::size_type                      num_actions,
+            size_type                                size);
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Sorted thread indices for tracks whose post-step action is the given ID.
+ *
+ * This is a host-only function since the offsets are in host memory. The
+ * resulting thread IDs index into \c track_slots .
+ */
+template<Ownership W, MemSpace M>
+Range<ThreadId>
+TrackSortStateData<W, M>::action_threads(ActionId action) const
+{
+    CELER_EXPECT(action < this->num_actions());
+    return {ThreadId{offsets[action]}, ThreadId{offsets[action + 1]}};
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
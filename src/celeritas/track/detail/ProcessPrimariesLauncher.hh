@@ -62,6 +62,7 @@ CELER_FUNCTION void ProcessPrimariesLauncher<M>::operator()(ThreadId tid) const
     ti.sim.track_id         = primary.track_id;
     ti.sim.parent_id        = TrackId{};
     ti.sim.event_id         = primary.event_id;
+    ti.sim.lineage          = primary.track_id.unchecked_get();
     ti.sim.num_steps        = 0;
     ti.sim.time             = primary.time;
     ti.sim.status           = TrackStatus::alive;
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "corecel/cont/Range.hh"
 #include "corecel/math/Atomics.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/geo/GeoTrackView.hh"
@@ -21,6 +22,12 @@ namespace celeritas
 {
 namespace detail
 {
+//---------------------------------------------------------------------------//
+// Calculate a reproducible key for a secondary from its parent's
+inline CELER_FUNCTION ull_int calc_secondary_lineage(ull_int   parent,
+                                                     size_type step,
+                                                     size_type index);
+
 //---------------------------------------------------------------------------//
 /*!
  * Create track initializers from secondaries.
@@ -76,13 +83,17 @@ ProcessSecondariesLauncher<M>::operator()(ThreadId tid) const
     // A new track was initialized from a secondary in the parent's track slot
     bool initialized = false;
 
-    // Save the parent ID since it will be overwritten if a secondary is
-    // initialized in this slot
-    const TrackId parent_id{sim.track_id()};
+    // Save the parent ID and lineage since they will be overwritten if a
+    // secondary is initialized in this slot
+    const TrackId   parent_id{sim.track_id()};
+    const ull_int   parent_lineage = sim.lineage();
+    const size_type parent_steps   = sim.num_steps();
 
     PhysicsStepView phys(params_.physics, states_.physics, tid);
-    for (const auto& secondary : phys.secondaries())
+    auto            secondaries = phys.secondaries();
+    for (auto i : range(secondaries.size()))
     {
+        const Secondary& secondary = secondaries[i];
         if (secondary)
         {
             // Particles should not be making secondaries while crossing a
@@ -91,18 +102,22 @@ ProcessSecondariesLauncher<M>::operator()(ThreadId tid) const
             CELER_ASSERT(!geo.is_on_boundary());
 
             // Increment the total number of tracks created for this event and
-            // calculate the track ID of the secondary
-            // TODO: This is nondeterministic; we need to calculate the
-            // track ID in a reproducible way.
+            // calculate the track ID of the secondary. The ID depends on the
+            // order in which threads reach this point, so only the lineage
+            // (which selects the secondary's random number stream) is
+            // reproducible.
             CELER_ASSERT(sim.event_id() < data.track_counters.size());
             TrackId::size_type track_id = atomic_add(
                 &data.track_counters[sim.event_id()], size_type{1});
+            ull_int lineage
+                = calc_secondary_lineage(parent_lineage, parent_steps, i);
 
             // Create a track initializer from the secondary
             TrackInitializer ti;
             ti.sim.track_id         = TrackId{track_id};
             ti.sim.parent_id        = parent_id;
             ti.sim.event_id         = sim.event_id();
+            ti.sim.lineage          = lineage;
             ti.sim.num_steps        = 0;
             ti.sim.time             = sim.time();
             ti.sim.status           = TrackStatus::alive;
@@ -159,6 +174,26 @@ ProcessSecondariesLauncher<M>::operator()(ThreadId tid) const
     CELER_ENSURE(sim.status() != TrackStatus::killed);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate a reproducible key for a secondary from its parent's.
+ *
+ * The parent's lineage, the step at which the secondary was emitted, and its
+ * index among that step's secondaries are combined with the SplitMix64
+ * finalizer so that the keys of distinct secondaries are well separated.
+ */
+CELER_FUNCTION ull_int calc_secondary_lineage(ull_int   parent,
+                                              size_type step,
+                                              size_type index)
+{
+    ull_int x = (static_cast<ull_int>(step) << 32u)
+                | static_cast<ull_int>(index);
+    x = parent + 0x9e3779b97f4a7c15ull * (x + 1);
+    x = (x ^ (x >> 30u)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27u)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31u);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
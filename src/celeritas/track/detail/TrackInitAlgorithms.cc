@@ -8,6 +8,13 @@
 #include "TrackInitAlgorithms.hh"
 
 #include <algorithm>
+#include <vector>
+
+#include "celeritas_config.h"
+#include "corecel/math/Algorithms.hh"
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
 
 #include "Utils.hh"
 
@@ -15,20 +22,119 @@ namespace celeritas
 {
 namespace detail
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Minimum number of elements per chunk for parallel execution
+constexpr size_type min_chunk_size() { return 16384; }
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of contiguous chunks to process in parallel.
+ *
+ * Small arrays are processed by a single thread since the overhead of the
+ * parallel region would dominate.
+ */
+size_type num_chunks(size_type size)
+{
+#if CELERITAS_USE_OPENMP
+    return std::max<size_type>(
+        1, std::min<size_type>(omp_get_max_threads(), size / min_chunk_size()));
+#else
+    (void)sizeof(size);
+    return 1;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get temporary host storage from the step arena or a fallback vector.
+ */
+template<class T>
+Span<T> get_scratch(StepScratchArena<MemSpace::host>* scratch,
+                    std::vector<T>*                   fallback,
+                    size_type                         count)
+{
+    if (scratch)
+    {
+        return scratch->allocate<T>(count);
+    }
+    fallback->resize(count);
+    return make_span(*fallback);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Remove all elements in the vacancy vector that were flagged as active
  * tracks.
+ *
+ * Large arrays are compacted in parallel: each thread counts the vacancies
+ * in a contiguous chunk, and after a serial scan over the chunk counts, each
+ * thread copies its vacancies to a temporary buffer which is then copied
+ * back. The result is identical to a serial \c std::remove_if .
  */
 template<>
-size_type remove_if_alive<MemSpace::host>(Span<size_type> vacancies)
+size_type remove_if_alive<MemSpace::host>(
+    Span<size_type> vacancies, StepScratchArena<MemSpace::host>* scratch)
 {
-    auto end = std::remove_if(vacancies.data(),
-                              vacancies.data() + vacancies.size(),
-                              IsEqual{occupied()});
+    const size_type size       = vacancies.size();
+    const size_type chunks     = num_chunks(size);
+    const size_type chunk_size = ceil_div(size, chunks);
+
+    if (chunks == 1)
+    {
+        auto end = std::remove_if(
+            vacancies.data(), vacancies.data() + size, IsEqual{occupied()});
+        return end - vacancies.data();
+    }
+
+    std::vector<size_type> temp_offsets;
+    std::vector<size_type> temp_values;
+    Span<size_type> offsets = get_scratch(scratch, &temp_offsets, chunks + 1);
+    Span<size_type> values  = get_scratch(scratch, &temp_values, size);
+
+    // Count the number of vacancies in each chunk
+#pragma omp parallel for
+    for (size_type c = 0; c < chunks; ++c)
+    {
+        const size_type* first = vacancies.data() + c * chunk_size;
+        const size_type* last
+            = vacancies.data() + std::min(size, (c + 1) * chunk_size);
+        offsets[c + 1] = last - first - std::count(first, last, occupied());
+    }
+
+    // Convert counts to the output position of each chunk
+    offsets[0] = 0;
+    for (size_type c = 0; c < chunks; ++c)
+    {
+        offsets[c + 1] += offsets[c];
+    }
+    const size_type result = offsets[chunks];
+
+    // Compact each chunk into the temporary buffer
+#pragma omp parallel for
+    for (size_type c = 0; c < chunks; ++c)
+    {
+        const size_type* first = vacancies.data() + c * chunk_size;
+        const size_type* last
+            = vacancies.data() + std::min(size, (c + 1) * chunk_size);
+        std::remove_copy(first, last, values.data() + offsets[c], occupied());
+    }
+
+    // Copy back
+#pragma omp parallel for
+    for (size_type c = 0; c < chunks; ++c)
+    {
+        const size_type first = std::min(result, c * chunk_size);
+        const size_type last  = std::min(result, (c + 1) * chunk_size);
+        std::copy(values.data() + first,
+                  values.data() + last,
+                  vacancies.data() + first);
+    }
 
-    // New size of the vacancy vector
-    size_type result = end - vacancies.data();
     return result;
 }
 
@@ -40,20 +146,61 @@ size_type remove_if_alive<MemSpace::host>(Span<size_type> vacancies)
  * array elements, i.e., \f$ y_i = \sum_{j=0}^{i-1} x_j \f$,
  * where \f$ y_0 = 0 \f$, and stores the result in the input array.
  *
+ * Large arrays are scanned in parallel: each thread sums a contiguous chunk,
+ * the chunk sums are scanned serially, and then each thread scans its chunk
+ * starting from the chunk's offset.
+ *
  * The return value is the sum of all elements in the input array.
  */
 template<>
-size_type exclusive_scan_counts<MemSpace::host>(Span<size_type> counts)
+size_type exclusive_scan_counts<MemSpace::host>(
+    Span<size_type> counts, StepScratchArena<MemSpace::host>* scratch)
 {
-    // TODO: Use std::exclusive_scan when C++17 is adopted
-    size_type acc = 0;
-    for (auto& count_i : counts)
+    const size_type size       = counts.size();
+    const size_type chunks     = num_chunks(size);
+    const size_type chunk_size = ceil_div(size, chunks);
+
+    std::vector<size_type> temp_offsets;
+    Span<size_type> offsets = get_scratch(scratch, &temp_offsets, chunks + 1);
+
+    // Sum each chunk
+#pragma omp parallel for if (chunks > 1)
+    for (size_type c = 0; c < chunks; ++c)
+    {
+        size_type*       first = counts.data() + c * chunk_size;
+        size_type* const last
+            = counts.data() + std::min(size, (c + 1) * chunk_size);
+        size_type acc = 0;
+        for (; first != last; ++first)
+        {
+            acc += *first;
+        }
+        offsets[c + 1] = acc;
+    }
+
+    // Scan over chunks
+    offsets[0] = 0;
+    for (size_type c = 0; c < chunks; ++c)
+    {
+        offsets[c + 1] += offsets[c];
+    }
+
+    // Scan within each chunk
+#pragma omp parallel for if (chunks > 1)
+    for (size_type c = 0; c < chunks; ++c)
     {
-        size_type current = count_i;
-        count_i           = acc;
-        acc += current;
+        size_type*       first = counts.data() + c * chunk_size;
+        size_type* const last
+            = counts.data() + std::min(size, (c + 1) * chunk_size);
+        size_type acc = offsets[c];
+        for (; first != last; ++first)
+        {
+            size_type current = *first;
+            *first            = acc;
+            acc += current;
+        }
     }
-    return acc;
+    return offsets[chunks];
 }
 
 //---------------------------------------------------------------------------//
@@ -13,6 +13,7 @@
 
 #include "corecel/Macros.hh"
 #include "corecel/data/Copier.hh"
+#include "celeritas/global/detail/ThrustScratchPolicy.device.hh"
 
 #include "Utils.hh"
 
@@ -26,12 +27,18 @@ namespace detail
  * tracks.
  */
 template<>
-size_type remove_if_alive<MemSpace::device>(Span<size_type> vacancies)
+size_type remove_if_alive<MemSpace::device>(
+    Span<size_type> vacancies, StepScratchArena<MemSpace::device>* scratch)
 {
-    thrust::device_ptr<size_type> end = thrust::remove_if(
-        thrust::device_pointer_cast(vacancies.data()),
-        thrust::device_pointer_cast(vacancies.data() + vacancies.size()),
-        IsEqual{occupied()});
+    thrust::device_ptr<size_type> end
+        = with_scratch_policy(scratch, [&](auto const& policy) {
+              return thrust::remove_if(
+                  policy,
+                  thrust::device_pointer_cast(vacancies.data()),
+                  thrust::device_pointer_cast(vacancies.data()
+                                              + vacancies.size()),
+                  IsEqual{occupied()});
+          });
 
     CELER_DEVICE_CHECK_ERROR();
 
@@ -51,7 +58,8 @@ size_type remove_if_alive<MemSpace::device>(Span<size_type> vacancies)
  * The return value is the sum of all elements in the input array.
  */
 template<>
-size_type exclusive_scan_counts<MemSpace::device>(Span<size_type> counts)
+size_type exclusive_scan_counts<MemSpace::device>(
+    Span<size_type> counts, StepScratchArena<MemSpace::device>* scratch)
 {
     // Copy the last element to the host
     Copier<size_type, MemSpace::device> copy_last_element_to{
@@ -59,11 +67,14 @@ size_type exclusive_scan_counts<MemSpace::device>(Span<size_type> counts)
     size_type partial1{};
     copy_last_element_to(MemSpace::host, {&partial1, 1});
 
-    thrust::exclusive_scan(
-        thrust::device_pointer_cast(counts.data()),
-        thrust::device_pointer_cast(counts.data() + counts.size()),
-        thrust::device_pointer_cast(counts.data()),
-        size_type(0));
+    with_scratch_policy(scratch, [&](auto const& policy) {
+        return thrust::exclusive_scan(
+            policy,
+            thrust::device_pointer_cast(counts.data()),
+            thrust::device_pointer_cast(counts.data() + counts.size()),
+            thrust::device_pointer_cast(counts.data()),
+            size_type(0));
+    });
     CELER_DEVICE_CHECK_ERROR();
 
     // Copy the last element (the sum of all elements but the last) to the host
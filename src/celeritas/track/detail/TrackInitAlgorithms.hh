@@ -11,6 +11,7 @@
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
 #include "corecel/cont/Span.hh"
+#include "celeritas/global/StepScratchArena.hh"
 
 namespace celeritas
 {
@@ -19,35 +20,48 @@ namespace detail
 //---------------------------------------------------------------------------//
 // Remove all elements in the vacancy vector that were flagged as alive
 template<MemSpace M>
-size_type remove_if_alive(Span<size_type> vacancies);
+size_type remove_if_alive(Span<size_type>      vacancies,
+                          StepScratchArena<M>* scratch);
 
 template<>
-size_type remove_if_alive<MemSpace::host>(Span<size_type> vacancies);
+size_type remove_if_alive<MemSpace::host>(Span<size_type> vacancies,
+                                          StepScratchArena<MemSpace::host>*);
 template<>
-size_type remove_if_alive<MemSpace::device>(Span<size_type> vacancies);
+size_type
+remove_if_alive<MemSpace::device>(Span<size_type> vacancies,
+                                  StepScratchArena<MemSpace::device>*);
 
 //---------------------------------------------------------------------------//
 // Calculate the exclusive prefix sum of the number of surviving secondaries
 template<MemSpace M>
-size_type exclusive_scan_counts(Span<size_type> counts);
+size_type exclusive_scan_counts(Span<size_type>      counts,
+                                StepScratchArena<M>* scratch);
 
 template<>
-size_type exclusive_scan_counts<MemSpace::host>(Span<size_type> counts);
+size_type
+exclusive_scan_counts<MemSpace::host>(Span<size_type> counts,
+                                      StepScratchArena<MemSpace::host>*);
 template<>
-size_type exclusive_scan_counts<MemSpace::device>(Span<size_type> counts);
+size_type
+exclusive_scan_counts<MemSpace::device>(Span<size_type> counts,
+                                        StepScratchArena<MemSpace::device>*);
 
 //---------------------------------------------------------------------------//
 // INLINE DEFINITIONS
 //---------------------------------------------------------------------------//
 #if !CELER_USE_DEVICE
 template<>
-inline size_type remove_if_alive<MemSpace::device>(Span<size_type>)
+inline size_type
+remove_if_alive<MemSpace::device>(Span<size_type>,
+                                  StepScratchArena<MemSpace::device>*)
 {
     CELER_NOT_CONFIGURED("CUDA or HIP");
 }
 
 template<>
-inline size_type exclusive_scan_counts<MemSpace::device>(Span<size_type>)
+inline size_type
+exclusive_scan_counts<MemSpace::device>(Span<size_type>,
+                                        StepScratchArena<MemSpace::device>*)
 {
     CELER_NOT_CONFIGURED("CUDA or HIP");
 }
@@ -0,0 +1,97 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/detail/TrackSortAlgorithms.cc
+//---------------------------------------------------------------------------//
+#include "TrackSortAlgorithms.hh"
+
+#include <algorithm>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/math/Algorithms.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Partition track slots by their post-step action ID.
+ *
+ * This is a stable counting sort. The track slots are divided into one
+ * contiguous chunk per row of the scratch space; each chunk is counted and
+ * scattered independently (in parallel with OpenMP), and the exclusive scan
+ * over (action, chunk) in between is serial since its length is only the
+ * number of actions times the number of chunks. The result is deterministic
+ * and independent of the number of threads actually used.
+ */
+void sort_by_action(const HostRef<SimStateData>&       sim,
+                    const HostRef<TrackSortStateData>& sort)
+{
+    CELER_EXPECT(sim.size() == sort.size());
+    CELER_EXPECT(sort.counts.size() % sort.num_buckets() == 0);
+
+    using size_type = ThreadId::size_type;
+
+    const size_type num_actions = sort.num_actions();
+    const size_type num_buckets = sort.num_buckets();
+    const size_type num_chunks  = sort.counts.size() / num_buckets;
+    const size_type num_slots   = sort.size();
+    const size_type chunk_size  = ceil_div(num_slots, num_chunks);
+
+    auto const& states = sim.state;
+    auto        counts = sort.counts[AllItems<size_type>{}];
+    auto        slots  = sort.track_slots[AllItems<ThreadId>{}];
+
+    // Count the number of tracks per action in each chunk
+#pragma omp parallel for
+    for (size_type chunk = 0; chunk < num_chunks; ++chunk)
+    {
+        size_type* chunk_counts = counts.data() + chunk * num_buckets;
+        std::fill(chunk_counts, chunk_counts + num_buckets, size_type(0));
+
+        const size_type end = std::min(num_slots, (chunk + 1) * chunk_size);
+        for (size_type i = chunk * chunk_size; i < end; ++i)
+        {
+            ++chunk_counts[bucket_index(states[ThreadId{i}].step_limit.action,
+                                        num_actions)];
+        }
+    }
+
+    // Convert counts to the starting position of each action in each chunk
+    size_type acc = 0;
+    for (auto bucket : range(num_buckets))
+    {
+        sort.offsets[ActionId{bucket}] = acc;
+        for (auto chunk : range(num_chunks))
+        {
+            size_type& count = counts[chunk * num_buckets + bucket];
+            size_type  temp  = count;
+            count            = acc;
+            acc += temp;
+        }
+    }
+    sort.offsets[ActionId{num_buckets}] = acc;
+    CELER_ASSERT(acc == num_slots);
+
+    // Scatter track slots into their sorted positions
+#pragma omp parallel for
+    for (size_type chunk = 0; chunk < num_chunks; ++chunk)
+    {
+        size_type* chunk_counts = counts.data() + chunk * num_buckets;
+
+        const size_type end = std::min(num_slots, (chunk + 1) * chunk_size);
+        for (size_type i = chunk * chunk_size; i < end; ++i)
+        {
+            size_type& pos = chunk_counts[bucket_index(
+                states[ThreadId{i}].step_limit.action, num_actions)];
+            slots[pos++] = ThreadId{i};
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
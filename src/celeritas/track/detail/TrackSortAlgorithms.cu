@@ -0,0 +1,124 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/detail/TrackSortAlgorithms.cu
+//---------------------------------------------------------------------------//
+#include "TrackSortAlgorithms.hh"
+
+#include <thrust/device_ptr.h>
+#include <thrust/fill.h>
+#include <thrust/scan.h>
+
+#include "corecel/device_runtime_api.h"
+#include "corecel/Assert.hh"
+#include "corecel/data/Copier.hh"
+#include "corecel/math/Atomics.hh"
+#include "corecel/sys/Device.hh"
+#include "corecel/sys/KernelParamCalculator.device.hh"
+#include "celeritas/global/detail/ThrustScratchPolicy.device.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// KERNELS
+//---------------------------------------------------------------------------//
+/*!
+ * Count the number of tracks with each post-step action.
+ */
+__global__ void count_actions_kernel(DeviceRef<SimStateData> const       sim,
+                                     DeviceRef<TrackSortStateData> const sort)
+{
+    auto tid = KernelParamCalculator::thread_id();
+    if (!(tid < sim.size()))
+        return;
+
+    size_type bucket = bucket_index(sim.state[tid].step_limit.action,
+                                    sort.num_actions());
+    atomic_add(&sort.counts[ItemId<size_type>{bucket}], size_type(1));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Scatter track slots to their action's range.
+ *
+ * The ordering of tracks within a single action's range is arbitrary.
+ */
+__global__ void scatter_slots_kernel(DeviceRef<SimStateData> const       sim,
+                                     DeviceRef<TrackSortStateData> const sort)
+{
+    auto tid = KernelParamCalculator::thread_id();
+    if (!(tid < sim.size()))
+        return;
+
+    size_type bucket = bucket_index(sim.state[tid].step_limit.action,
+                                    sort.num_actions());
+    size_type pos
+        = atomic_add(&sort.counts[ItemId<size_type>{bucket}], size_type(1));
+    sort.track_slots[ThreadId{pos}] = tid;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Partition track slots by their post-step action ID.
+ *
+ * The per-action counts are accumulated atomically, scanned in place, and
+ * copied to the host-side offsets so that subsequent kernels can be launched
+ * with exactly the number of tracks in their range.
+ */
+void sort_by_action(const DeviceRef<SimStateData>&       sim,
+                    const DeviceRef<TrackSortStateData>& sort,
+                    StepScratchArena<MemSpace::device>*  scratch)
+{
+    CELER_EXPECT(sim.size() == sort.size());
+
+    const size_type num_buckets = sort.num_buckets();
+    CELER_ASSERT(sort.counts.size() >= num_buckets);
+    auto counts = sort.counts[AllItems<size_type, MemSpace::device>{}];
+
+    thrust::fill(thrust::device_pointer_cast(counts.data()),
+                 thrust::device_pointer_cast(counts.data() + num_buckets),
+                 size_type(0));
+    CELER_DEVICE_CHECK_ERROR();
+
+    CELER_LAUNCH_KERNEL(count_actions,
+                        celeritas::device().default_block_size(),
+                        sim.size(),
+                        sim,
+                        sort);
+
+    with_scratch_policy(scratch, [&](auto const& policy) {
+        return thrust::exclusive_scan(
+            policy,
+            thrust::device_pointer_cast(counts.data()),
+            thrust::device_pointer_cast(counts.data() + num_buckets),
+            thrust::device_pointer_cast(counts.data()),
+            size_type(0));
+    });
+    CELER_DEVICE_CHECK_ERROR();
+
+    // Copy the start of each range to the host
+    auto offsets = sort.offsets[AllItems<size_type, MemSpace::host>{}];
+    Copier<size_type, MemSpace::device> copy_to_host{
+        {counts.data(), num_buckets}};
+    copy_to_host(MemSpace::host, offsets.subspan(0, num_buckets));
+    offsets.back() = sim.size();
+
+    CELER_LAUNCH_KERNEL(scatter_slots,
+                        celeritas::device().default_block_size(),
+                        sim.size(),
+                        sim,
+                        sort);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,60 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/detail/TrackSortAlgorithms.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "celeritas/global/StepScratchArena.hh"
+
+#include "../SimData.hh"
+#include "../TrackSortData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// Partition track slots by their post-step action ID
+void sort_by_action(const HostRef<SimStateData>&       sim,
+                    const HostRef<TrackSortStateData>& sort);
+
+void sort_by_action(const DeviceRef<SimStateData>&       sim,
+                    const DeviceRef<TrackSortStateData>& sort,
+                    StepScratchArena<MemSpace::device>*  scratch = nullptr);
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the sorting bucket for a track's post-step action.
+ *
+ * Tracks whose action is unset (or was registered after the sort data was
+ * sized) are grouped into a final bucket that is never launched.
+ */
+inline CELER_FUNCTION size_type bucket_index(ActionId action,
+                                             size_type num_actions)
+{
+    return (action && action.unchecked_get() < num_actions)
+               ? action.unchecked_get()
+               : num_actions;
+}
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+#if !CELER_USE_DEVICE
+inline void sort_by_action(const DeviceRef<SimStateData>&,
+                           const DeviceRef<TrackSortStateData>&,
+                           StepScratchArena<MemSpace::device>*)
+{
+    CELER_NOT_CONFIGURED("CUDA or HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -10,6 +10,7 @@
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "corecel/Types.hh"
+#include "celeritas/global/HostLauncher.hh"
 
 namespace celeritas
 {
@@ -21,11 +22,9 @@ void init_tracks(
 {
     MultiExceptionHandler capture_exception;
     detail::InitTracksLauncher<MemSpace::host> launch(core_data, num_vacancies);
-    #pragma omp parallel for
-    for (ThreadId::size_type i = 0; i < num_vacancies; ++i)
-    {
-        CELER_TRY_ELSE(launch(ThreadId{i}), capture_exception);
-    }
+    launch_host(core_data, num_vacancies, [&](ThreadId tid) {
+        CELER_TRY_ELSE(launch(tid), capture_exception);
+    });
     log_and_rethrow(std::move(capture_exception));
 }
 
@@ -10,6 +10,7 @@
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "corecel/Types.hh"
+#include "celeritas/global/HostLauncher.hh"
 
 namespace celeritas
 {
@@ -20,11 +21,9 @@ void process_secondaries(
 {
     MultiExceptionHandler capture_exception;
     detail::ProcessSecondariesLauncher<MemSpace::host> launch(core_data);
-    #pragma omp parallel for
-    for (ThreadId::size_type i = 0; i < core_data.states.size(); ++i)
-    {
-        CELER_TRY_ELSE(launch(ThreadId{i}), capture_exception);
-    }
+    launch_host(core_data, core_data.states.size(), [&](ThreadId tid) {
+        CELER_TRY_ELSE(launch(tid), capture_exception);
+    });
     log_and_rethrow(std::move(capture_exception));
 }
 
@@ -10,6 +10,7 @@
 #include "corecel/Macros.hh"
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
+#include "celeritas/global/HostLauncher.hh"
 
 #include "StepGatherLauncher.hh"
 
@@ -68,11 +69,9 @@ void StepGatherAction<P>::execute(CoreHostRef const& core) const
 
     MultiExceptionHandler capture_exception;
     StepGatherLauncher<P> launch{core, storage_->params.host_ref(), step_state};
-#pragma omp parallel for
-    for (size_type i = 0; i < core.states.size(); ++i)
-    {
-        CELER_TRY_ELSE(launch(ThreadId{i}), capture_exception);
-    }
+    launch_host(core, core.states.size(), [&](ThreadId tid) {
+        CELER_TRY_ELSE(launch(tid), capture_exception);
+    });
     log_and_rethrow(std::move(capture_exception));
 
     if (P == StepPoint::post)
@@ -25,6 +25,18 @@ void fill(const T& value, Collection<T, Ownership::value, M, I>* col)
     fill_impl((*col)[AllItems<T, M>{}]);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Fill the referenced collection with the given value.
+ */
+template<class T, MemSpace M, class I>
+void fill(const T& value, Collection<T, Ownership::reference, M, I>* col)
+{
+    CELER_EXPECT(col);
+    detail::Filler<T, M> fill_impl{value};
+    fill_impl((*col)[AllItems<T, M>{}]);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Copy from the given collection to host.
@@ -83,6 +83,10 @@ class CollectionStateStore
     // Get a reference to the mutable state data
     inline const Ref& ref() const;
 
+    // Modify the stored values (e.g. resize a component) and update the ref
+    template<class F>
+    inline void update(F&& modify);
+
   private:
     Value val_;
     Ref   ref_;
@@ -184,5 +188,23 @@ auto CollectionStateStore<S, M>::ref() const -> const Ref&
     return ref_;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Modify the stored values and update the reference.
+ *
+ * The function is called with a mutable reference to the value-owned state.
+ * References previously obtained from \c ref() are invalidated.
+ */
+template<template<Ownership, MemSpace> class S, MemSpace M>
+template<class F>
+void CollectionStateStore<S, M>::update(F&& modify)
+{
+    CELER_EXPECT(*this);
+    modify(val_);
+    CELER_ASSERT(val_);
+    // Save reference
+    ref_ = val_;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
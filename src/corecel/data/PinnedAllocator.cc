@@ -0,0 +1,66 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/PinnedAllocator.cc
+//---------------------------------------------------------------------------//
+#include "PinnedAllocator.hh"
+
+#include <cstdlib>
+#include <new>
+
+#include "corecel/device_runtime_api.h"
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/sys/Device.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate page-locked host memory if a device is active.
+ */
+void* malloc_pinned(std::size_t num_bytes)
+{
+    void* ptr = nullptr;
+    if (CELER_USE_DEVICE && celeritas::device())
+    {
+        CELER_DEVICE_CALL_PREFIX(MallocHost(&ptr, num_bytes));
+    }
+    else
+    {
+        ptr = std::malloc(num_bytes);
+    }
+    if (!ptr && num_bytes > 0)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Free memory allocated with \c malloc_pinned .
+ */
+void free_pinned(void* ptr) noexcept
+{
+    if (CELER_USE_DEVICE && celeritas::device())
+    {
+        try
+        {
+            CELER_DEVICE_CALL_PREFIX(FreeHost(ptr));
+        }
+        catch (const RuntimeError&)
+        {
+            // Don't throw from a deallocation
+        }
+    }
+    else
+    {
+        std::free(ptr);
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
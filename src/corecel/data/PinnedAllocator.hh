@@ -0,0 +1,72 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/PinnedAllocator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+// Allocate page-locked host memory if a device is active
+void* malloc_pinned(std::size_t num_bytes);
+
+// Free memory allocated with malloc_pinned
+void free_pinned(void* ptr) noexcept;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate page-locked ("pinned") host memory for fast device transfers.
+ *
+ * Asynchronous copies between host and device are only truly asynchronous if
+ * the host memory is pinned. If no device is active, ordinary host memory is
+ * used. The device must not be activated or deactivated while any pinned
+ * allocations are alive.
+ *
+ * \code
+    std::vector<Primary, PinnedAllocator<Primary>> staging;
+   \endcode
+ */
+template<class T>
+struct PinnedAllocator
+{
+    using value_type = T;
+
+    PinnedAllocator() = default;
+
+    //! Construct from an allocator of another type
+    template<class U>
+    PinnedAllocator(const PinnedAllocator<U>&) noexcept
+    {
+    }
+
+    //! Allocate storage for the given number of elements
+    T* allocate(std::size_t n)
+    {
+        return static_cast<T*>(malloc_pinned(n * sizeof(T)));
+    }
+
+    //! Deallocate storage
+    void deallocate(T* ptr, std::size_t) noexcept { free_pinned(ptr); }
+};
+
+//! All pinned allocators are interchangeable
+template<class T, class U>
+bool operator==(const PinnedAllocator<T>&, const PinnedAllocator<U>&)
+{
+    return true;
+}
+
+//! All pinned allocators are interchangeable
+template<class T, class U>
+bool operator!=(const PinnedAllocator<T>&, const PinnedAllocator<U>&)
+{
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
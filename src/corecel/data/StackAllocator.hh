@@ -72,6 +72,11 @@ namespace celeritas
  * then the \c size() call will reflect that overflowed state, rather than the
  * corrected size reflecting the failed allocation.
  *
+ * The number of items that failed to allocate is accumulated until the stack
+ * is cleared, so a later kernel or the host can detect that the capacity was
+ * exceeded and by how much (\c size() plus \c overflow() is the total
+ * number of items requested).
+ *
  * A third kernel with a single thread would then be responsible for clearing
  * the data:
  * \code
@@ -129,6 +134,9 @@ class StackAllocator
     // Current size
     inline CELER_FUNCTION size_type size() const;
 
+    // Number of items that failed to allocate since the last clear
+    inline CELER_FUNCTION size_type overflow() const;
+
     // View all allocated data
     inline CELER_FUNCTION Span<value_type> get();
     inline CELER_FUNCTION Span<const value_type> get() const;
@@ -141,6 +149,7 @@ class StackAllocator
     using SizeId    = ItemId<size_type>;
     using StorageId = ItemId<T>;
     static CELER_CONSTEXPR_FUNCTION SizeId size_id() { return SizeId{0}; }
+    static CELER_CONSTEXPR_FUNCTION SizeId overflow_id() { return SizeId{1}; }
 };
 
 //---------------------------------------------------------------------------//
@@ -179,7 +188,8 @@ CELER_FUNCTION auto StackAllocator<T>::capacity() const -> size_type
 template<class T>
 CELER_FUNCTION void StackAllocator<T>::clear()
 {
-    data_.size[this->size_id()] = 0;
+    data_.size[this->size_id()]     = 0;
+    data_.size[this->overflow_id()] = 0;
 }
 
 //---------------------------------------------------------------------------//
@@ -215,9 +225,9 @@ CELER_FUNCTION auto StackAllocator<T>::operator()(size_type count)
             data_.size[this->size_id()] = start;
         }
 
-        // TODO It might be useful to set an "out of memory" flag to make it
-        // easier for host code to detect whether a failure occurred, rather
-        // than looping through primaries and testing for failure.
+        // Record the failed request so that host code can detect it and
+        // grow the storage
+        atomic_add(&data_.size[this->overflow_id()], count);
 
         // Return null pointer, indicating failure to allocate.
         return nullptr;
@@ -248,6 +258,19 @@ CELER_FUNCTION auto StackAllocator<T>::size() const -> size_type
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the number of items that failed to allocate since the last clear.
+ *
+ * Like \c size() , this is only meaningful after the allocating kernel has
+ * completed.
+ */
+template<class T>
+CELER_FUNCTION auto StackAllocator<T>::overflow() const -> size_type
+{
+    return data_.size[this->overflow_id()];
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * View all allocated data.
@@ -19,12 +19,15 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Storage for a stack and its dynamic size.
+ *
+ * The \c size collection has two elements: the number of allocated items and
+ * the number of items that failed to allocate since the stack was cleared.
  */
 template<class T, Ownership W, MemSpace M>
 struct StackAllocatorData
 {
     celeritas::Collection<T, W, M>         storage; //!< Allocated capacity
-    celeritas::Collection<size_type, W, M> size;    //!< Stored size
+    celeritas::Collection<size_type, W, M> size;    //!< Size and overflow
 
     //! Whether the data is assigned
     explicit CELER_FUNCTION operator bool() const
@@ -56,7 +59,7 @@ resize(StackAllocatorData<T, Ownership::value, M>* data, size_type capacity)
 {
     CELER_EXPECT(capacity > 0);
     resize(&data->storage, capacity);
-    resize(&data->size, 1);
+    resize(&data->size, 2);
     celeritas::fill(size_type(0), &data->size);
 }
 
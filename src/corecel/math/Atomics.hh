@@ -4,7 +4,7 @@
 // SPDX-License-Identifier: (Apache-2.0 OR MIT)
 //---------------------------------------------------------------------------//
 //! \file corecel/math/Atomics.hh
-//! \brief Atomics for use in kernel code (CUDA/HIP/OpenMP).
+//! \brief Atomics for use in kernel code (CUDA/HIP/OpenMP/host threads).
 //---------------------------------------------------------------------------//
 #pragma once
 
@@ -14,8 +14,53 @@
 
 #include "Algorithms.hh"
 
+#if !CELER_DEVICE_COMPILE && !defined(_OPENMP) \
+    && !(defined(__GNUC__) || defined(__clang__))
+#    include <mutex>
+#endif
+
 namespace celeritas
 {
+namespace detail
+{
+#if !CELER_DEVICE_COMPILE && !defined(_OPENMP)
+//---------------------------------------------------------------------------//
+/*!
+ * Atomically replace a host value with a function of it, returning the old.
+ *
+ * Host track loops can run on a \c ThreadPool even when OpenMP is disabled,
+ * so the host atomics can't rely on OpenMP pragmas alone.
+ */
+template<class T, class F>
+inline T host_atomic_update(T* address, F&& update)
+{
+#    if defined(__GNUC__) || defined(__clang__)
+    T initial;
+    __atomic_load(address, &initial, __ATOMIC_RELAXED);
+    T desired;
+    do
+    {
+        desired = update(initial);
+    } while (!__atomic_compare_exchange(address,
+                                        &initial,
+                                        &desired,
+                                        /* weak = */ true,
+                                        __ATOMIC_SEQ_CST,
+                                        __ATOMIC_RELAXED));
+    return initial;
+#    else
+    static std::mutex           mutex;
+    std::lock_guard<std::mutex> scoped_lock{mutex};
+    T                           initial = *address;
+    *address                            = update(initial);
+    return initial;
+#    endif
+}
+#endif
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+
 //---------------------------------------------------------------------------//
 /*!
  * Add to a value, returning the original value.
@@ -27,15 +72,18 @@ CELER_FORCEINLINE_FUNCTION T atomic_add(T* address, T value)
     return atomicAdd(address, value);
 #else
     CELER_EXPECT(address);
-    T initial;
 #    ifdef _OPENMP
+    T initial;
 #        pragma omp atomic capture
-#    endif
     {
         initial = *address;
         *address += value;
     }
     return initial;
+#    else
+    return detail::host_atomic_update(
+        address, [value](T initial) { return initial + value; });
+#    endif
 #endif
 }
 
@@ -77,15 +125,19 @@ CELER_FORCEINLINE_FUNCTION T atomic_min(T* address, T value)
     return atomicMin(address, value);
 #else
     CELER_EXPECT(address);
-    T initial;
 #    ifdef _OPENMP
+    T initial;
 #        pragma omp atomic capture
-#    endif
     {
         initial  = *address;
         *address = celeritas::min(initial, value);
     }
     return initial;
+#    else
+    return detail::host_atomic_update(address, [value](T initial) {
+        return celeritas::min(initial, value);
+    });
+#    endif
 #endif
 }
 
@@ -100,15 +152,19 @@ CELER_FORCEINLINE_FUNCTION T atomic_max(T* address, T value)
     return atomicMax(address, value);
 #else
     CELER_EXPECT(address);
-    T initial;
 #    ifdef _OPENMP
+    T initial;
 #        pragma omp atomic capture
-#    endif
     {
         initial  = *address;
         *address = celeritas::max(initial, value);
     }
     return initial;
+#    else
+    return detail::host_atomic_update(address, [value](T initial) {
+        return celeritas::max(initial, value);
+    });
+#    endif
 #endif
 }
 
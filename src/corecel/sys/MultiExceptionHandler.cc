@@ -44,6 +44,34 @@ namespace detail
 }
 } // namespace detail
 
+//---------------------------------------------------------------------------//
+//!@{
+//! Copy/move the stored exceptions (not thread safe)
+MultiExceptionHandler::MultiExceptionHandler(MultiExceptionHandler&& other)
+    : exceptions_(std::move(other.exceptions_))
+{
+}
+
+MultiExceptionHandler&
+MultiExceptionHandler::operator=(MultiExceptionHandler&& other)
+{
+    exceptions_ = std::move(other.exceptions_);
+    return *this;
+}
+
+MultiExceptionHandler::MultiExceptionHandler(const MultiExceptionHandler& other)
+    : exceptions_(other.exceptions_)
+{
+}
+
+MultiExceptionHandler&
+MultiExceptionHandler::operator=(const MultiExceptionHandler& other)
+{
+    exceptions_ = other.exceptions_;
+    return *this;
+}
+//!@}
+
 //---------------------------------------------------------------------------//
 /*!
  * Terminate if destroyed without handling exceptions.
@@ -76,15 +104,14 @@ MultiExceptionHandler::~MultiExceptionHandler()
 //---------------------------------------------------------------------------//
 /*!
  * Thread-safe capture of the given exception.
+ *
+ * A mutex (rather than an OpenMP critical section) is used so that exceptions
+ * can also be captured from \c ThreadPool workers.
  */
 void MultiExceptionHandler::operator()(std::exception_ptr p)
 {
-#ifdef _OPENMP
-#    pragma omp critical (MultiExceptionHandler)
-#endif
-    {
-        exceptions_.push_back(std::move(p));
-    }
+    std::lock_guard<std::mutex> scoped_lock{mutex_};
+    exceptions_.push_back(std::move(p));
 }
 
 //---------------------------------------------------------------------------//
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <exception>
+#include <mutex>
 #include <vector>
 
 #include "corecel/Macros.hh"
@@ -41,12 +42,14 @@ class MultiExceptionHandler
     //!@}
 
   public:
-    // Default all construct/copy/move
-    MultiExceptionHandler()                                        = default;
-    MultiExceptionHandler(MultiExceptionHandler&&)                 = default;
-    MultiExceptionHandler& operator=(MultiExceptionHandler&&)      = default;
-    MultiExceptionHandler(const MultiExceptionHandler&)            = default;
-    MultiExceptionHandler& operator=(const MultiExceptionHandler&) = default;
+    // Construct with no exceptions
+    MultiExceptionHandler() = default;
+
+    // Copy/move the stored exceptions but not the mutex
+    MultiExceptionHandler(MultiExceptionHandler&&);
+    MultiExceptionHandler& operator=(MultiExceptionHandler&&);
+    MultiExceptionHandler(const MultiExceptionHandler&);
+    MultiExceptionHandler& operator=(const MultiExceptionHandler&);
 
     // Terminate if destroyed without handling exceptions
     ~MultiExceptionHandler();
@@ -62,6 +65,7 @@ class MultiExceptionHandler
 
   private:
     VecExceptionPtr exceptions_;
+    std::mutex      mutex_;
 };
 
 //---------------------------------------------------------------------------//
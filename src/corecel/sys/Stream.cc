@@ -0,0 +1,265 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/Stream.cc
+//---------------------------------------------------------------------------//
+#include "Stream.hh"
+
+#include <cstring>
+#include <future>
+#include <memory>
+#include <thread>
+#include <utility>
+
+#include "corecel/device_runtime_api.h"
+#include "corecel/Macros.hh"
+
+#include "Device.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Stream implementation.
+ *
+ * Host operations are executed in order by a single persistent worker thread
+ * that is created with the stream. As in \c ThreadPool, the worker waits on a
+ * future that is fulfilled with the next task, and each task holds the future
+ * for its successor. A task without a destination tells the worker to exit;
+ * the destructor enqueues one and joins the worker, so pending host work is
+ * always completed before the stream is released.
+ */
+struct Stream::Impl
+{
+    struct Task
+    {
+        using SPTask = std::shared_ptr<Task>;
+
+        void*               dst{nullptr};
+        const void*         src{nullptr};
+        std::size_t         num_bytes{0};
+        std::promise<void>  done;
+        std::future<SPTask> next;
+    };
+
+    using SPTask = std::shared_ptr<Task>;
+
+    MemSpace memspace;
+#if CELER_USE_DEVICE
+    CELER_DEVICE_PREFIX(Stream_t) stream{nullptr};
+    CELER_DEVICE_PREFIX(Event_t) event{nullptr};
+#endif
+    std::promise<SPTask> next_task;
+    std::future<void>    last_done;
+    std::thread          worker;
+
+    // Add a task to the end of the host queue
+    void enqueue(SPTask task);
+
+    // Execute host tasks until a stop task is received
+    static void work(std::future<SPTask> pending);
+
+    ~Impl();
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add a task to the end of the host queue.
+ */
+void Stream::Impl::enqueue(SPTask task)
+{
+    std::promise<SPTask> successor;
+    task->next = successor.get_future();
+    next_task.set_value(std::move(task));
+    next_task = std::move(successor);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute host tasks until a stop task is received.
+ */
+void Stream::Impl::work(std::future<SPTask> pending)
+{
+    while (true)
+    {
+        SPTask task = pending.get();
+        if (!task->dst)
+        {
+            // Stream is being destroyed
+            return;
+        }
+        std::memcpy(task->dst, task->src, task->num_bytes);
+
+        // Save the next task before signaling completion
+        pending = std::move(task->next);
+        task->done.set_value();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Finish host work and release the device stream.
+ */
+Stream::Impl::~Impl()
+{
+    if (worker.joinable())
+    {
+        this->enqueue(std::make_shared<Task>());
+        worker.join();
+    }
+#if CELER_USE_DEVICE
+    if (stream)
+    {
+        try
+        {
+            CELER_DEVICE_CALL_PREFIX(EventDestroy(event));
+            CELER_DEVICE_CALL_PREFIX(StreamDestroy(stream));
+        }
+        catch (const RuntimeError&)
+        {
+            // Don't throw from the destructor
+        }
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+//! Construct without a stream
+Stream::Stream() = default;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a new stream for the given memory space.
+ *
+ * Device streams are created non-blocking: otherwise they would synchronize
+ * with the legacy default stream that kernels are launched on, and copies
+ * could never overlap with them.
+ */
+Stream::Stream(MemSpace m) : impl_(std::make_unique<Impl>())
+{
+    impl_->memspace = m;
+    if (m == MemSpace::device)
+    {
+        CELER_VALIDATE(celeritas::device(),
+                       << "device streams require an active device");
+#if CELER_USE_DEVICE
+        CELER_DEVICE_CALL_PREFIX(StreamCreateWithFlags(
+            &impl_->stream, CELER_DEVICE_PREFIX(StreamNonBlocking)));
+        CELER_DEVICE_CALL_PREFIX(EventCreateWithFlags(
+            &impl_->event, CELER_DEVICE_PREFIX(EventDisableTiming)));
+#endif
+    }
+    else
+    {
+        impl_->worker = std::thread(&Impl::work,
+                                    impl_->next_task.get_future());
+    }
+}
+
+//---------------------------------------------------------------------------//
+//! Wait for pending work and release resources
+Stream::~Stream() = default;
+
+//---------------------------------------------------------------------------//
+//!@{
+//! Move construct and assign
+Stream::Stream(Stream&&) noexcept            = default;
+Stream& Stream::operator=(Stream&&) noexcept = default;
+//!@}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Memory space whose work is queued on this stream.
+ */
+MemSpace Stream::memspace() const
+{
+    CELER_EXPECT(*this);
+    return impl_->memspace;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Enqueue a copy of raw memory.
+ *
+ * On device, the direction of the copy is inferred from the pointers using
+ * unified virtual addressing.
+ */
+void Stream::copy_async(void* dst, const void* src, std::size_t num_bytes)
+{
+    CELER_EXPECT(*this);
+    CELER_EXPECT(dst && src);
+
+    if (impl_->memspace == MemSpace::device)
+    {
+#if CELER_USE_DEVICE
+        CELER_DEVICE_CALL_PREFIX(
+            MemcpyAsync(dst,
+                        src,
+                        num_bytes,
+                        CELER_DEVICE_PREFIX(MemcpyDefault),
+                        impl_->stream));
+#else
+        CELER_ASSERT_UNREACHABLE();
+#endif
+        return;
+    }
+
+    auto task       = std::make_shared<Impl::Task>();
+    task->dst       = dst;
+    task->src       = src;
+    task->num_bytes = num_bytes;
+
+    impl_->last_done = task->done.get_future();
+    impl_->enqueue(std::move(task));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wait for all enqueued operations to complete.
+ */
+void Stream::sync()
+{
+    CELER_EXPECT(*this);
+
+    if (impl_->memspace == MemSpace::device)
+    {
+#if CELER_USE_DEVICE
+        CELER_DEVICE_CALL_PREFIX(StreamSynchronize(impl_->stream));
+#endif
+        return;
+    }
+
+    if (impl_->last_done.valid())
+    {
+        impl_->last_done.get();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Make later work on the default stream wait for enqueued operations.
+ *
+ * On device this records an event on the stream that the default stream waits
+ * on, so the calling thread isn't blocked. Host work on the default "stream"
+ * is executed by the calling thread, so on host this is the same as \c sync .
+ */
+void Stream::fence()
+{
+    CELER_EXPECT(*this);
+
+    if (impl_->memspace == MemSpace::device)
+    {
+#if CELER_USE_DEVICE
+        CELER_DEVICE_CALL_PREFIX(EventRecord(impl_->event, impl_->stream));
+        CELER_DEVICE_CALL_PREFIX(StreamWaitEvent(nullptr, impl_->event, 0));
+#endif
+        return;
+    }
+
+    this->sync();
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,109 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/Stream.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * In-order queue of asynchronous memory operations.
+ *
+ * On device this wraps a non-blocking CUDA or HIP stream, so that copies
+ * enqueued on it can overlap with kernels running on the default stream. On
+ * host, the enqueued operations are executed in order on a separate thread:
+ * this allows the asynchronous code paths to be exercised (and to overlap with
+ * work on the calling thread) without a GPU.
+ *
+ * Memory passed to \c copy_async must not be modified or deallocated until
+ * \c sync is called or until work launched after \c fence on the default
+ * stream has completed.
+ *
+ * \code
+    Stream stream(MemSpace::device);
+    stream.copy_async(device_span, make_span(pinned_host_vec));
+    // ... launch unrelated kernels ...
+    stream.fence();
+    // ... launch kernels that read device_span ...
+   \endcode
+ */
+class Stream
+{
+  public:
+    // Construct without a stream
+    Stream();
+
+    // Construct with a new stream for the given memory space
+    explicit Stream(MemSpace m);
+
+    // Wait for pending work and release resources
+    ~Stream();
+
+    //!@{
+    //! Prohibit copying but allow moving
+    Stream(Stream&&) noexcept;
+    Stream& operator=(Stream&&) noexcept;
+    Stream(const Stream&)            = delete;
+    Stream& operator=(const Stream&) = delete;
+    //!@}
+
+    //! Whether the stream is assigned
+    explicit operator bool() const { return static_cast<bool>(impl_); }
+
+    // Memory space whose work is queued on this stream
+    MemSpace memspace() const;
+
+    // Enqueue a copy of raw memory
+    void copy_async(void* dst, const void* src, std::size_t num_bytes);
+
+    // Enqueue a copy of a contiguous range of data
+    template<class T>
+    inline void copy_async(Span<T> dst, Span<const T> src);
+
+    // Wait for all enqueued operations to complete
+    void sync();
+
+    // Make later work on the default stream wait for enqueued operations
+    void fence();
+
+  private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Enqueue a copy of a contiguous range of data.
+ *
+ * On device, either argument may be in host (preferably pinned) or device
+ * memory.
+ */
+template<class T>
+void Stream::copy_async(Span<T> dst, Span<const T> src)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Data must be trivially copyable");
+    CELER_EXPECT(dst.size() == src.size());
+    if (src.empty())
+    {
+        return;
+    }
+    this->copy_async(dst.data(), src.data(), src.size() * sizeof(T));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,239 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/ThreadPool.cc
+//---------------------------------------------------------------------------//
+#include "ThreadPool.hh"
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/math/Algorithms.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Contiguous range of chunks initially assigned to a single thread.
+ *
+ * The padding keeps the counters of different threads on separate cache
+ * lines.
+ */
+struct ChunkBlock
+{
+    std::atomic<size_type> next{0};
+    size_type              end{0};
+    char padding[64 - sizeof(std::atomic<size_type>) - sizeof(size_type)];
+};
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Thread pool implementation.
+ *
+ * Workers wait on a shared future that is fulfilled with the next job. Each
+ * job holds the future for its successor, so a worker that finishes one loop
+ * can wait for the next without any other synchronization with the calling
+ * thread. A job without a function tells the workers to exit.
+ */
+struct ThreadPool::Impl
+{
+    struct Job
+    {
+        using SPJob = std::shared_ptr<Job>;
+
+        ChunkFunc               func{nullptr};
+        void*                   context{nullptr};
+        size_type               size{0};
+        size_type               grain{1};
+        std::vector<ChunkBlock> blocks;
+
+        std::atomic<size_type> remaining{0};
+        std::promise<void>     done;
+        std::shared_future<SPJob> next;
+
+        std::mutex         error_mutex;
+        std::exception_ptr error;
+
+        // Construct with the number of participating threads
+        explicit Job(size_type num_threads) : blocks(num_threads) {}
+
+        // Process chunks, starting with those assigned to this thread
+        void execute(size_type thread_index);
+    };
+
+    using SPJob = std::shared_ptr<Job>;
+
+    std::promise<SPJob>      next_job;
+    std::vector<std::thread> workers;
+
+    // Run jobs until a stop job is received
+    static void work(size_type thread_index, std::shared_future<SPJob> pending);
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Process chunks, starting with those assigned to this thread.
+ *
+ * After its own block is exhausted, a thread steals chunks from the blocks of
+ * the following threads.
+ */
+void ThreadPool::Impl::Job::execute(size_type thread_index)
+{
+    const size_type num_blocks = blocks.size();
+    for (auto offset : range(num_blocks))
+    {
+        ChunkBlock& block = blocks[(thread_index + offset) % num_blocks];
+        for (size_type chunk = block.next.fetch_add(1);
+             chunk < block.end;
+             chunk = block.next.fetch_add(1))
+        {
+            size_type begin = chunk * grain;
+            size_type end   = celeritas::min(begin + grain, size);
+            try
+            {
+                func(context, begin, end);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> scoped_lock{error_mutex};
+                if (!error)
+                {
+                    error = std::current_exception();
+                }
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Run jobs until a stop job is received.
+ */
+void ThreadPool::Impl::work(size_type                 thread_index,
+                            std::shared_future<SPJob> pending)
+{
+    while (true)
+    {
+        SPJob job = pending.get();
+        if (!job->func)
+        {
+            // Pool is being destroyed
+            return;
+        }
+        job->execute(thread_index);
+
+        // Save the next job before signaling completion
+        pending = job->next;
+        if (job->remaining.fetch_sub(1) == 1)
+        {
+            job->done.set_value();
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the total number of threads and default grain size.
+ *
+ * The calling thread participates in every loop, so \c num_threads - 1
+ * worker threads are created.
+ */
+ThreadPool::ThreadPool(Options options)
+    : options_(options), impl_(std::make_unique<Impl>())
+{
+    CELER_EXPECT(options_);
+
+    auto pending = impl_->next_job.get_future().share();
+    impl_->workers.reserve(options_.num_threads - 1);
+    for (auto i : range<size_type>(1, options_.num_threads))
+    {
+        impl_->workers.emplace_back(&Impl::work, i, pending);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Stop and join all worker threads.
+ */
+ThreadPool::~ThreadPool()
+{
+    impl_->next_job.set_value(std::make_shared<Impl::Job>(0));
+    for (std::thread& t : impl_->workers)
+    {
+        t.join();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Total number of threads, including the calling thread.
+ */
+size_type ThreadPool::num_threads() const
+{
+    return impl_->workers.size() + 1;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute a type-erased function over chunks of the index range.
+ */
+void ThreadPool::run(size_type size, size_type grain, ChunkFunc func, void* ctx)
+{
+    CELER_EXPECT(size > 0 && grain > 0);
+    CELER_EXPECT(func);
+
+    if (impl_->workers.empty() || size <= grain)
+    {
+        // Don't wake the workers for a single chunk
+        func(ctx, 0, size);
+        return;
+    }
+
+    // Assign contiguous blocks of chunks to each thread
+    const size_type num_threads = this->num_threads();
+    const std::size_t num_chunks = ceil_div(size, grain);
+    auto job = std::make_shared<Impl::Job>(num_threads);
+    job->func      = func;
+    job->context   = ctx;
+    job->size      = size;
+    job->grain     = grain;
+    job->remaining = impl_->workers.size();
+    for (auto i : range(num_threads))
+    {
+        job->blocks[i].next = i * num_chunks / num_threads;
+        job->blocks[i].end  = (i + 1) * num_chunks / num_threads;
+    }
+
+    // Chain the next job and wake the workers
+    std::promise<Impl::SPJob> next_job;
+    job->next = next_job.get_future().share();
+    auto done = job->done.get_future();
+    impl_->next_job.set_value(job);
+    impl_->next_job = std::move(next_job);
+
+    // Work on the calling thread and wait for the workers to finish
+    job->execute(0);
+    done.wait();
+
+    if (job->error)
+    {
+        std::rethrow_exception(job->error);
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,141 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/ThreadPool.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Persistent pool of host threads for executing parallel loops.
+ *
+ * The worker threads are created at construction and sleep between loops.
+ * Each call to \c parallel_for divides the index range into chunks of
+ * \c grain_size elements, assigns a contiguous block of chunks to each
+ * thread (including the calling thread), and lets threads that finish their
+ * own block steal the remaining chunks of other threads. The call returns
+ * once every index has been processed.
+ *
+ * If the loop body throws, remaining chunks are still executed and the first
+ * exception is rethrown on the calling thread.
+ *
+ * \code
+    ThreadPool pool({4, 128});
+    pool.parallel_for(states.size(), [&](size_type i) { launch(ThreadId{i}); });
+   \endcode
+ *
+ * \note Only one thread at a time may call \c parallel_for .
+ */
+class ThreadPool
+{
+  public:
+    //! Construction options
+    struct Options
+    {
+        size_type num_threads{}; //!< Total threads, including the caller
+        size_type grain_size{256}; //!< Default number of indices per chunk
+
+        //! Whether the options describe a thread pool
+        explicit operator bool() const
+        {
+            return num_threads > 0 && grain_size > 0;
+        }
+    };
+
+  public:
+    // Construct with the total number of threads and default grain size
+    explicit ThreadPool(Options options);
+
+    // Stop and join all worker threads
+    ~ThreadPool();
+
+    //!@{
+    //! Prohibit copying and moving
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    //!@}
+
+    // Total number of threads, including the calling thread
+    size_type num_threads() const;
+
+    //! Default number of indices per chunk
+    size_type grain_size() const { return options_.grain_size; }
+
+    // Call a function for every index in [0, size) with the default grain
+    template<class F>
+    inline void parallel_for(size_type size, F&& func);
+
+    // Call a function for every index in [0, size) with the given grain
+    template<class F>
+    inline void parallel_for(size_type size, size_type grain, F&& func);
+
+  private:
+    //// TYPES ////
+
+    using ChunkFunc = void (*)(void*, size_type, size_type);
+    struct Impl;
+
+    //// DATA ////
+
+    Options               options_;
+    std::unique_ptr<Impl> impl_;
+
+    //// HELPER FUNCTIONS ////
+
+    // Execute a type-erased function over chunks of the index range
+    void run(size_type size, size_type grain, ChunkFunc func, void* context);
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Call a function for every index in [0, size) with the default grain.
+ */
+template<class F>
+void ThreadPool::parallel_for(size_type size, F&& func)
+{
+    this->parallel_for(size, options_.grain_size, std::forward<F>(func));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Call a function for every index in [0, size) with the given grain.
+ *
+ * The function must be safe to call concurrently from multiple threads.
+ */
+template<class F>
+void ThreadPool::parallel_for(size_type size, size_type grain, F&& func)
+{
+    CELER_EXPECT(grain > 0);
+    using FuncT = std::remove_reference_t<F>;
+
+    if (size == 0)
+        return;
+
+    ChunkFunc call_chunk = [](void* context, size_type begin, size_type end) {
+        FuncT& f = *static_cast<FuncT*>(context);
+        for (size_type i = begin; i != end; ++i)
+        {
+            f(i);
+        }
+    };
+    this->run(size,
+              grain,
+              call_chunk,
+              const_cast<void*>(static_cast<const void*>(&func)));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
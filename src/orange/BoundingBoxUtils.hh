@@ -0,0 +1,124 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/BoundingBoxUtils.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/math/Algorithms.hh"
+
+#include "BoundingBox.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Whether a point is inside or on the boundary of a bounding box.
+ */
+inline CELER_FUNCTION bool is_inside(const BoundingBox& bbox, const Real3& pos)
+{
+    CELER_EXPECT(bbox);
+    const Real3& lower = bbox.lower();
+    const Real3& upper = bbox.upper();
+    return lower[0] <= pos[0] && pos[0] <= upper[0] && lower[1] <= pos[1]
+           && pos[1] <= upper[1] && lower[2] <= pos[2] && pos[2] <= upper[2];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether all the extents of a bounding box are finite.
+ */
+inline CELER_FUNCTION bool is_finite(const BoundingBox& bbox)
+{
+    CELER_EXPECT(bbox);
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        if (std::isinf(bbox.lower()[ax]) || std::isinf(bbox.upper()[ax]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the center of a finite bounding box.
+ */
+inline CELER_FUNCTION Real3 calc_center(const BoundingBox& bbox)
+{
+    CELER_EXPECT(is_finite(bbox));
+    Real3 result;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        result[ax] = (bbox.lower()[ax] + bbox.upper()[ax]) / 2;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the smallest bounding box enclosing two others.
+ *
+ * An unassigned bounding box is treated as empty, so the union with it is the
+ * other bounding box.
+ */
+inline CELER_FUNCTION BoundingBox calc_union(const BoundingBox& a,
+                                             const BoundingBox& b)
+{
+    if (!a)
+    {
+        return b;
+    }
+    if (!b)
+    {
+        return a;
+    }
+
+    Real3 lower;
+    Real3 upper;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        lower[ax] = celeritas::min(a.lower()[ax], b.lower()[ax]);
+        upper[ax] = celeritas::max(a.upper()[ax], b.upper()[ax]);
+    }
+    return {lower, upper};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the overlapping region of two bounding boxes.
+ *
+ * If the two do not overlap (or either is unassigned) the result is an
+ * unassigned bounding box.
+ */
+inline CELER_FUNCTION BoundingBox calc_intersection(const BoundingBox& a,
+                                                    const BoundingBox& b)
+{
+    if (!a || !b)
+    {
+        return {};
+    }
+
+    Real3 lower;
+    Real3 upper;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        lower[ax] = celeritas::max(a.lower()[ax], b.lower()[ax]);
+        upper[ax] = celeritas::min(a.upper()[ax], b.upper()[ax]);
+        if (lower[ax] > upper[ax])
+        {
+            return {};
+        }
+    }
+    return {lower, upper};
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
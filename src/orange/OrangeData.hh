@@ -9,9 +9,11 @@
 
 #include "corecel/OpaqueId.hh"
 #include "corecel/data/Collection.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
 #include "corecel/data/CollectionBuilder.hh"
 #include "corecel/sys/ThreadId.hh"
 
+#include "BoundingBox.hh"
 #include "OrangeTypes.hh"
 
 namespace celeritas
@@ -24,8 +26,7 @@ namespace celeritas
  */
 struct OrangeParamsScalars
 {
-    static constexpr size_type max_level{1};
-
+    size_type max_level{}; //!< Depth of nested universes (1 if not nested)
     size_type max_faces{};
     size_type max_intersections{};
     size_type max_logic_depth{};
@@ -42,18 +43,40 @@ struct OrangeParamsScalars
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Faces of a single surface type within a volume.
+ *
+ * The surface data for the faces is stored as a "structure of arrays": for a
+ * batch of N faces, coefficient \em c of face \em i is at index \em c * N +
+ * \em i in the \c data range. This lets the host loop over all faces of a
+ * type with unit-stride memory access and no per-face type dispatch.
+ *
+ * Face batches are only used by the host tracker, so their storage is not
+ * copied to the device.
+ */
+struct FaceBatchRecord
+{
+    SurfaceType          type{SurfaceType::size_};
+    ItemRange<FaceId>    faces;
+    ItemRange<real_type> data;
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Data for a single volume definition.
  *
- * Surface IDs are local to the unit.
+ * Surface IDs are local to the unit. The daughter translation is an index
+ * into the translations of all units. The face batches group the faces by
+ * surface type for intersecting on the host.
  *
  * \sa VolumeView
  */
 struct VolumeRecord
 {
-    ItemRange<SurfaceId> faces;
-    ItemRange<logic_int> logic;
+    ItemRange<SurfaceId>       faces;
+    ItemRange<logic_int>       logic;
+    ItemRange<FaceBatchRecord> face_batches;
 
     logic_int     max_intersections{0};
     logic_int     flags{0};
@@ -66,7 +89,7 @@ struct VolumeRecord
     {
         internal_surfaces = 0x1, //!< "Complex" distance-to-boundary
         implicit_vol      = 0x2, //!< Background/exterior volume
-        simple_safety     = 0x4, //!< Fast safety calculation
+        simple_safety     = 0x4, //!< Exact safety calculation
         embedded_universe = 0x8  //!< Volume contains embeddded universe
     };
 };
@@ -104,16 +127,38 @@ struct SurfacesRecord
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Node of a bounding volume hierarchy used to find candidate volumes.
+ *
+ * The nodes of a unit are stored in depth-first order, so the first child of
+ * a node (if any) immediately follows it. The \c escape index, relative to
+ * the start of the unit's nodes, is the next node to visit after the subtree
+ * rooted at this node: it's where the search jumps when a point is outside
+ * this node's bounding box. The \c volumes of a node must be tested if the
+ * point is inside its bounding box.
+ */
+struct BvhNode
+{
+    BoundingBox         bbox;
+    ItemRange<VolumeId> volumes;
+    size_type           escape{};
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Data for surface-to-volume connectivity.
  *
  * This struct is associated with a specific surface; the \c neighbors range is
- * a list of local volume IDs for that surface.
+ * a list of local volume IDs for that surface. Surfaces shared by many
+ * volumes (e.g. the sides of a stack of layers) also have a bounding volume
+ * hierarchy of the neighbors, so that crossing the surface only tests volumes
+ * near the crossing point.
  */
 struct Connectivity
 {
     ItemRange<VolumeId> neighbors;
+    ItemRange<BvhNode>  bvh;
 };
 
 //---------------------------------------------------------------------------//
@@ -131,11 +176,13 @@ struct SimpleUnitRecord
     // Volume data [index by VolumeId]
     VolumeRecordRange volumes;
 
-    // Translation data [index by TranslationId]
+    // Translations of daughter universes embedded in this unit
     ItemRange<Translation> translations;
 
+    // Acceleration structure for initialization
+    ItemRange<BvhNode> bvh;
+
     // TODO: transforms
-    // TODO: acceleration structure (bvh/kdtree/grid)
     VolumeId background{}; //!< Default if not in any other volume
     bool     simple_safety{};
 
@@ -143,7 +190,52 @@ struct SimpleUnitRecord
     explicit CELER_FUNCTION operator bool() const
     {
         return surfaces && connectivity.size() == surfaces.types.size()
-               && !volumes.empty();
+               && !volumes.empty() && !bvh.empty();
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Data for a rectilinear array of cells filled with daughter universes.
+ *
+ * The grid along each axis is the sorted list of cell edges, so an array with
+ * N cells along an axis has N + 1 edges. The edges are the local surfaces,
+ * numbered consecutively along x, then y, then z. The cells are the local
+ * volumes, numbered with z varying fastest. If the edges along an axis are
+ * evenly spaced, the cell width is stored so that the cell index can be
+ * calculated directly from the position.
+ */
+struct RectArrayRecord
+{
+    using VolumeRecordRange = Range<VolumeId>;
+    using SurfaceGrid       = Array<ItemRange<real_type>, 3>;
+
+    // Volume data [index by VolumeId]
+    VolumeRecordRange volumes;
+
+    // Translations of daughter universes embedded in this array
+    ItemRange<Translation> translations;
+
+    // Cell edges along each axis
+    SurfaceGrid grid;
+
+    // Cell width along each axis if evenly spaced, otherwise zero
+    Real3 uniform_width{0, 0, 0};
+
+    //! Number of cells along an axis
+    CELER_FUNCTION size_type num_cells(Axis ax) const
+    {
+        return grid[static_cast<int>(ax)].size() - 1;
+    }
+
+    //! True if defined
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return grid[0].size() >= 2 && grid[1].size() >= 2
+               && grid[2].size() >= 2
+               && volumes.size()
+                      == this->num_cells(Axis::x) * this->num_cells(Axis::y)
+                             * this->num_cells(Axis::z);
     }
 };
 
@@ -210,6 +302,7 @@ struct OrangeParamsData
     UnivItems<UniverseType> universe_type;
     UnivItems<size_type>    universe_index;
     Items<SimpleUnitRecord> simple_unit;
+    Items<RectArrayRecord>  rect_arrays;
 
     // Low-level storage
     Items<SurfaceId>          surface_ids;
@@ -221,6 +314,10 @@ struct OrangeParamsData
     Items<Connectivity>       connectivities;
     VolumeItems<VolumeRecord> volume_records;
     Items<Translation>        translations;
+    Items<BvhNode>            bvh_nodes;
+    Items<FaceId>             face_ids;
+    Items<FaceBatchRecord>    face_batches;
+    Items<real_type>          face_batch_reals;
 
     UnitIndexerData<W, M> unit_indexer_data;
 
@@ -245,6 +342,7 @@ struct OrangeParamsData
         universe_type  = other.universe_type;
         universe_index = other.universe_index;
         simple_unit    = other.simple_unit;
+        rect_arrays    = other.rect_arrays;
 
         surface_ids       = other.surface_ids;
         volume_ids        = other.volume_ids;
@@ -255,8 +353,17 @@ struct OrangeParamsData
         connectivities    = other.connectivities;
         volume_records    = other.volume_records;
         translations      = other.translations;
+        bvh_nodes         = other.bvh_nodes;
         unit_indexer_data = other.unit_indexer_data;
 
+        if (M == MemSpace::host)
+        {
+            // Face batches are only used by the host tracker
+            face_ids         = other.face_ids;
+            face_batches     = other.face_batches;
+            face_batch_reals = other.face_batch_reals;
+        }
+
         CELER_ENSURE(static_cast<bool>(*this) == static_cast<bool>(other));
         return *this;
     }
@@ -267,6 +374,9 @@ struct OrangeParamsData
 //---------------------------------------------------------------------------//
 /*!
  * ORANGE state data.
+ *
+ * Persistent per-track data must also be visited by \c for_each_track_items
+ * so that track slots can be reordered.
  */
 template<Ownership W, MemSpace M>
 struct OrangeStateData
@@ -280,16 +390,44 @@ struct OrangeStateData
 
     //// DATA ////
 
-    // For each track, one per max_level
-    StateItems<Real3>    pos;
-    StateItems<Real3>    dir;
-    StateItems<VolumeId> vol;
+    // For each track: current and surface-crossing level
+    StateItems<LevelId> level;
+    StateItems<LevelId> surface_level;
 
-    // Surface crossing
+    // Surface crossing, local to the surface level
     StateItems<SurfaceId>      surf;
     StateItems<Sense>          sense;
     StateItems<BoundaryResult> boundary;
 
+    // For each track, one per max_level: [level][track] so that the first
+    // num_tracks items are the global (outermost level) state
+    StateItems<Real3>      pos;
+    StateItems<Real3>      dir;
+    StateItems<VolumeId>   vol;
+    StateItems<UniverseId> universe;
+
+    // Distance to the next boundary along the current direction, and the
+    // surface and level it's on; a zero distance means it's not cached
+    StateItems<real_type> next_step;
+    StateItems<SurfaceId> next_surf;
+    StateItems<Sense>     next_sense;
+    StateItems<LevelId>   next_level;
+
+    // Center and radius of the last sphere known to contain no boundary; a
+    // zero radius means there's no cached safety
+    StateItems<Real3>     safety_pos;
+    StateItems<real_type> safety_radius;
+
+    // Number of times the cached next step and safety were reused or
+    // recalculated (reported by geo-bench)
+    StateItems<size_type> next_step_hits;
+    StateItems<size_type> next_step_misses;
+    StateItems<size_type> safety_hits;
+    StateItems<size_type> safety_misses;
+
+    // Number of candidate volumes tested while initializing and crossing
+    StateItems<size_type> volumes_tested;
+
     // Scratch space
     Items<Sense>     temp_sense;    // [track][max_faces]
     Items<FaceId>    temp_face;     // [track][max_intersections]
@@ -302,12 +440,27 @@ struct OrangeStateData
     explicit CELER_FUNCTION operator bool() const
     {
         // clang-format off
-        return !pos.empty()
+        return !level.empty()
+            && surface_level.size() == level.size()
+            && surf.size() == level.size()
+            && sense.size() == level.size()
+            && boundary.size() == level.size()
+            && pos.size() >= level.size()
+            && pos.size() % level.size() == 0
             && dir.size() == pos.size()
             && vol.size() == pos.size()
-            && surf.size() == pos.size()
-            && sense.size() == pos.size()
-            && boundary.size() == pos.size()
+            && universe.size() == pos.size()
+            && next_step.size() == level.size()
+            && next_surf.size() == level.size()
+            && next_sense.size() == level.size()
+            && next_level.size() == level.size()
+            && safety_pos.size() == level.size()
+            && safety_radius.size() == level.size()
+            && next_step_hits.size() == level.size()
+            && next_step_misses.size() == level.size()
+            && safety_hits.size() == level.size()
+            && safety_misses.size() == level.size()
+            && volumes_tested.size() == level.size()
             && !temp_sense.empty()
             && !temp_face.empty()
             && temp_distance.size() == temp_face.size()
@@ -316,7 +469,7 @@ struct OrangeStateData
     }
 
     //! State size
-    CELER_FUNCTION ThreadId::size_type size() const { return pos.size(); }
+    CELER_FUNCTION ThreadId::size_type size() const { return level.size(); }
 
     //! Assign from another set of data
     template<Ownership W2, MemSpace M2>
@@ -324,12 +477,29 @@ struct OrangeStateData
     {
         CELER_EXPECT(other);
 
+        level         = other.level;
+        surface_level = other.surface_level;
+        surf          = other.surf;
+        sense         = other.sense;
+        boundary      = other.boundary;
+
         pos      = other.pos;
         dir      = other.dir;
         vol      = other.vol;
-        surf     = other.surf;
-        sense    = other.sense;
-        boundary = other.boundary;
+        universe = other.universe;
+
+        next_step     = other.next_step;
+        next_surf     = other.next_surf;
+        next_sense    = other.next_sense;
+        next_level    = other.next_level;
+        safety_pos    = other.safety_pos;
+        safety_radius = other.safety_radius;
+
+        next_step_hits   = other.next_step_hits;
+        next_step_misses = other.next_step_misses;
+        safety_hits      = other.safety_hits;
+        safety_misses    = other.safety_misses;
+        volumes_tested   = other.volumes_tested;
 
         temp_sense    = other.temp_sense;
         temp_face     = other.temp_face;
@@ -352,13 +522,39 @@ inline void resize(OrangeStateData<Ownership::value, M>* data,
 {
     CELER_EXPECT(data);
     CELER_EXPECT(size > 0);
-    resize(&data->pos, size);
-    resize(&data->dir, size);
-    resize(&data->vol, size);
+    resize(&data->level, size);
+    resize(&data->surface_level, size);
     resize(&data->surf, size);
     resize(&data->sense, size);
     resize(&data->boundary, size);
 
+    size_type level_states = params.scalars.max_level * size;
+    resize(&data->pos, level_states);
+    resize(&data->dir, level_states);
+    resize(&data->vol, level_states);
+    resize(&data->universe, level_states);
+
+    resize(&data->next_step, size);
+    resize(&data->next_surf, size);
+    resize(&data->next_sense, size);
+    resize(&data->next_level, size);
+    resize(&data->safety_pos, size);
+    resize(&data->safety_radius, size);
+    fill(real_type(0), &data->next_step);
+    fill(real_type(0), &data->safety_radius);
+
+    resize(&data->next_step_hits, size);
+    resize(&data->next_step_misses, size);
+    resize(&data->safety_hits, size);
+    resize(&data->safety_misses, size);
+    fill(size_type(0), &data->next_step_hits);
+    fill(size_type(0), &data->next_step_misses);
+    fill(size_type(0), &data->safety_hits);
+    fill(size_type(0), &data->safety_misses);
+
+    resize(&data->volumes_tested, size);
+    fill(size_type(0), &data->volumes_tested);
+
     size_type face_states = params.scalars.max_faces * size;
     resize(&data->temp_sense, face_states);
 
@@ -370,5 +566,38 @@ inline void resize(OrangeStateData<Ownership::value, M>* data,
     CELER_ENSURE(*data);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a function to the persistent per-track collections of the state.
+ *
+ * The position, direction, volume, and universe have one block of items per
+ * level, each with one item per track. Scratch space isn't visited.
+ */
+template<Ownership W, MemSpace M, class F>
+inline void
+for_each_track_items(const OrangeStateData<W, M>& state, F&& visit)
+{
+    visit(state.level);
+    visit(state.surface_level);
+    visit(state.surf);
+    visit(state.sense);
+    visit(state.boundary);
+    visit(state.pos);
+    visit(state.dir);
+    visit(state.vol);
+    visit(state.universe);
+    visit(state.next_step);
+    visit(state.next_surf);
+    visit(state.next_sense);
+    visit(state.next_level);
+    visit(state.safety_pos);
+    visit(state.safety_radius);
+    visit(state.next_step_hits);
+    visit(state.next_step_misses);
+    visit(state.safety_hits);
+    visit(state.safety_misses);
+    visit(state.volumes_tested);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
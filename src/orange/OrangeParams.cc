@@ -10,6 +10,8 @@
 #include <algorithm>
 #include <fstream>
 #include <initializer_list>
+#include <sstream>
+#include <string>
 
 #include "celeritas_config.h"
 #include "corecel/Assert.hh"
@@ -25,6 +27,7 @@
 #include "OrangeData.hh"
 #include "OrangeTypes.hh"
 #include "construct/OrangeInput.hh"
+#include "detail/RectArrayInserter.hh"
 #include "detail/UnitInserter.hh"
 #include "univ/detail/LogicStack.hh"
 
@@ -75,6 +78,54 @@ OrangeInput input_from_json(std::string filename)
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the range of volume records in a universe.
+ */
+Range<VolumeId>
+get_volumes(const HostVal<OrangeParamsData>& data, UniverseId uid)
+{
+    const size_type index = data.universe_index[uid];
+    switch (data.universe_type[uid])
+    {
+        case UniverseType::simple:
+            return data.simple_unit[SimpleUnitId{index}].volumes;
+        case UniverseType::rect_array:
+            return data.rect_arrays[RectArrayId{index}].volumes;
+        default:
+            CELER_ASSERT_UNREACHABLE();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the depth of the universe hierarchy starting at a universe.
+ */
+size_type calc_max_level(const HostVal<OrangeParamsData>& data,
+                         UniverseId                       uid,
+                         size_type                        num_parents)
+{
+    CELER_VALIDATE(num_parents < data.universe_type.size(),
+                   << "universe " << uid.get()
+                   << " is recursively embedded in itself");
+
+    size_type result = 1;
+    for (VolumeId vol_id : get_volumes(data, uid))
+    {
+        UniverseId daughter = data.volume_records[vol_id].daughter;
+        if (!daughter)
+        {
+            continue;
+        }
+        CELER_VALIDATE(daughter < data.universe_type.size(),
+                       << "invalid daughter universe " << daughter.get()
+                       << " in universe " << uid.get());
+        result = std::max(result,
+                          1 + calc_max_level(data, daughter, num_parents + 1));
+    }
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace
 
@@ -118,15 +169,29 @@ OrangeParams::OrangeParams(OrangeInput input)
     auto ui_vol  = make_builder(&host_data.unit_indexer_data.volumes);
     ui_surf.push_back(0);
     ui_vol.push_back(0);
-    for (const UnitInput& u : input.units)
-    {
+    auto push_offsets = [&host_data, &ui_surf, &ui_vol](size_type num_surf,
+                                                        size_type num_vol) {
         using AllVals = AllItems<size_type, MemSpace::native>;
         auto surface_offset
             = host_data.unit_indexer_data.surfaces[AllVals{}].back();
         auto volume_offset
             = host_data.unit_indexer_data.volumes[AllVals{}].back();
-        ui_surf.push_back(surface_offset + u.surfaces.size());
-        ui_vol.push_back(volume_offset + u.volumes.size());
+        ui_surf.push_back(surface_offset + num_surf);
+        ui_vol.push_back(volume_offset + num_vol);
+    };
+    for (const UnitInput& u : input.units)
+    {
+        push_offsets(u.surfaces.size(), u.volumes.size());
+    }
+    for (const RectArrayInput& a : input.rect_arrays)
+    {
+        // Edges are surfaces and cells are volumes
+        size_type num_edges = 0;
+        for (const auto& edges : a.grid)
+        {
+            num_edges += edges.size();
+        }
+        push_offsets(num_edges, a.num_cells());
     }
 
     // Insert all units
@@ -142,6 +207,17 @@ OrangeParams::OrangeParams(OrangeInput input)
         universe_type.push_back(UniverseType::simple);
         universe_index.push_back(uid.get());
     }
+
+    // Insert arrays after all units
+    detail::RectArrayInserter insert_rect_array(&host_data);
+    for (const RectArrayInput& a : input.rect_arrays)
+    {
+        CELER_VALIDATE(
+            a, << "array '" << a.label << "' is not properly constructed");
+        RectArrayId aid = insert_rect_array(a);
+        universe_type.push_back(UniverseType::rect_array);
+        universe_index.push_back(aid.get());
+    }
     CELER_VALIDATE(host_data.scalars.max_logic_depth
                        < detail::LogicStack::max_stack_depth(),
                    << "input geometry has at least one volume with a "
@@ -150,6 +226,8 @@ OrangeParams::OrangeParams(OrangeInput input)
                    << " (surfaces are nested too deeply); but the logic "
                       "stack is limited to a depth of "
                    << detail::LogicStack::max_stack_depth());
+    host_data.scalars.max_level
+        = calc_max_level(host_data, UniverseId{0}, 0);
 
     std::vector<Label> surface_labels;
     std::vector<Label> volume_labels;
@@ -181,6 +259,38 @@ OrangeParams::OrangeParams(OrangeInput input)
         bbox_ = u.bbox;
     }
 
+    for (const RectArrayInput& a : input.rect_arrays)
+    {
+        // Label edges by axis and index, cells by their indices
+        for (auto ax : range(Axis::size_))
+        {
+            const auto& edges = a.grid[static_cast<int>(ax)];
+            for (auto i : range(edges.size()))
+            {
+                surface_labels.push_back(
+                    {to_char(ax) + std::to_string(i), a.label.name});
+            }
+        }
+
+        Array<size_type, 3> num_cells;
+        for (auto ax : range(3))
+        {
+            num_cells[ax] = a.grid[ax].size() - 1;
+        }
+        for (auto i : range(num_cells[0]))
+        {
+            for (auto j : range(num_cells[1]))
+            {
+                for (auto k : range(num_cells[2]))
+                {
+                    std::ostringstream os;
+                    os << '{' << i << ',' << j << ',' << k << '}';
+                    volume_labels.push_back({os.str(), a.label.name});
+                }
+            }
+        }
+    }
+
     surf_labels_ = LabelIdMultiMap<SurfaceId>{std::move(surface_labels)};
     vol_labels_  = LabelIdMultiMap<VolumeId>{std::move(volume_labels)};
 
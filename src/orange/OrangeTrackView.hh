@@ -10,14 +10,18 @@
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
 #include "corecel/cont/Array.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/math/ArrayUtils.hh"
 #include "corecel/sys/ThreadId.hh"
 
 #include "OrangeData.hh"
 #include "OrangeTypes.hh"
+#include "Translator.hh"
+#include "detail/LevelStateAccessor.hh"
 #include "detail/UnitIndexer.hh"
-#include "univ/SimpleUnitTracker.hh"
-#include "univ/UniverseTypeTraits.hh"
+#include "univ/TrackerVisitor.hh"
 #include "univ/detail/Types.hh"
+#include "univ/detail/Utils.hh"
 
 namespace celeritas
 {
@@ -44,6 +48,21 @@ namespace celeritas
  *
  * \c move_internal with a position \em should depend on the safety distance
  * but that's not yet implemented.
+ *
+ * The distance to the next boundary and the safety sphere are stored in the
+ * track state so that they're reused across steps. The next step is reused
+ * until the track changes direction or leaves the straight line, and the
+ * safety sphere is reused while the track stays near its center. The state
+ * counts how often each cache is hit or missed.
+ *
+ * Tracks in nested universes keep a stack of local states, one per level,
+ * with the outermost universe at level zero. The position and direction
+ * accessors and the volume and surface IDs are always global. The distance to
+ * the next boundary is the nearest intersection over all levels; a surface in
+ * a daughter universe that coincides (within the bump distance) with a
+ * surface at a higher level is ignored so that the crossing happens in the
+ * parent. Crossing a surface pops the levels below it and then initializes
+ * into any daughter universes of the new volume.
  */
 class OrangeTrackView
 {
@@ -77,20 +96,25 @@ class OrangeTrackView
     //// ACCESSORS ////
 
     //! The current position
-    CELER_FUNCTION const Real3& pos() const { return states_.pos[thread_]; }
+    CELER_FUNCTION const Real3& pos() const
+    {
+        return this->make_lsa(LevelId{0}).pos();
+    }
     //! The current direction
-    CELER_FUNCTION const Real3& dir() const { return states_.dir[thread_]; }
-    //! The current volume ID (null if outside)
-    CELER_FUNCTION VolumeId volume_id() const { return states_.vol[thread_]; }
-    //! The current surface ID
-    CELER_FUNCTION SurfaceId surface_id() const
+    CELER_FUNCTION const Real3& dir() const
     {
-        return states_.surf[thread_];
+        return this->make_lsa(LevelId{0}).dir();
     }
-    //! After 'find_next_step', the next straight-line surface
-    CELER_FUNCTION SurfaceId next_surface_id() const
+    // The current volume ID (null if outside)
+    inline CELER_FUNCTION VolumeId volume_id() const;
+    // The current surface ID
+    inline CELER_FUNCTION SurfaceId surface_id() const;
+    // After 'find_next_step', the next straight-line surface
+    inline CELER_FUNCTION SurfaceId next_surface_id() const;
+    //! The number of nested universes the track is in
+    CELER_FUNCTION size_type level() const
     {
-        return next_surface_.id();
+        return states_.level[thread_].get();
     }
     // Whether the track is outside the valid geometry region
     CELER_FORCEINLINE_FUNCTION bool is_outside() const;
@@ -124,19 +148,38 @@ class OrangeTrackView
     inline CELER_FUNCTION void set_dir(const Real3& newdir);
 
   private:
+    //// CONSTANTS ////
+
+    //! Fraction of the cached safety below which it's recalculated
+    static CELER_CONSTEXPR_FUNCTION real_type min_safety_fraction()
+    {
+        return 0.5;
+    }
+
     //// DATA ////
 
     const ParamsRef& params_;
     const StateRef&  states_;
     ThreadId         thread_;
 
-    real_type         next_step_{0};   //!< Temporary next step
-    detail::OnSurface next_surface_{}; //!< Temporary next surface
+    real_type& next_step_;          //!< Cached next step
+    SurfaceId& next_surf_;          //!< Surface at the next step
+    Sense&     next_sense_;         //!< Sense before crossing next surface
+    LevelId&   next_surface_level_; //!< Level of next surface
 
     //// HELPER FUNCTIONS ////
 
-    // Create a local tracker
-    inline CELER_FUNCTION SimpleUnitTracker make_tracker(UniverseId) const;
+    // Find the nearest boundary over all levels
+    inline CELER_FUNCTION void find_next_step_impl(real_type max_step);
+
+    // Initialize into the daughter universes of the volume at a level
+    inline CELER_FUNCTION void init_daughters(LevelId level);
+
+    // Access the local state at a level
+    inline CELER_FUNCTION detail::LevelStateAccessor make_lsa(LevelId) const;
+
+    // Get the definition of the volume at a level
+    inline CELER_FUNCTION const VolumeRecord& volume_record(LevelId) const;
 
     // Create local sense reference
     inline CELER_FUNCTION Span<Sense> make_temp_sense() const;
@@ -144,7 +187,7 @@ class OrangeTrackView
     // Create local distance
     inline CELER_FUNCTION detail::TempNextFace make_temp_next() const;
 
-    inline CELER_FUNCTION detail::LocalState make_local_state() const;
+    inline CELER_FUNCTION detail::LocalState make_local_state(LevelId) const;
 
     // Whether the next distance-to-boundary has been found
     CELER_FORCEINLINE_FUNCTION bool has_next_step() const;
@@ -163,13 +206,17 @@ CELER_FUNCTION
 OrangeTrackView::OrangeTrackView(const ParamsRef& params,
                                  const StateRef&  states,
                                  ThreadId         thread)
-    : params_(params), states_(states), thread_(thread)
+    : params_(params)
+    , states_(states)
+    , thread_(thread)
+    , next_step_(states.next_step[thread])
+    , next_surf_(states.next_surf[thread])
+    , next_sense_(states.next_sense[thread])
+    , next_surface_level_(states.next_level[thread])
 {
     CELER_EXPECT(params_);
     CELER_EXPECT(states_);
     CELER_EXPECT(thread < states.size());
-
-    CELER_ENSURE(!this->has_next_step());
 }
 
 //---------------------------------------------------------------------------//
@@ -186,14 +233,14 @@ OrangeTrackView::operator=(const Initializer_t& init)
     CELER_EXPECT(is_soft_unit_vector(init.dir));
 
     // Save known data to global memory
-    states_.pos[thread_]      = init.pos;
-    states_.dir[thread_]      = init.dir;
-    states_.surf[thread_]     = {};
-    states_.sense[thread_]    = {};
-    states_.boundary[thread_] = BoundaryResult::exiting;
+    states_.surface_level[thread_] = {};
+    states_.surf[thread_]          = {};
+    states_.sense[thread_]         = {};
+    states_.boundary[thread_]      = BoundaryResult::exiting;
 
-    // Clear local data
+    // Clear cached data
     this->clear_next_step();
+    states_.safety_radius[thread_] = 0;
 
     // Create local state
     detail::LocalState local;
@@ -203,24 +250,23 @@ OrangeTrackView::operator=(const Initializer_t& init)
     local.surface    = {};
     local.temp_sense = this->make_temp_sense();
 
-    // Initialize logical state
-    UniverseId          uid = top_universe_id();
-    VolumeId            global_vol_id{};
-    detail::UnitIndexer unit_indexer(params_.unit_indexer_data);
+    // Initialize logical state in the outermost universe
+    UniverseId     uid = top_universe_id();
+    TrackerVisitor visit_tracker{params_};
+    auto           tinit = visit_tracker(
+        [&local](const auto& t) { return t.initialize(local); }, uid);
+    // TODO: error correction/graceful failure if initialiation failed
+    CELER_ASSERT(tinit.volume && !tinit.surface);
+    states_.volumes_tested[thread_] += tinit.num_tested;
 
-    // Recurse into daughter universes starting with the outermost universe
-    do
-    {
-        auto tracker = this->make_tracker(uid);
-        auto tinit   = tracker.initialize(local);
-        // TODO: error correction/graceful failure if initialiation failed
-        CELER_ASSERT(tinit.volume && !tinit.surface);
-        global_vol_id = unit_indexer.global_volume(uid, tinit.volume);
-
-        uid = params_.volume_records[global_vol_id].daughter;
-    } while (uid);
+    auto lsa       = this->make_lsa(LevelId{0});
+    lsa.pos()      = init.pos;
+    lsa.dir()      = init.dir;
+    lsa.vol()      = tinit.volume;
+    lsa.universe() = uid;
 
-    states_.vol[thread_] = global_vol_id;
+    // Recurse into daughter universes
+    this->init_daughters(LevelId{0});
 
     CELER_ENSURE(!this->has_next_step());
     return *this;
@@ -234,23 +280,77 @@ CELER_FUNCTION
 OrangeTrackView& OrangeTrackView::operator=(const DetailedInitializer& init)
 {
     CELER_EXPECT(is_soft_unit_vector(init.dir));
-    CELER_EXPECT(states_.vol[init.other.thread_]);
-
-    // Copy init track's position but update the direction
-    states_.pos[thread_]      = states_.pos[init.other.thread_];
-    states_.dir[thread_]      = init.dir;
-    states_.vol[thread_]      = states_.vol[init.other.thread_];
-    states_.surf[thread_]     = states_.surf[init.other.thread_];
-    states_.sense[thread_]    = states_.sense[init.other.thread_];
-    states_.boundary[thread_] = states_.boundary[init.other.thread_];
+    CELER_EXPECT(init.other.make_lsa(LevelId{0}).vol());
+
+    // Copy init track's logical state
+    const ThreadId other = init.other.thread_;
+    states_.level[thread_]         = states_.level[other];
+    states_.surface_level[thread_] = states_.surface_level[other];
+    states_.surf[thread_]          = states_.surf[other];
+    states_.sense[thread_]         = states_.sense[other];
+    states_.boundary[thread_]      = states_.boundary[other];
+
+    // Copy init track's position at each level but update the direction
+    for (auto level : range(LevelId{this->level() + 1}))
+    {
+        auto lsa       = this->make_lsa(level);
+        auto other_lsa = init.other.make_lsa(level);
+        lsa.pos()      = other_lsa.pos();
+        lsa.dir()      = init.dir;
+        lsa.vol()      = other_lsa.vol();
+        lsa.universe() = other_lsa.universe();
+    }
 
-    // Clear step and surface info
+    // Clear step and surface info; the parent's safety sphere is still valid
     this->clear_next_step();
+    states_.safety_pos[thread_]    = states_.safety_pos[other];
+    states_.safety_radius[thread_] = states_.safety_radius[other];
 
     CELER_ENSURE(!this->has_next_step());
     return *this;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * The current global volume ID.
+ */
+CELER_FUNCTION VolumeId OrangeTrackView::volume_id() const
+{
+    auto lsa = this->make_lsa(states_.level[thread_]);
+    return detail::UnitIndexer(params_.unit_indexer_data)
+        .global_volume(lsa.universe(), lsa.vol());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * The current global surface ID.
+ */
+CELER_FUNCTION SurfaceId OrangeTrackView::surface_id() const
+{
+    if (!states_.surf[thread_])
+    {
+        return {};
+    }
+    auto lsa = this->make_lsa(states_.surface_level[thread_]);
+    return detail::UnitIndexer(params_.unit_indexer_data)
+        .global_surface(lsa.universe(), states_.surf[thread_]);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * After 'find_next_step', the next straight-line global surface.
+ */
+CELER_FUNCTION SurfaceId OrangeTrackView::next_surface_id() const
+{
+    if (!this->has_next_step() || !next_surf_)
+    {
+        return {};
+    }
+    auto lsa = this->make_lsa(next_surface_level_);
+    return detail::UnitIndexer(params_.unit_indexer_data)
+        .global_surface(lsa.universe(), next_surf_);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Whether the track is outside the valid geometry region.
@@ -259,7 +359,7 @@ CELER_FUNCTION bool OrangeTrackView::is_outside() const
 {
     // Zeroth volume in outermost universe is always the exterior by
     // construction in ORANGE
-    return states_.vol[thread_] == VolumeId{0};
+    return this->make_lsa(LevelId{0}).vol() == VolumeId{0};
 }
 
 //---------------------------------------------------------------------------//
@@ -268,7 +368,7 @@ CELER_FUNCTION bool OrangeTrackView::is_outside() const
  */
 CELER_FUNCTION bool OrangeTrackView::is_on_boundary() const
 {
-    return static_cast<bool>(this->surface_id());
+    return static_cast<bool>(states_.surf[thread_]);
 }
 
 //---------------------------------------------------------------------------//
@@ -283,23 +383,25 @@ CELER_FUNCTION Propagation OrangeTrackView::find_next_step()
         return {0, true};
     }
 
-    if (!next_surface_ && next_step_ != no_intersection())
+    if (!next_surf_ && next_step_ != no_intersection())
     {
         // Reset a previously found truncated distance
         this->clear_next_step();
     }
 
-    if (!this->has_next_step())
+    if (this->has_next_step())
+    {
+        ++states_.next_step_hits[thread_];
+    }
+    else
     {
-        auto tracker  = this->make_tracker(UniverseId{0});
-        auto isect    = tracker.intersect(this->make_local_state());
-        next_step_    = isect.distance;
-        next_surface_ = isect.surface;
+        ++states_.next_step_misses[thread_];
+        this->find_next_step_impl(no_intersection());
     }
 
     Propagation result;
     result.distance = next_step_;
-    result.boundary = static_cast<bool>(next_surface_);
+    result.boundary = static_cast<bool>(next_surf_);
     return result;
 }
 
@@ -322,25 +424,28 @@ CELER_FUNCTION Propagation OrangeTrackView::find_next_step(real_type max_step)
     else if (next_step_ > max_step)
     {
         // Cached next step is beyond the given step
+        ++states_.next_step_hits[thread_];
         return {max_step, false};
     }
-    else if (!next_surface_ && next_step_ < max_step)
+    else if (!next_surf_ && next_step_ < max_step)
     {
         // Reset a previously found truncated distance
         this->clear_next_step();
     }
 
-    if (!this->has_next_step())
+    if (this->has_next_step())
     {
-        auto tracker  = this->make_tracker(UniverseId{0});
-        auto isect    = tracker.intersect(this->make_local_state(), max_step);
-        next_step_    = isect.distance;
-        next_surface_ = isect.surface;
+        ++states_.next_step_hits[thread_];
+    }
+    else
+    {
+        ++states_.next_step_misses[thread_];
+        this->find_next_step_impl(max_step);
     }
 
     Propagation result;
     result.distance = next_step_;
-    result.boundary = static_cast<bool>(next_surface_);
+    result.boundary = static_cast<bool>(next_surf_);
 
     CELER_ENSURE(result.distance <= max_step);
     return result;
@@ -349,6 +454,12 @@ CELER_FUNCTION Propagation OrangeTrackView::find_next_step(real_type max_step)
 //---------------------------------------------------------------------------//
 /*!
  * Find the distance to the nearest boundary in any direction.
+ *
+ * This is the smallest safety distance over all levels. The result is saved
+ * as a sphere around the current position that contains no boundaries. If
+ * the track has since moved only a short way from its center, the remaining
+ * distance to the edge of the sphere is returned instead: it's a
+ * conservative safety distance that needs no surface calculations.
  */
 CELER_FUNCTION real_type OrangeTrackView::find_safety()
 {
@@ -358,8 +469,39 @@ CELER_FUNCTION real_type OrangeTrackView::find_safety()
         return real_type{0};
     }
 
-    auto tracker = this->make_tracker(UniverseId{0});
-    return tracker.safety(this->pos(), this->volume_id());
+    real_type& radius = states_.safety_radius[thread_];
+    if (radius > 0)
+    {
+        real_type remaining
+            = radius - distance(this->pos(), states_.safety_pos[thread_]);
+        if (remaining > min_safety_fraction() * radius)
+        {
+            // Still well inside the cached safety sphere
+            ++states_.safety_hits[thread_];
+            return remaining;
+        }
+    }
+    ++states_.safety_misses[thread_];
+
+    TrackerVisitor visit_tracker{params_};
+    real_type      result = numeric_limits<real_type>::infinity();
+    for (auto level : range(LevelId{this->level() + 1}))
+    {
+        auto lsa    = this->make_lsa(level);
+        auto safety = visit_tracker(
+            [&lsa](const auto& t) { return t.safety(lsa.pos(), lsa.vol()); },
+            lsa.universe());
+        result = celeritas::min(result, safety);
+        if (result == 0)
+        {
+            break;
+        }
+    }
+
+    // Save the safety sphere
+    states_.safety_pos[thread_] = this->pos();
+    radius                      = result;
+    return result;
 }
 
 //---------------------------------------------------------------------------//
@@ -370,13 +512,18 @@ CELER_FUNCTION void OrangeTrackView::move_to_boundary()
 {
     CELER_EXPECT(states_.boundary[thread_] != BoundaryResult::reentrant);
     CELER_EXPECT(this->has_next_step());
-    CELER_EXPECT(next_surface_);
+    CELER_EXPECT(next_surf_);
 
     // Physically move next step
-    axpy(next_step_, states_.dir[thread_], &states_.pos[thread_]);
+    for (auto level : range(LevelId{this->level() + 1}))
+    {
+        auto lsa = this->make_lsa(level);
+        axpy(next_step_, lsa.dir(), &lsa.pos());
+    }
     // Move to the inside of the surface
-    states_.surf[thread_]  = next_surface_.id();
-    states_.sense[thread_] = next_surface_.unchecked_sense();
+    states_.surface_level[thread_] = next_surface_level_;
+    states_.surf[thread_]          = next_surf_;
+    states_.sense[thread_]         = next_sense_;
     this->clear_next_step();
 }
 
@@ -391,12 +538,17 @@ CELER_FUNCTION void OrangeTrackView::move_internal(real_type dist)
 {
     CELER_EXPECT(this->has_next_step());
     CELER_EXPECT(dist > 0 && dist <= next_step_);
-    CELER_EXPECT(dist != next_step_ || !next_surface_);
+    CELER_EXPECT(dist != next_step_ || !next_surf_);
 
     // Move and update next_step_
-    axpy(dist, states_.dir[thread_], &states_.pos[thread_]);
+    for (auto level : range(LevelId{this->level() + 1}))
+    {
+        auto lsa = this->make_lsa(level);
+        axpy(dist, lsa.dir(), &lsa.pos());
+    }
     next_step_ -= dist;
-    states_.surf[thread_] = {};
+    states_.surface_level[thread_] = {};
+    states_.surf[thread_]          = {};
 }
 
 //---------------------------------------------------------------------------//
@@ -408,8 +560,18 @@ CELER_FUNCTION void OrangeTrackView::move_internal(real_type dist)
  */
 CELER_FUNCTION void OrangeTrackView::move_internal(const Real3& pos)
 {
-    states_.pos[thread_]  = pos;
-    states_.surf[thread_] = {};
+    this->make_lsa(LevelId{0}).pos() = pos;
+    for (auto level : range(LevelId{1}, LevelId{this->level() + 1}))
+    {
+        // Translate from the parent into the daughter
+        const VolumeRecord& parent = this->volume_record(level - 1);
+        TranslatorDown      translate(
+            params_.translations[parent.daughter_translation]);
+        this->make_lsa(level).pos()
+            = translate(this->make_lsa(level - 1).pos());
+    }
+    states_.surface_level[thread_] = {};
+    states_.surf[thread_]          = {};
     this->clear_next_step();
 }
 
@@ -418,7 +580,9 @@ CELER_FUNCTION void OrangeTrackView::move_internal(const Real3& pos)
  * Cross from one side of the current surface to the other.
  *
  * The position *must* be on the boundary following a move-to-boundary. This
- * should only be called once per boundary crossing.
+ * should only be called once per boundary crossing. Levels below the one
+ * containing the surface are discarded, and the new volume's daughter
+ * universes (if any) are entered.
  */
 CELER_FUNCTION void OrangeTrackView::cross_boundary()
 {
@@ -433,17 +597,26 @@ CELER_FUNCTION void OrangeTrackView::cross_boundary()
         return;
     }
 
+    // Pop any levels below the surface being crossed
+    const LevelId level = states_.surface_level[thread_];
+    CELER_ASSERT(!(states_.level[thread_] < level));
+    states_.level[thread_] = level;
+
     // Flip current sense from "before crossing" to "after"
+    auto               lsa = this->make_lsa(level);
     detail::LocalState local;
-    local.pos     = this->pos();
-    local.dir     = this->dir();
-    local.volume  = states_.vol[thread_];
+    local.pos     = lsa.pos();
+    local.dir     = lsa.dir();
+    local.volume  = lsa.vol();
     local.surface = {states_.surf[thread_], flip_sense(states_.sense[thread_])};
     local.temp_sense = this->make_temp_sense();
 
     // Update the post-crossing volume
-    auto tracker = this->make_tracker(UniverseId{0});
-    auto init    = tracker.cross_boundary(local);
+    TrackerVisitor visit_tracker{params_};
+    auto           init = visit_tracker(
+        [&local](const auto& t) { return t.cross_boundary(local); },
+        lsa.universe());
+    states_.volumes_tested[thread_] += init.num_tested;
     CELER_ASSERT(init.volume);
     if (!CELERITAS_DEBUG && CELER_UNLIKELY(!init.volume))
     {
@@ -453,10 +626,13 @@ CELER_FUNCTION void OrangeTrackView::cross_boundary()
         init.volume  = VolumeId{0};
         init.surface = {};
     }
-    states_.vol[thread_]   = init.volume;
+    lsa.vol()              = init.volume;
     states_.surf[thread_]  = init.surface.id();
     states_.sense[thread_] = init.surface.unchecked_sense();
 
+    // Enter any universes embedded in the new volume
+    this->init_daughters(level);
+
     // Reset boundary crossing state
     states_.boundary[thread_] = BoundaryResult::exiting;
 
@@ -483,8 +659,13 @@ CELER_FUNCTION void OrangeTrackView::set_dir(const Real3& newdir)
         // don't leave the volume after all. Evaluate whether the direction
         // dotted with the surface normal changes (i.e. heading from inside to
         // outside or vice versa).
-        auto        tracker = this->make_tracker(UniverseId{0});
-        const Real3 normal  = tracker.normal(this->pos(), this->surface_id());
+        auto           lsa = this->make_lsa(states_.surface_level[thread_]);
+        TrackerVisitor visit_tracker{params_};
+        const Real3    normal = visit_tracker(
+            [&lsa, surf = states_.surf[thread_]](const auto& t) {
+                return t.normal(lsa.pos(), surf);
+            },
+            lsa.universe());
 
         if ((dot_product(normal, newdir) >= 0)
             != (dot_product(normal, this->dir()) >= 0))
@@ -497,7 +678,10 @@ CELER_FUNCTION void OrangeTrackView::set_dir(const Real3& newdir)
     }
 
     // Complete direction setting
-    states_.dir[thread_] = newdir;
+    for (auto level : range(LevelId{this->level() + 1}))
+    {
+        this->make_lsa(level).dir() = newdir;
+    }
 
     this->clear_next_step();
 }
@@ -506,21 +690,132 @@ CELER_FUNCTION void OrangeTrackView::set_dir(const Real3& newdir)
 // PRIVATE MEMBER FUNCTIONS
 //---------------------------------------------------------------------------//
 /*!
- * Create a local tracker for a universe.
+ * Find the nearest boundary over all levels, up to a maximum distance.
+ *
+ * Levels are searched from the outermost inward, and each level only looks
+ * for surfaces closer than the best one so far. A daughter surface must be
+ * closer by more than the bump distance to replace a parent surface, since
+ * the boundary of a daughter universe usually coincides with the boundary of
+ * the volume it's placed in.
+ */
+CELER_FUNCTION void OrangeTrackView::find_next_step_impl(real_type max_step)
+{
+    next_step_          = max_step;
+    next_surf_          = {};
+    next_surface_level_ = {};
+
+    TrackerVisitor visit_tracker{params_};
+    for (auto level : range(LevelId{this->level() + 1}))
+    {
+        auto lsa   = this->make_lsa(level);
+        auto local = this->make_local_state(level);
+        auto isect = visit_tracker(
+            [&local, max_dist = next_step_](const auto& t) {
+                return max_dist < no_intersection()
+                           ? t.intersect(local, max_dist)
+                           : t.intersect(local);
+            },
+            lsa.universe());
+        if (!isect)
+        {
+            // No surfaces at this level closer than the current best
+            continue;
+        }
+
+        if (next_surf_)
+        {
+            real_type bump = detail::BumpCalculator{params_.scalars}(lsa.pos());
+            if (isect.distance >= next_step_ - bump)
+            {
+                // Coincident with a surface in the parent
+                continue;
+            }
+        }
+        next_step_          = isect.distance;
+        next_surf_          = isect.surface.id();
+        next_sense_         = isect.surface.unchecked_sense();
+        next_surface_level_ = level;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Initialize into the daughter universes of the volume at a level.
  *
- * \todo Template on tracker type, allow multiple universe types (see
- * UniverseTypeTraits.hh)
+ * The position in each daughter is translated from its parent. If the track
+ * is on a boundary (after crossing into the parent volume), the
+ * initialization point is bumped along the direction of travel so that
+ * the daughter's outer surfaces, which are usually coincident with the
+ * parent's, don't make the volume ambiguous.
  */
-CELER_FUNCTION SimpleUnitTracker OrangeTrackView::make_tracker(UniverseId id) const
+CELER_FUNCTION void OrangeTrackView::init_daughters(LevelId level)
 {
-    CELER_EXPECT(id < params_.universe_type.size());
-    CELER_EXPECT(id.unchecked_get() == params_.universe_index[id]);
+    CELER_EXPECT(level < params_.scalars.max_level);
+
+    const bool on_surface = static_cast<bool>(states_.surf[thread_]);
+
+    const VolumeRecord* vol_record = &this->volume_record(level);
+    while (vol_record->daughter)
+    {
+        auto parent = this->make_lsa(level);
+        level       = level + 1;
+        CELER_ASSERT(level < params_.scalars.max_level);
+        auto lsa = this->make_lsa(level);
+
+        TranslatorDown translate(
+            params_.translations[vol_record->daughter_translation]);
+        lsa.pos()      = translate(parent.pos());
+        lsa.dir()      = parent.dir();
+        lsa.universe() = vol_record->daughter;
+
+        detail::LocalState local;
+        local.pos        = lsa.pos();
+        local.dir        = lsa.dir();
+        local.volume     = {};
+        local.surface    = {};
+        local.temp_sense = this->make_temp_sense();
+        if (on_surface)
+        {
+            real_type bump = detail::BumpCalculator{params_.scalars}(local.pos);
+            axpy(bump, local.dir, &local.pos);
+        }
 
-    using TraitsT  = UniverseTypeTraits<UniverseType::simple>;
-    using IdT      = OpaqueId<typename TraitsT::record_type>;
-    using TrackerT = typename TraitsT::tracker_type;
+        auto tinit = TrackerVisitor{params_}(
+            [&local](const auto& t) { return t.initialize(local); },
+            lsa.universe());
+        // TODO: error correction/graceful failure if initialiation failed
+        CELER_ASSERT(tinit.volume && !tinit.surface);
+        states_.volumes_tested[thread_] += tinit.num_tested;
+        lsa.vol() = tinit.volume;
+
+        vol_record = &this->volume_record(level);
+    }
 
-    return TrackerT{params_, IdT{id.unchecked_get()}};
+    states_.level[thread_] = level;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access the local state at a level.
+ */
+CELER_FUNCTION detail::LevelStateAccessor
+OrangeTrackView::make_lsa(LevelId level) const
+{
+    CELER_EXPECT(level < params_.scalars.max_level);
+    return detail::LevelStateAccessor(states_, thread_, level);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the definition of the volume at a level.
+ */
+CELER_FUNCTION const VolumeRecord&
+OrangeTrackView::volume_record(LevelId level) const
+{
+    auto     lsa = this->make_lsa(level);
+    VolumeId global_vol_id = detail::UnitIndexer(params_.unit_indexer_data)
+                                 .global_volume(lsa.universe(), lsa.vol());
+    return params_.volume_records[global_vol_id];
 }
 
 //---------------------------------------------------------------------------//
@@ -556,15 +851,23 @@ CELER_FUNCTION detail::TempNextFace OrangeTrackView::make_temp_next() const
 
 //---------------------------------------------------------------------------//
 /*!
- * Create a local state.
+ * Create a local state at a level.
+ *
+ * The surface is only set at the level of the surface the track is on.
  */
-CELER_FUNCTION detail::LocalState OrangeTrackView::make_local_state() const
+CELER_FUNCTION detail::LocalState
+OrangeTrackView::make_local_state(LevelId level) const
 {
+    auto lsa = this->make_lsa(level);
+
     detail::LocalState local;
-    local.pos        = states_.pos[thread_];
-    local.dir        = states_.dir[thread_];
-    local.volume     = states_.vol[thread_];
-    local.surface    = {states_.surf[thread_], states_.sense[thread_]};
+    local.pos    = lsa.pos();
+    local.dir    = lsa.dir();
+    local.volume = lsa.vol();
+    if (states_.surf[thread_] && states_.surface_level[thread_] == level)
+    {
+        local.surface = {states_.surf[thread_], states_.sense[thread_]};
+    }
     local.temp_sense = this->make_temp_sense();
     local.temp_next  = this->make_temp_next();
     return local;
@@ -590,7 +893,7 @@ CELER_FUNCTION void OrangeTrackView::clear_next_step()
 {
     next_step_ = 0;
 #if CELERITAS_DEBUG
-    next_surface_ = {};
+    next_surf_ = {};
 #endif
 }
 
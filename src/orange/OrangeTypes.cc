@@ -27,19 +27,15 @@ const char* to_cstring(SurfaceType value)
         "cyc",
         "czc",
         "sc",
-#if 0
         "cx",
         "cy",
         "cz",
         "p",
-#endif
         "s",
-#if 0
         "kx",
         "ky",
         "kz",
         "sq",
-#endif
         "gq",
     };
     static_assert(
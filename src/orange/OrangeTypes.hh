@@ -38,9 +38,15 @@ using TranslationId = OpaqueId<Translation>;
 //! Identifier for a relocatable set of volumes
 using UniverseId = OpaqueId<struct Universe>;
 
+//! Depth of a track in the hierarchy of nested universes
+using LevelId = OpaqueId<struct Level>;
+
 //! Opaque index for "simple unit" data
 using SimpleUnitId = OpaqueId<struct SimpleUnitRecord>;
 
+//! Opaque index for rectilinear array data
+using RectArrayId = OpaqueId<struct RectArrayRecord>;
+
 //---------------------------------------------------------------------------//
 // ENUMERATIONS
 //---------------------------------------------------------------------------//
@@ -72,26 +78,22 @@ enum class Sense : bool
  */
 enum class SurfaceType : unsigned char
 {
-    px,  //!< Plane aligned with X axis
-    py,  //!< Plane aligned with Y axis
-    pz,  //!< Plane aligned with Z axis
-    cxc, //!< Cylinder centered on X axis
-    cyc, //!< Cylinder centered on Y axis
-    czc, //!< Cylinder centered on Z axis
-    sc,  //!< Sphere centered at the origin
-#if 0
-    cx,  //!< Cylinder parallel to X axis
-    cy,  //!< Cylinder parallel to Y axis
-    cz,  //!< Cylinder parallel to Z axis
-    p,   //!< General plane
-#endif
-    s, //!< Sphere
-#if 0
-    kx,  //!< Cone parallel to X axis
-    ky,  //!< Cone parallel to Y axis
-    kz,  //!< Cone parallel to Z axis
-    sq,  //!< Simple quadric
-#endif
+    px,   //!< Plane aligned with X axis
+    py,   //!< Plane aligned with Y axis
+    pz,   //!< Plane aligned with Z axis
+    cxc,  //!< Cylinder centered on X axis
+    cyc,  //!< Cylinder centered on Y axis
+    czc,  //!< Cylinder centered on Z axis
+    sc,   //!< Sphere centered at the origin
+    cx,   //!< Cylinder parallel to X axis
+    cy,   //!< Cylinder parallel to Y axis
+    cz,   //!< Cylinder parallel to Z axis
+    p,    //!< General plane
+    s,    //!< Sphere
+    kx,   //!< Cone parallel to X axis
+    ky,   //!< Cone parallel to Y axis
+    kz,   //!< Cone parallel to Z axis
+    sq,   //!< Simple quadric
     gq,   //!< General quadric
     size_ //!< Sentinel value for number of surface types
 };
@@ -106,8 +108,8 @@ enum class SurfaceType : unsigned char
 enum class UniverseType : unsigned char
 {
     simple,
-#if 0
     rect_array,
+#if 0
     hex_array,
     dode_array,
     ...
@@ -10,6 +10,7 @@
 #include <unordered_map> // IWYU pragma: export
 #include <vector>
 
+#include "corecel/cont/Array.hh"
 #include "corecel/cont/Label.hh"
 #include "orange/BoundingBox.hh"
 #include "orange/OrangeData.hh"
@@ -57,7 +58,7 @@ struct VolumeInput
     std::vector<SurfaceId> faces{};
     //! RPN region definition for this volume, using local surface index
     std::vector<logic_int> logic{};
-    //! Axis-aligned bounding box (TODO: currently unused)
+    //! Axis-aligned bounding box (optional: narrows the initialization search)
     BoundingBox bbox{};
 
     //! Special flags
@@ -97,16 +98,54 @@ struct UnitInput
     explicit operator bool() const { return !volumes.empty(); }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Input definition for a rectilinear array of daughter universes.
+ *
+ * The grid along each axis is a sorted list of cell edges. Every cell is
+ * filled with a daughter universe, listed with the z index varying fastest.
+ * The daughter translation is the position of the daughter's origin in the
+ * array's coordinate system.
+ */
+struct RectArrayInput
+{
+    using Daughter = UnitInput::Daughter;
+
+    Array<std::vector<real_type>, 3> grid;
+    std::vector<Daughter>            daughters;
+
+    // Array metadata
+    Label label;
+
+    //! Number of cells defined by the grid
+    size_type num_cells() const
+    {
+        size_type result = 1;
+        for (const auto& edges : grid)
+        {
+            result *= (edges.size() < 2 ? 0 : edges.size() - 1);
+        }
+        return result;
+    }
+
+    //! Whether the array definition is valid
+    explicit operator bool() const
+    {
+        return !daughters.empty() && daughters.size() == this->num_cells();
+    }
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Construction definition for a full ORANGE geometry.
+ *
+ * Universe IDs number the units first, followed by the arrays. The first unit
+ * is the top-level (global) universe.
  */
 struct OrangeInput
 {
-    std::vector<UnitInput> units;
-
-    // TODO: array of universe types and universe ID -> offset
-    // or maybe std::variant when we require C++17
+    std::vector<UnitInput>      units;
+    std::vector<RectArrayInput> rect_arrays;
 
     //! Whether the unit definition is valid
     explicit operator bool() const { return !units.empty(); }
@@ -8,6 +8,7 @@
 #include "OrangeInputIO.json.hh"
 
 #include <algorithm>
+#include <utility>
 #include <vector>
 
 #include "corecel/cont/Array.json.hh"
@@ -198,31 +199,142 @@ void from_json(const nlohmann::json& j, UnitInput& value)
                        << "fields 'parent_cells' and 'daughters' have "
                           "different lengths");
 
+        // Translations are optional: default to the parent's origin
+        std::vector<Translation> translations(daughters.size(), {0, 0, 0});
+        if (j.contains("translations"))
+        {
+            j.at("translations").get_to(translations);
+            CELER_VALIDATE(translations.size() == daughters.size(),
+                           << "fields 'translations' and 'daughters' have "
+                              "different lengths");
+        }
+
         UnitInput::MapVolumeDaughter daughter_map;
         for (auto i : range(parent_cells.size()))
         {
             daughter_map[VolumeId{parent_cells[i]}]
-                = {UniverseId{daughters[i]}, {0, 0, 0}};
+                = {UniverseId{daughters[i]}, translations[i]};
         }
 
         value.daughter_map = std::move(daughter_map);
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Read a rectilinear array definition from an ORANGE input file.
+ *
+ * Daughter translations are optional: by default, the origin of each
+ * daughter universe is placed at the lower corner of its cell.
+ */
+void from_json(const nlohmann::json& j, RectArrayInput& value)
+{
+    j.at("grid").get_to(value.grid);
+    j.at("md").at("name").get_to(value.label);
+
+    const auto& daughters = j.at("daughters").get<std::vector<size_type>>();
+    CELER_VALIDATE(value.num_cells() > 0,
+                   << "array grid must have at least two edges per axis");
+    CELER_VALIDATE(daughters.size() == value.num_cells(),
+                   << "field 'daughters' has " << daughters.size()
+                   << " entries but the array grid has " << value.num_cells()
+                   << " cells");
+
+    std::vector<Translation> translations;
+    if (j.contains("translations"))
+    {
+        j.at("translations").get_to(translations);
+        CELER_VALIDATE(translations.size() == daughters.size(),
+                       << "fields 'translations' and 'daughters' have "
+                          "different lengths");
+    }
+    else
+    {
+        // Z index varies fastest
+        const auto& grid = value.grid;
+        translations.reserve(daughters.size());
+        for (auto i : range(grid[0].size() - 1))
+        {
+            for (auto jj : range(grid[1].size() - 1))
+            {
+                for (auto k : range(grid[2].size() - 1))
+                {
+                    translations.push_back(
+                        {grid[0][i], grid[1][jj], grid[2][k]});
+                }
+            }
+        }
+    }
+
+    value.daughters.resize(daughters.size());
+    for (auto i : range(daughters.size()))
+    {
+        value.daughters[i] = {UniverseId{daughters[i]}, translations[i]};
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Read a partially preprocessed geometry definition from an ORANGE JSON file.
+ *
+ * Universes in the file may be listed in any order, but the input stores
+ * units before arrays, so daughter universe indices are renumbered.
  */
 void from_json(const nlohmann::json& j, OrangeInput& value)
 {
     const auto& universes = j.at("universes");
 
-    value.units.reserve(universes.size());
+    // Read universes and save their type-specific indices
+    std::vector<std::pair<bool, size_type>> file_to_input;
+    file_to_input.reserve(universes.size());
     for (const auto& uni : universes)
     {
-        CELER_VALIDATE(uni.at("_type").get<std::string>() == "simple unit",
-                       << "unsupported universe type '" << uni["_type"] << "'");
-        value.units.push_back(uni.get<UnitInput>());
+        const auto& uni_type = uni.at("_type").get<std::string>();
+        if (uni_type == "simple unit")
+        {
+            file_to_input.push_back({false, value.units.size()});
+            value.units.push_back(uni.get<UnitInput>());
+        }
+        else if (uni_type == "rect array")
+        {
+            file_to_input.push_back({true, value.rect_arrays.size()});
+            value.rect_arrays.push_back(uni.get<RectArrayInput>());
+        }
+        else
+        {
+            CELER_VALIDATE(false,
+                           << "unsupported universe type '" << uni_type
+                           << "'");
+        }
+    }
+
+    if (value.rect_arrays.empty())
+    {
+        // Universe IDs are unchanged
+        return;
+    }
+
+    // Renumber daughters so that arrays come after all units
+    auto renumber = [&file_to_input, &value](UniverseId* uid) {
+        CELER_VALIDATE(*uid < file_to_input.size(),
+                       << "invalid daughter universe " << uid->get());
+        const auto& idx = file_to_input[uid->get()];
+        *uid = UniverseId{idx.second
+                          + (idx.first ? value.units.size() : 0)};
+    };
+    for (UnitInput& u : value.units)
+    {
+        for (auto& vol_daughter : u.daughter_map)
+        {
+            renumber(&vol_daughter.second.universe_id);
+        }
+    }
+    for (RectArrayInput& a : value.rect_arrays)
+    {
+        for (auto& daughter : a.daughters)
+        {
+            renumber(&daughter.universe_id);
+        }
     }
 }
 
@@ -18,6 +18,7 @@ namespace celeritas
 void from_json(const nlohmann::json& j, SurfaceInput& value);
 void from_json(const nlohmann::json& j, VolumeInput& value);
 void from_json(const nlohmann::json& j, UnitInput& value);
+void from_json(const nlohmann::json& j, RectArrayInput& value);
 void from_json(const nlohmann::json& j, OrangeInput& value);
 
 //---------------------------------------------------------------------------//
@@ -7,10 +7,25 @@
 //---------------------------------------------------------------------------//
 #include "SurfaceInputBuilder.hh"
 
+#include <algorithm>
+#include <cmath>
+
 #include "corecel/Assert.hh"
+#include "corecel/cont/Array.hh"
 #include "corecel/cont/Label.hh"
 #include "corecel/cont/Range.hh"
 #include "corecel/data/CollectionBuilder.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "orange/surf/ConeAligned.hh"
+#include "orange/surf/CylAligned.hh"
+#include "orange/surf/CylCentered.hh"
+#include "orange/surf/GeneralQuadric.hh"
+#include "orange/surf/Plane.hh"
+#include "orange/surf/PlaneAligned.hh"
+#include "orange/surf/SimpleQuadric.hh"
+#include "orange/surf/Sphere.hh"
+#include "orange/surf/SphereCentered.hh"
 #include "orange/surf/SurfaceAction.hh"
 
 #include "OrangeInput.hh"
@@ -31,6 +46,257 @@ struct SurfaceDataSize
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Replace quadric surfaces with the cheapest equivalent surface type.
+ *
+ * General quadrics without cross terms become simple quadrics; simple
+ * quadrics become planes, spheres, cylinders, or cones when their
+ * coefficients match exactly; and general planes become axis-aligned planes.
+ * A surface is only replaced if the "outside" sense is unchanged, so (for
+ * example) a sphere whose coefficients are all negated is kept as a quadric.
+ *
+ * The returned reference points into this object's buffer and is invalidated
+ * by the next call.
+ */
+class SurfaceSimplifier
+{
+  public:
+    using GenericSurfaceRef = SurfaceInputBuilder::GenericSurfaceRef;
+
+    // Simplify the surface if possible
+    GenericSurfaceRef operator()(const GenericSurfaceRef& surf);
+
+  private:
+    Array<real_type, GeneralQuadric::Storage::extent> buffer_;
+
+    GenericSurfaceRef simplify(const Plane& p);
+    GenericSurfaceRef simplify(const SimpleQuadric& sq);
+    GenericSurfaceRef simplify(const GeneralQuadric& gq);
+
+    template<Axis T>
+    GenericSurfaceRef simplify_cyl(const SimpleQuadric& sq);
+    template<Axis T>
+    GenericSurfaceRef simplify_cone(const SimpleQuadric& sq);
+
+    template<class S>
+    GenericSurfaceRef save(const S& surf);
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Simplify the surface if possible.
+ */
+auto SurfaceSimplifier::operator()(const GenericSurfaceRef& surf)
+    -> GenericSurfaceRef
+{
+    switch (surf.type)
+    {
+        case SurfaceType::p:
+            CELER_ASSERT(surf.data.size() == Plane::Storage::extent);
+            return this->simplify(Plane{Plane::Storage{surf.data.data(),
+                                                       surf.data.size()}});
+        case SurfaceType::sq:
+            CELER_ASSERT(surf.data.size() == SimpleQuadric::Storage::extent);
+            return this->simplify(SimpleQuadric{SimpleQuadric::Storage{
+                surf.data.data(), surf.data.size()}});
+        case SurfaceType::gq:
+            CELER_ASSERT(surf.data.size() == GeneralQuadric::Storage::extent);
+            return this->simplify(GeneralQuadric{GeneralQuadric::Storage{
+                surf.data.data(), surf.data.size()}});
+        default:
+            return surf;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a plane to an axis-aligned plane.
+ */
+auto SurfaceSimplifier::simplify(const Plane& p) -> GenericSurfaceRef
+{
+    const Real3& n = p.normal();
+    const real_type d = p.displacement();
+    if (n[0] > 0 && n[1] == 0 && n[2] == 0)
+    {
+        return this->save(PlaneX(d / n[0]));
+    }
+    if (n[0] == 0 && n[1] > 0 && n[2] == 0)
+    {
+        return this->save(PlaneY(d / n[1]));
+    }
+    if (n[0] == 0 && n[1] == 0 && n[2] > 0)
+    {
+        return this->save(PlaneZ(d / n[2]));
+    }
+    return this->save(p);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a simple quadric to a plane, sphere, cylinder, or cone.
+ */
+auto SurfaceSimplifier::simplify(const SimpleQuadric& sq) -> GenericSurfaceRef
+{
+    const auto second = sq.second();
+    const auto first  = sq.first();
+
+    if (second[0] == 0 && second[1] == 0 && second[2] == 0)
+    {
+        // Linear: convert to a plane with a unit normal
+        Real3           n{first[0], first[1], first[2]};
+        const real_type len = norm(n);
+        CELER_VALIDATE(len > 0,
+                       << "simple quadric has no first- or second-order "
+                          "terms");
+        for (real_type& v : n)
+        {
+            v /= len;
+        }
+        return this->simplify(Plane{n, -sq.zeroth() / len});
+    }
+
+    const real_type a = second[0];
+    if (a > 0 && second[1] == a && second[2] == a)
+    {
+        // Sphere: a (x - x_0)^2 + ... - a R^2 = 0
+        Real3 origin;
+        for (auto i : range(3))
+        {
+            origin[i] = -first[i] / (2 * a);
+        }
+        const real_type radius_sq = dot_product(origin, origin)
+                                    - sq.zeroth() / a;
+        if (radius_sq > 0)
+        {
+            if (origin == Real3{0, 0, 0})
+            {
+                return this->save(SphereCentered{std::sqrt(radius_sq)});
+            }
+            return this->save(Sphere{origin, std::sqrt(radius_sq)});
+        }
+    }
+
+    GenericSurfaceRef result;
+    if ((result = this->simplify_cyl<Axis::x>(sq))
+        || (result = this->simplify_cyl<Axis::y>(sq))
+        || (result = this->simplify_cyl<Axis::z>(sq))
+        || (result = this->simplify_cone<Axis::x>(sq))
+        || (result = this->simplify_cone<Axis::y>(sq))
+        || (result = this->simplify_cone<Axis::z>(sq)))
+    {
+        return result;
+    }
+    return this->save(sq);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a general quadric without cross terms.
+ */
+auto SurfaceSimplifier::simplify(const GeneralQuadric& gq)
+    -> GenericSurfaceRef
+{
+    const auto cross = gq.cross();
+    if (cross[0] == 0 && cross[1] == 0 && cross[2] == 0)
+    {
+        const auto second = gq.second();
+        const auto first  = gq.first();
+        return this->simplify(SimpleQuadric{{second[0], second[1], second[2]},
+                                            {first[0], first[1], first[2]},
+                                            gq.zeroth()});
+    }
+    return this->save(gq);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a simple quadric to a cylinder parallel to the given axis.
+ */
+template<Axis T>
+auto SurfaceSimplifier::simplify_cyl(const SimpleQuadric& sq)
+    -> GenericSurfaceRef
+{
+    constexpr int t = static_cast<int>(T);
+    constexpr int u = (t + 1) % 3;
+    constexpr int v = (t + 2) % 3;
+
+    const auto      second = sq.second();
+    const auto      first  = sq.first();
+    const real_type a      = second[u];
+    if (!(a > 0 && second[v] == a && second[t] == 0 && first[t] == 0))
+    {
+        return {};
+    }
+
+    Real3 origin{0, 0, 0};
+    origin[u] = -first[u] / (2 * a);
+    origin[v] = -first[v] / (2 * a);
+    const real_type radius_sq = ipow<2>(origin[u]) + ipow<2>(origin[v])
+                                - sq.zeroth() / a;
+    if (!(radius_sq > 0))
+    {
+        return {};
+    }
+    if (origin[u] == 0 && origin[v] == 0)
+    {
+        return this->save(CylCentered<T>{std::sqrt(radius_sq)});
+    }
+    return this->save(CylAligned<T>{origin, std::sqrt(radius_sq)});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a simple quadric to a cone parallel to the given axis.
+ *
+ * The constant term must place the vertex exactly on the surface: otherwise
+ * the quadric is a hyperboloid. As with the other simplifications, no
+ * tolerance is applied to the coefficients.
+ */
+template<Axis T>
+auto SurfaceSimplifier::simplify_cone(const SimpleQuadric& sq)
+    -> GenericSurfaceRef
+{
+    constexpr int t = static_cast<int>(T);
+    constexpr int u = (t + 1) % 3;
+    constexpr int v = (t + 2) % 3;
+
+    const auto      second = sq.second();
+    const auto      first  = sq.first();
+    const real_type a      = second[u];
+    if (!(a > 0 && second[v] == a && second[t] < 0))
+    {
+        return {};
+    }
+
+    Real3 origin;
+    for (auto i : range(3))
+    {
+        origin[i] = -first[i] / (2 * second[i]);
+    }
+    const real_type expected_zeroth
+        = a * (ipow<2>(origin[u]) + ipow<2>(origin[v]))
+          + second[t] * ipow<2>(origin[t]);
+    if (expected_zeroth != sq.zeroth())
+    {
+        return {};
+    }
+    return this->save(ConeAligned<T>{origin, std::sqrt(-second[t] / a)});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy surface data to the buffer and return a reference to it.
+ */
+template<class S>
+auto SurfaceSimplifier::save(const S& surf) -> GenericSurfaceRef
+{
+    auto data = surf.data();
+    CELER_ASSERT(data.size() <= buffer_.size());
+    std::copy(data.begin(), data.end(), buffer_.begin());
+    return {S::surface_type(), {buffer_.data(), data.size()}};
+}
+
 //---------------------------------------------------------------------------//
 } // namespace
 
@@ -47,12 +313,18 @@ SurfaceInputBuilder::SurfaceInputBuilder(SurfaceInput* input) : input_(input)
 //---------------------------------------------------------------------------//
 /*!
  * Insert a generic surface.
+ *
+ * Planes and quadrics are first converted to the cheapest surface type that
+ * exactly represents them.
  */
 SurfaceId SurfaceInputBuilder::operator()(GenericSurfaceRef generic_surf,
                                           const Label&      label)
 {
     CELER_EXPECT(generic_surf);
 
+    SurfaceSimplifier simplify;
+    generic_surf = simplify(generic_surf);
+
     SurfaceId::size_type new_id = input_->size();
     input_->types.push_back(generic_surf.type);
     input_->data.insert(
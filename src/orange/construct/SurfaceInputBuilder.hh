@@ -20,8 +20,11 @@ struct SurfaceInput;
 /*!
  * Construct surfaces on the host.
  *
- * Currently this simply appends the surface to the Data, but the full
- * robust geometry implementation will implement "soft" surface deduplication.
+ * Planes and quadrics are converted to the cheapest surface type that exactly
+ * represents them (e.g., a general quadric with no cross terms and equal
+ * second-order coefficients is inserted as a sphere) before being appended
+ * to the Data. The full robust geometry implementation will implement "soft"
+ * surface deduplication.
  *
  * \code
    SurfaceInputBuilder insert_surface(&surface_input);
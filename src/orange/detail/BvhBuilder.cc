@@ -0,0 +1,154 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/BvhBuilder.cc
+//---------------------------------------------------------------------------//
+#include "BvhBuilder.hh"
+
+#include <algorithm>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "orange/BoundingBoxUtils.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from full parameter data.
+ */
+BvhBuilder::BvhBuilder(Data* orange_data) : orange_data_(orange_data)
+{
+    CELER_EXPECT(orange_data);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add nodes for the bounding boxes of volumes in a unit.
+ *
+ * The bounding boxes are indexed by local volume ID. Volumes to exclude from
+ * the hierarchy should have unassigned bounding boxes.
+ */
+ItemRange<BvhNode> BvhBuilder::operator()(const VecBBox& bboxes)
+{
+    CELER_EXPECT(!bboxes.empty());
+
+    // Partition volumes into unbounded and finite
+    VecVolume unbounded;
+    VecVolume bounded;
+    for (auto i : range(bboxes.size()))
+    {
+        const BoundingBox& bbox = bboxes[i];
+        if (!bbox)
+        {
+            continue;
+        }
+        (is_finite(bbox) ? bounded : unbounded).push_back(VolumeId(i));
+    }
+
+    // Root node contains unbounded volumes
+    VecNode nodes(1);
+    nodes.front().bbox    = BoundingBox::from_infinite();
+    nodes.front().volumes = this->insert_volumes(unbounded.begin(),
+                                                 unbounded.end());
+
+    if (!bounded.empty())
+    {
+        this->build_subtree(bboxes, bounded.begin(), bounded.end(), &nodes);
+    }
+    nodes.front().escape = nodes.size();
+
+    return make_builder(&orange_data_->bvh_nodes)
+        .insert_back(nodes.begin(), nodes.end());
+}
+
+//---------------------------------------------------------------------------//
+// HELPER METHODS
+//---------------------------------------------------------------------------//
+/*!
+ * Recursively add a node and its children for a range of volumes.
+ */
+void BvhBuilder::build_subtree(const VecBBox&      bboxes,
+                               VecVolume::iterator first,
+                               VecVolume::iterator last,
+                               VecNode*            nodes)
+{
+    CELER_EXPECT(first != last);
+
+    const size_type node_idx = nodes->size();
+    nodes->push_back({});
+
+    // Calculate the extents of the volumes and of their centers
+    BoundingBox bbox;
+    BoundingBox centers;
+    for (auto iter = first; iter != last; ++iter)
+    {
+        const BoundingBox& vol_bbox = bboxes[iter->unchecked_get()];
+        Real3              center   = calc_center(vol_bbox);
+        bbox    = calc_union(bbox, vol_bbox);
+        centers = calc_union(centers, {center, center});
+    }
+
+    // Split along the axis with the widest spread of centers
+    int       axis   = 0;
+    real_type spread = 0;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        real_type width = centers.upper()[ax] - centers.lower()[ax];
+        if (width > spread)
+        {
+            axis   = ax;
+            spread = width;
+        }
+    }
+
+    const auto num_volumes = static_cast<size_type>(last - first);
+    if (num_volumes <= max_leaf_size || spread == 0)
+    {
+        // Create a leaf node
+        (*nodes)[node_idx].volumes = this->insert_volumes(first, last);
+    }
+    else
+    {
+        // Partition about the median center
+        auto middle = first + num_volumes / 2;
+        std::nth_element(
+            first, middle, last, [&bboxes, axis](VolumeId a, VolumeId b) {
+                const BoundingBox& lhs = bboxes[a.unchecked_get()];
+                const BoundingBox& rhs = bboxes[b.unchecked_get()];
+                return lhs.lower()[axis] + lhs.upper()[axis]
+                       < rhs.lower()[axis] + rhs.upper()[axis];
+            });
+        this->build_subtree(bboxes, first, middle, nodes);
+        this->build_subtree(bboxes, middle, last, nodes);
+    }
+
+    (*nodes)[node_idx].bbox   = bbox;
+    (*nodes)[node_idx].escape = nodes->size();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Store a list of volume IDs.
+ *
+ * The IDs are sorted so that volumes in a node are tested in their input
+ * order.
+ */
+ItemRange<VolumeId>
+BvhBuilder::insert_volumes(VecVolume::const_iterator first,
+                           VecVolume::const_iterator last)
+{
+    VecVolume sorted(first, last);
+    std::sort(sorted.begin(), sorted.end());
+    return make_builder(&orange_data_->volume_ids)
+        .insert_back(sorted.begin(), sorted.end());
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,69 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/BvhBuilder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+#include "orange/BoundingBox.hh"
+#include "orange/OrangeData.hh"
+#include "orange/OrangeTypes.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a bounding volume hierarchy from volume bounding boxes.
+ *
+ * The root node has an infinite bounding box and holds all volumes without
+ * finite bounds; the remaining volumes are recursively split at the median
+ * center along the longest axis of their centers until each leaf holds only
+ * a few volumes. Volumes with an unassigned bounding box (e.g. the implicit
+ * background volume) can never be found by testing their logic and are
+ * omitted.
+ */
+class BvhBuilder
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Data    = HostVal<OrangeParamsData>;
+    using VecBBox = std::vector<BoundingBox>;
+    //!@}
+
+    //! Maximum number of volumes in a leaf node
+    static constexpr size_type max_leaf_size = 2;
+
+  public:
+    // Construct from full parameter data
+    explicit BvhBuilder(Data* orange_data);
+
+    // Add nodes for the bounding boxes of volumes in a unit
+    ItemRange<BvhNode> operator()(const VecBBox& bboxes);
+
+  private:
+    using VecVolume = std::vector<VolumeId>;
+    using VecNode   = std::vector<BvhNode>;
+
+    Data* orange_data_{nullptr};
+
+    //// HELPER METHODS ////
+
+    void build_subtree(const VecBBox& bboxes,
+                       VecVolume::iterator first,
+                       VecVolume::iterator last,
+                       VecNode*            nodes);
+    ItemRange<VolumeId>
+    insert_volumes(VecVolume::const_iterator first,
+                   VecVolume::const_iterator last);
+};
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,79 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/LevelStateAccessor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/sys/ThreadId.hh"
+#include "orange/OrangeData.hh"
+#include "orange/OrangeTypes.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Access the state of a track at a single level of the universe stack.
+ *
+ * The per-level state items are stored as [level][track], so the outermost
+ * level's data is indexed by the thread ID.
+ */
+class LevelStateAccessor
+{
+  public:
+    //!@{
+    //! Type aliases
+    using StateRef = NativeRef<OrangeStateData>;
+    //!@}
+
+  public:
+    // Construct from states, thread, and level
+    inline CELER_FUNCTION LevelStateAccessor(const StateRef& states,
+                                             ThreadId        thread,
+                                             LevelId         level);
+
+    //! Local position
+    CELER_FUNCTION Real3& pos() const { return states_.pos[index_]; }
+
+    //! Local direction
+    CELER_FUNCTION Real3& dir() const { return states_.dir[index_]; }
+
+    //! Local volume
+    CELER_FUNCTION VolumeId& vol() const { return states_.vol[index_]; }
+
+    //! Universe at this level
+    CELER_FUNCTION UniverseId& universe() const
+    {
+        return states_.universe[index_];
+    }
+
+  private:
+    const StateRef& states_;
+    ThreadId        index_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from states, thread, and level.
+ */
+CELER_FUNCTION
+LevelStateAccessor::LevelStateAccessor(const StateRef& states,
+                                       ThreadId        thread,
+                                       LevelId         level)
+    : states_(states), index_(level.get() * states.size() + thread.get())
+{
+    CELER_EXPECT(thread < states_.size());
+    CELER_EXPECT(index_ < states_.pos.size());
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
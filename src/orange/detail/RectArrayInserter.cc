@@ -0,0 +1,126 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/RectArrayInserter.cc
+//---------------------------------------------------------------------------//
+#include "RectArrayInserter.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionBuilder.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Relative tolerance (fraction of a cell width) for uniform spacing
+constexpr real_type uniform_tol = 1e-8;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the cell width if the edges are evenly spaced.
+ *
+ * The width is used to calculate a cell index that's corrected by at most
+ * one cell, so the edges only need to be evenly spaced to within a small
+ * fraction of a cell. The result is zero if the spacing is uneven.
+ */
+real_type calc_uniform_width(const std::vector<real_type>& edges)
+{
+    CELER_EXPECT(edges.size() >= 2);
+    const size_type num_cells = edges.size() - 1;
+    const real_type width     = (edges.back() - edges.front()) / num_cells;
+    for (auto i : range(edges.size()))
+    {
+        real_type expected = edges.front() + i * width;
+        if (std::fabs(edges[i] - expected) > uniform_tol * width)
+        {
+            return 0;
+        }
+    }
+    return width;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from full parameter data.
+ */
+RectArrayInserter::RectArrayInserter(Data* orange_data)
+    : orange_data_(orange_data)
+{
+    CELER_EXPECT(orange_data);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create a rect array and return its ID.
+ */
+RectArrayId RectArrayInserter::operator()(const RectArrayInput& inp)
+{
+    RectArrayRecord record;
+
+    // Insert cell edges
+    auto reals = make_builder(&orange_data_->reals);
+    for (auto ax : range(Axis::size_))
+    {
+        const auto& edges = inp.grid[static_cast<int>(ax)];
+        CELER_VALIDATE(edges.size() >= 2,
+                       << "array '" << inp.label << "' needs at least one "
+                       << "cell along the " << to_char(ax) << " axis");
+        CELER_VALIDATE(std::adjacent_find(edges.begin(),
+                                          edges.end(),
+                                          [](real_type a, real_type b) {
+                                              return !(a < b);
+                                          })
+                           == edges.end(),
+                       << "cell edges along the " << to_char(ax)
+                       << " axis of array '" << inp.label
+                       << "' are not strictly increasing");
+
+        record.grid[static_cast<int>(ax)]
+            = reals.insert_back(edges.begin(), edges.end());
+        record.uniform_width[static_cast<int>(ax)]
+            = calc_uniform_width(edges);
+    }
+    CELER_VALIDATE(inp.daughters.size() == inp.num_cells(),
+                   << "array '" << inp.label << "' has "
+                   << inp.daughters.size() << " daughters but "
+                   << inp.num_cells() << " cells");
+
+    // Each cell is an embedded universe
+    std::vector<VolumeRecord> vol_records(inp.daughters.size());
+    std::vector<Translation>  translations(inp.daughters.size());
+    const auto first_translation = orange_data_->translations.size();
+    for (auto i : range(inp.daughters.size()))
+    {
+        VolumeRecord& vol = vol_records[i];
+        vol.flags         = VolumeRecord::embedded_universe;
+        vol.daughter      = inp.daughters[i].universe_id;
+        vol.daughter_translation = TranslationId(first_translation + i);
+        translations[i]          = inp.daughters[i].translation;
+    }
+
+    record.volumes = make_builder(&orange_data_->volume_records)
+                         .insert_back(vol_records.begin(), vol_records.end());
+    record.translations
+        = make_builder(&orange_data_->translations)
+              .insert_back(translations.begin(), translations.end());
+
+    CELER_ASSERT(record);
+    return make_builder(&orange_data_->rect_arrays).push_back(record);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,46 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/RectArrayInserter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "orange/OrangeData.hh"
+#include "orange/OrangeTypes.hh"
+#include "orange/construct/OrangeInput.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a rectilinear array input to params data.
+ *
+ * The cell edges are stored with the other real-valued data, and each cell is
+ * stored as a volume record that embeds its daughter universe.
+ */
+class RectArrayInserter
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Data = HostVal<OrangeParamsData>;
+    //!@}
+
+  public:
+    // Construct from full parameter data
+    explicit RectArrayInserter(Data* orange_data);
+
+    // Create a rect array and return its ID
+    RectArrayId operator()(const RectArrayInput& inp);
+
+  private:
+    Data* orange_data_{nullptr};
+};
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
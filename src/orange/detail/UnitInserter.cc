@@ -8,19 +8,27 @@
 #include "UnitInserter.hh"
 
 #include <algorithm>
+#include <cmath>
 #include <set>
 #include <vector>
 
 #include "corecel/Assert.hh"
 #include "corecel/OpaqueId.hh"
+#include "corecel/cont/Label.hh"
 #include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
 #include "corecel/data/CollectionBuilder.hh"
 #include "corecel/data/Ref.hh"
 #include "corecel/math/Algorithms.hh"
+#include "corecel/math/NumericLimits.hh"
+#include "orange/BoundingBoxUtils.hh"
 #include "orange/construct/OrangeInput.hh"
+#include "orange/construct/SurfaceInputBuilder.hh"
 #include "orange/surf/SurfaceAction.hh"
 #include "orange/surf/Surfaces.hh"
 
+#include "BvhBuilder.hh"
+
 namespace celeritas
 {
 namespace detail
@@ -30,6 +38,9 @@ namespace
 //---------------------------------------------------------------------------//
 constexpr int invalid_max_depth = -1;
 
+//! Minimum number of volumes on a surface to build a neighbor hierarchy
+constexpr std::size_t min_bvh_neighbors = 8;
+
 //---------------------------------------------------------------------------//
 /*!
  * Calculate the maximum logic depth of a volume definition.
@@ -125,6 +136,175 @@ struct NumIntersectionGetter
     }
 };
 
+//---------------------------------------------------------------------------//
+//! Copy a surface's coefficients
+struct SurfaceDataGetter
+{
+    template<class S>
+    std::vector<real_type> operator()(const S& s) const
+    {
+        auto data = s.data();
+        return {data.begin(), data.end()};
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Bounds of the regions where a logical expression is true and false.
+ *
+ * An unassigned bounding box denotes an empty region.
+ */
+struct LogicBBoxes
+{
+    BoundingBox true_bbox;
+    BoundingBox false_bbox;
+};
+
+//---------------------------------------------------------------------------//
+//! Return the bounds outside and inside a surface
+struct SurfaceBBoxGetter
+{
+    using Limits = numeric_limits<real_type>;
+
+    //! Arbitrary surfaces are unbounded on both sides
+    template<class S>
+    LogicBBoxes operator()(const S&) const
+    {
+        return {BoundingBox::from_infinite(), BoundingBox::from_infinite()};
+    }
+
+    //! Planes bound one axis on each side
+    template<Axis T>
+    LogicBBoxes operator()(const PlaneAligned<T>& s) const
+    {
+        constexpr int ax    = static_cast<int>(T);
+        Real3         lower = BoundingBox::from_infinite().lower();
+        Real3         upper = BoundingBox::from_infinite().upper();
+
+        LogicBBoxes result;
+        lower[ax]         = s.position();
+        result.true_bbox  = {lower, upper};
+        lower[ax]         = -Limits::infinity();
+        upper[ax]         = s.position();
+        result.false_bbox = {lower, upper};
+        return result;
+    }
+
+    //! Cylinders bound the two perpendicular axes on the inside
+    template<Axis T>
+    LogicBBoxes operator()(const CylCentered<T>& s) const
+    {
+        constexpr int   ax     = static_cast<int>(T);
+        const real_type radius = std::sqrt(s.radius_sq());
+        Real3           lower  = {-radius, -radius, -radius};
+        Real3           upper  = {radius, radius, radius};
+        lower[ax]              = -Limits::infinity();
+        upper[ax]              = Limits::infinity();
+        return {BoundingBox::from_infinite(), {lower, upper}};
+    }
+
+    //! Off-center cylinders bound the two perpendicular axes on the inside
+    template<Axis T>
+    LogicBBoxes operator()(const CylAligned<T>& s) const
+    {
+        constexpr int   ax     = static_cast<int>(T);
+        const real_type radius = std::sqrt(s.radius_sq());
+        Real3           lower  = s.calc_origin();
+        Real3           upper  = s.calc_origin();
+        for (int i = 0; i < 3; ++i)
+        {
+            lower[i] -= radius;
+            upper[i] += radius;
+        }
+        lower[ax] = -Limits::infinity();
+        upper[ax] = Limits::infinity();
+        return {BoundingBox::from_infinite(), {lower, upper}};
+    }
+
+    //! Centered spheres are bounded on the inside
+    LogicBBoxes operator()(const SphereCentered& s) const
+    {
+        const real_type radius = std::sqrt(s.radius_sq());
+        return {BoundingBox::from_infinite(),
+                {{-radius, -radius, -radius}, {radius, radius, radius}}};
+    }
+
+    //! Spheres are bounded on the inside
+    LogicBBoxes operator()(const Sphere& s) const
+    {
+        const real_type radius = std::sqrt(s.radius_sq());
+        Real3           lower  = s.origin();
+        Real3           upper  = s.origin();
+        for (int ax = 0; ax < 3; ++ax)
+        {
+            lower[ax] -= radius;
+            upper[ax] += radius;
+        }
+        return {BoundingBox::from_infinite(), {lower, upper}};
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate a conservative bounding box from a volume's logic.
+ *
+ * The bounds of the regions where each subexpression is true *and* false are
+ * propagated through the postfix logic, so that negations of compound
+ * expressions (De Morgan) retain as much information as possible. Surfaces
+ * without simple bounds, such as general quadrics, result in infinite bounds.
+ * The result is unassigned if the volume can never be inside its logic.
+ */
+BoundingBox calc_logic_bbox(const Surfaces&        surfaces,
+                            Span<const SurfaceId>  faces,
+                            Span<const logic_int>  logic)
+{
+    auto get_bboxes = make_surface_action(surfaces, SurfaceBBoxGetter{});
+
+    std::vector<LogicBBoxes> stack;
+    for (logic_int lgc : logic)
+    {
+        if (!logic::is_operator_token(lgc))
+        {
+            // Positive sense ("true") is outside the surface
+            CELER_ASSERT(lgc < faces.size());
+            stack.push_back(get_bboxes(faces[lgc]));
+            continue;
+        }
+        if (lgc == logic::ltrue)
+        {
+            stack.push_back({BoundingBox::from_infinite(), BoundingBox{}});
+            continue;
+        }
+
+        CELER_ASSERT(!stack.empty());
+        LogicBBoxes top = stack.back();
+        stack.pop_back();
+        if (lgc == logic::lnot)
+        {
+            stack.push_back({top.false_bbox, top.true_bbox});
+            continue;
+        }
+
+        CELER_ASSERT(!stack.empty());
+        LogicBBoxes& result = stack.back();
+        if (lgc == logic::land)
+        {
+            result.true_bbox = calc_intersection(result.true_bbox,
+                                                 top.true_bbox);
+            result.false_bbox = calc_union(result.false_bbox, top.false_bbox);
+        }
+        else
+        {
+            CELER_ASSERT(lgc == logic::lor);
+            result.true_bbox = calc_union(result.true_bbox, top.true_bbox);
+            result.false_bbox = calc_intersection(result.false_bbox,
+                                                  top.false_bbox);
+        }
+    }
+    CELER_ASSERT(stack.size() == 1);
+    return stack.back().true_bbox;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace
 
@@ -154,6 +334,7 @@ SimpleUnitId UnitInserter::operator()(const UnitInput& inp)
 
     // Define volumes
     std::vector<VolumeRecord>       vol_records(inp.volumes.size());
+    std::vector<BoundingBox>        vol_bboxes(inp.volumes.size());
     std::vector<Translation>        translations;
     std::vector<std::set<VolumeId>> connectivity(inp.surfaces.size());
     for (auto i : range(inp.volumes.size()))
@@ -161,6 +342,13 @@ SimpleUnitId UnitInserter::operator()(const UnitInput& inp)
         vol_records[i] = this->insert_volume(unit.surfaces, inp.volumes[i]);
         CELER_ASSERT(!vol_records.empty());
 
+        // Bound the volume using its logic and any input bounding box
+        vol_bboxes[i] = this->calc_bbox(unit.surfaces, vol_records[i]);
+        if (auto bbox = calc_intersection(vol_bboxes[i], inp.volumes[i].bbox))
+        {
+            vol_bboxes[i] = bbox;
+        }
+
         // Add embedded universes
         if (inp.daughter_map.find(VolumeId(i)) != inp.daughter_map.end())
         {
@@ -184,6 +372,9 @@ SimpleUnitId UnitInserter::operator()(const UnitInput& inp)
     unit.volumes = make_builder(&orange_data_->volume_records)
                        .insert_back(vol_records.begin(), vol_records.end());
 
+    // Build acceleration structure for initialization
+    unit.bvh = BvhBuilder{orange_data_}(vol_bboxes);
+
     // Save translations
     unit.translations
         = make_builder(&orange_data_->translations)
@@ -199,7 +390,12 @@ SimpleUnitId UnitInserter::operator()(const UnitInput& inp)
             Connectivity c;
             c.neighbors = vol_ids.insert_back(connectivity[i].begin(),
                                               connectivity[i].end());
-            conn[i]     = c;
+            if (connectivity[i].size() >= min_bvh_neighbors)
+            {
+                c.bvh = this->build_neighbor_bvh(vol_bboxes,
+                                                 connectivity[i]);
+            }
+            conn[i] = c;
         }
         unit.connectivity = make_builder(&orange_data_->connectivities)
                                 .insert_back(conn.begin(), conn.end());
@@ -223,6 +419,9 @@ SimpleUnitId UnitInserter::operator()(const UnitInput& inp)
 //---------------------------------------------------------------------------//
 /*!
  * Insert all surfaces at once.
+ *
+ * Planes and quadrics are first converted to the cheapest surface type that
+ * exactly represents them, which also lets more volumes use simple safety.
  */
 SurfacesRecord UnitInserter::insert_surfaces(const SurfaceInput& s)
 {
@@ -254,29 +453,50 @@ SurfacesRecord UnitInserter::insert_surfaces(const SurfaceInput& s)
                    << "): should match accumulated sizes (" << accum_size
                    << ")");
 
+    //// Simplify ////
+
+    // Surfaces read from JSON don't pass through the builder: convert
+    // planes and quadrics to the cheapest equivalent surface types
+    SurfaceInput simplified;
+    {
+        SurfaceInputBuilder insert_surface(&simplified);
+        size_type           offset = 0;
+        for (auto i : range(s.types.size()))
+        {
+            Span<const real_type> data
+                = make_span(s.data).subspan(offset, s.sizes[i]);
+            insert_surface({s.types[i], data},
+                           i < s.labels.size() ? s.labels[i] : Label{});
+            offset += s.sizes[i];
+        }
+    }
+
     //// Insert data ////
 
     // Insert surface types
     SurfacesRecord result;
     auto           types = make_builder(&orange_data_->surface_types);
-    result.types         = types.insert_back(s.types.begin(), s.types.end());
+    result.types
+        = types.insert_back(simplified.types.begin(), simplified.types.end());
 
     // Insert surface data all at once
     auto reals      = make_builder(&orange_data_->reals);
-    auto real_range = reals.insert_back(s.data.begin(), s.data.end());
+    auto real_range
+        = reals.insert_back(simplified.data.begin(), simplified.data.end());
 
     RealId           next_offset = real_range.front();
     auto             offsets     = make_builder(&orange_data_->real_ids);
     OpaqueId<RealId> start_offset(offsets.size());
-    offsets.reserve(offsets.size() + s.sizes.size());
-    for (auto single_size : s.sizes)
+    offsets.reserve(offsets.size() + simplified.sizes.size());
+    for (auto single_size : simplified.sizes)
     {
         offsets.push_back(next_offset);
         next_offset = next_offset + single_size;
     }
     CELER_ASSERT(next_offset == *real_range.end());
 
-    result.data_offsets = range(start_offset, start_offset + s.sizes.size());
+    result.data_offsets
+        = range(start_offset, start_offset + simplified.sizes.size());
     return result;
 }
 
@@ -330,6 +550,7 @@ VolumeRecord UnitInserter::insert_volume(const SurfacesRecord& surf_record,
     VolumeRecord output;
     output.faces = faces.insert_back(v.faces.begin(), v.faces.end());
     output.logic = logic.insert_back(input_logic.begin(), input_logic.end());
+    output.face_batches      = this->insert_face_batches(surf_record, v);
     output.max_intersections = max_intersections;
     output.flags             = v.flags;
     if (simple_safety)
@@ -352,14 +573,135 @@ VolumeRecord UnitInserter::insert_volume(const SurfacesRecord& surf_record,
     return output;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Group the faces of a volume by surface type.
+ *
+ * Each batch stores the face indices of one surface type along with a
+ * transposed copy of their coefficients so that the host tracker can
+ * intersect all faces of a type in a single tight loop.
+ */
+ItemRange<FaceBatchRecord>
+UnitInserter::insert_face_batches(const SurfacesRecord& surf_record,
+                                  const VolumeInput&    v)
+{
+    auto     params_cref = make_const_ref(*orange_data_);
+    Surfaces surfaces{params_cref, surf_record};
+    auto     get_data = make_surface_action(surfaces, SurfaceDataGetter{});
+
+    // Group face indices by surface type
+    std::vector<std::vector<FaceId>> type_faces(
+        static_cast<size_type>(SurfaceType::size_));
+    for (auto face_idx : range(v.faces.size()))
+    {
+        SurfaceType st = surfaces.surface_type(v.faces[face_idx]);
+        type_faces[static_cast<size_type>(st)].push_back(FaceId(face_idx));
+    }
+
+    // Transpose the surface data for each type
+    std::vector<SurfaceType>            types;
+    std::vector<std::vector<real_type>> type_data;
+    for (auto st : range(SurfaceType::size_))
+    {
+        const auto& faces = type_faces[static_cast<size_type>(st)];
+        if (faces.empty())
+        {
+            continue;
+        }
+
+        std::vector<real_type> data;
+        for (auto i : range(faces.size()))
+        {
+            auto coeffs = get_data(v.faces[faces[i].unchecked_get()]);
+            data.resize(coeffs.size() * faces.size());
+            for (auto c : range(coeffs.size()))
+            {
+                data[c * faces.size() + i] = coeffs[c];
+            }
+        }
+        types.push_back(st);
+        type_data.push_back(std::move(data));
+    }
+
+    auto face_ids = make_builder(&orange_data_->face_ids);
+    auto reals    = make_builder(&orange_data_->face_batch_reals);
+    auto batches  = make_builder(&orange_data_->face_batches);
+
+    std::vector<FaceBatchRecord> records(types.size());
+    for (auto i : range(types.size()))
+    {
+        const auto& faces = type_faces[static_cast<size_type>(types[i])];
+
+        FaceBatchRecord& batch = records[i];
+        batch.type             = types[i];
+        batch.faces = face_ids.insert_back(faces.begin(), faces.end());
+        batch.data  = reals.insert_back(type_data[i].begin(),
+                                       type_data[i].end());
+    }
+    return batches.insert_back(records.begin(), records.end());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the bounding box of an inserted volume from its logic.
+ */
+BoundingBox UnitInserter::calc_bbox(const SurfacesRecord& surf_record,
+                                    const VolumeRecord&   vol_record)
+{
+    auto     params_cref = make_const_ref(*orange_data_);
+    Surfaces surfaces{params_cref, surf_record};
+
+    return calc_logic_bbox(surfaces,
+                           params_cref.surface_ids[vol_record.faces],
+                           params_cref.logic_ints[vol_record.logic]);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build a hierarchy of the volumes that share a surface.
+ *
+ * A point crossing the surface is only approximately on it, so the bounding
+ * boxes are expanded by the bump distance.
+ */
+ItemRange<BvhNode>
+UnitInserter::build_neighbor_bvh(const std::vector<BoundingBox>& vol_bboxes,
+                                 const std::set<VolumeId>&       neighbors)
+{
+    const OrangeParamsScalars& scalars = orange_data_->scalars;
+
+    std::vector<BoundingBox> bboxes(vol_bboxes.size());
+    for (VolumeId v : neighbors)
+    {
+        const BoundingBox& bbox = vol_bboxes[v.unchecked_get()];
+        if (!bbox)
+        {
+            continue;
+        }
+        Real3 lower = bbox.lower();
+        Real3 upper = bbox.upper();
+        for (int ax = 0; ax < 3; ++ax)
+        {
+            lower[ax] -= scalars.bump_abs
+                         + scalars.bump_rel * std::fabs(lower[ax]);
+            upper[ax] += scalars.bump_abs
+                         + scalars.bump_rel * std::fabs(upper[ax]);
+        }
+        bboxes[v.unchecked_get()] = {lower, upper};
+    }
+    return BvhBuilder{orange_data_}(bboxes);
+}
+
+//---------------------------------------------------------------------------//
 void UnitInserter::process_daughter(VolumeRecord*              vol_record,
                                     std::vector<Translation>*  translations,
                                     const UnitInput::Daughter& daughter)
 {
-    vol_record->flags &= VolumeRecord::embedded_universe;
+    vol_record->flags |= VolumeRecord::embedded_universe;
     vol_record->daughter = daughter.universe_id;
 
-    vol_record->daughter_translation = TranslationId(translations->size());
+    // Translations for this unit are appended after all previous units'
+    vol_record->daughter_translation = TranslationId(
+        orange_data_->translations.size() + translations->size());
     translations->push_back(daughter.translation);
 }
 
@@ -7,6 +7,9 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <set>
+#include <vector>
+
 #include "orange/OrangeData.hh"
 #include "orange/OrangeTypes.hh"
 #include "orange/construct/OrangeInput.hh"
@@ -46,6 +49,13 @@ class UnitInserter
     SurfacesRecord insert_surfaces(const SurfaceInput& s);
     VolumeRecord
     insert_volume(const SurfacesRecord& unit, const VolumeInput& v);
+    ItemRange<FaceBatchRecord>
+    insert_face_batches(const SurfacesRecord& unit, const VolumeInput& v);
+    BoundingBox
+    calc_bbox(const SurfacesRecord& unit, const VolumeRecord& v);
+    ItemRange<BvhNode>
+    build_neighbor_bvh(const std::vector<BoundingBox>& vol_bboxes,
+                       const std::set<VolumeId>&       neighbors);
 
     void process_daughter(VolumeRecord*              vol_record,
                           std::vector<Translation>*  translations,
@@ -0,0 +1,222 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/surf/ConeAligned.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "orange/OrangeTypes.hh"
+
+#include "detail/QuadraticSolver.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Axis-aligned double cone with an arbitrary vertex.
+ *
+ * The cone is parallel to an Axis template parameter. For a cone along the x
+ * axis with vertex \f$ (x_0, y_0, z_0) \f$ and half-angle tangent \f$ t \f$:
+ * \f[
+    (y - y_0)^2 + (z - z_0)^2 - t^2 (x - x_0)^2 = 0
+   \f]
+ *
+ * Both nappes of the cone are part of the surface: the "inside" is the
+ * region around the axis.
+ */
+template<Axis T>
+class ConeAligned
+{
+  public:
+    //@{
+    //! Type aliases
+    using Intersections = Array<real_type, 2>;
+    using Storage       = Span<const real_type, 4>;
+    //@}
+
+    //// CLASS ATTRIBUTES ////
+
+    // Surface type identifier
+    static CELER_CONSTEXPR_FUNCTION SurfaceType surface_type();
+
+    //! Safety is *not* the nearest intersection along the surface "normal"
+    static CELER_CONSTEXPR_FUNCTION bool simple_safety() { return false; }
+
+  public:
+    //// CONSTRUCTORS ////
+
+    // Construct with vertex and tangent of the half-angle
+    inline CELER_FUNCTION
+    ConeAligned(const Real3& origin, real_type tangent);
+
+    // Construct from raw data
+    explicit inline CELER_FUNCTION ConeAligned(Storage);
+
+    //// ACCESSORS ////
+
+    //! Get the location of the vertex
+    CELER_FUNCTION const Real3& origin() const { return origin_; }
+
+    //! Get the square of the tangent of the half-angle
+    CELER_FUNCTION real_type tangent_sq() const { return tsq_; }
+
+    //! Get a view to the data for type-deleted storage
+    CELER_FUNCTION Storage data() const { return {origin_.data(), 4}; }
+
+    //// CALCULATION ////
+
+    // Determine the sense of the position relative to this surface
+    inline CELER_FUNCTION SignedSense calc_sense(const Real3& pos) const;
+
+    // Calculate all possible straight-line intersections with this surface
+    inline CELER_FUNCTION Intersections calc_intersections(
+        const Real3& pos, const Real3& dir, SurfaceState on_surface) const;
+
+    // Calculate outward normal at a position
+    inline CELER_FUNCTION Real3 calc_normal(const Real3& pos) const;
+
+  private:
+    // Location of the vertex
+    Real3 origin_;
+
+    // Tangent of the half-angle, squared
+    real_type tsq_;
+
+    static CELER_CONSTEXPR_FUNCTION int t_index();
+    static CELER_CONSTEXPR_FUNCTION int u_index();
+    static CELER_CONSTEXPR_FUNCTION int v_index();
+};
+
+//---------------------------------------------------------------------------//
+// TYPE ALIASES
+//---------------------------------------------------------------------------//
+
+using ConeX = ConeAligned<Axis::x>;
+using ConeY = ConeAligned<Axis::y>;
+using ConeZ = ConeAligned<Axis::z>;
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Surface type identifier.
+ */
+template<Axis T>
+CELER_CONSTEXPR_FUNCTION SurfaceType ConeAligned<T>::surface_type()
+{
+    return (T == Axis::x ? SurfaceType::kx
+                         : (T == Axis::y ? SurfaceType::ky : SurfaceType::kz));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with vertex and tangent of the half-angle.
+ */
+template<Axis T>
+CELER_FUNCTION ConeAligned<T>::ConeAligned(const Real3& origin,
+                                           real_type    tangent)
+    : origin_(origin), tsq_(ipow<2>(tangent))
+{
+    CELER_EXPECT(tangent > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from raw data.
+ */
+template<Axis T>
+CELER_FUNCTION ConeAligned<T>::ConeAligned(Storage data)
+    : origin_{data[0], data[1], data[2]}, tsq_{data[3]}
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Determine the sense of the position relative to this surface.
+ */
+template<Axis T>
+CELER_FUNCTION SignedSense ConeAligned<T>::calc_sense(const Real3& pos) const
+{
+    const real_type x = pos[t_index()] - origin_[t_index()];
+    const real_type y = pos[u_index()] - origin_[u_index()];
+    const real_type z = pos[v_index()] - origin_[v_index()];
+
+    return real_to_sense(ipow<2>(y) + ipow<2>(z) - tsq_ * ipow<2>(x));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate all possible straight-line intersections with this surface.
+ *
+ * Traveling parallel to the cone's surface makes the quadratic coefficient
+ * vanish, which is handled by the general solver.
+ */
+template<Axis T>
+CELER_FUNCTION auto
+ConeAligned<T>::calc_intersections(const Real3& pos,
+                                   const Real3& dir,
+                                   SurfaceState on_surface) const
+    -> Intersections
+{
+    const real_type x = pos[t_index()] - origin_[t_index()];
+    const real_type y = pos[u_index()] - origin_[u_index()];
+    const real_type z = pos[v_index()] - origin_[v_index()];
+
+    const real_type u = dir[t_index()];
+    const real_type v = dir[u_index()];
+    const real_type w = dir[v_index()];
+
+    // Quadratic values
+    real_type a      = (-tsq_ * ipow<2>(u)) + ipow<2>(v) + ipow<2>(w);
+    real_type half_b = (-tsq_ * x * u) + (y * v) + (z * w);
+    real_type c      = (-tsq_ * ipow<2>(x)) + ipow<2>(y) + ipow<2>(z);
+
+    return detail::QuadraticSolver::solve_general(a, half_b, c, on_surface);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate outward normal at a position.
+ */
+template<Axis T>
+CELER_FUNCTION Real3 ConeAligned<T>::calc_normal(const Real3& pos) const
+{
+    Real3 norm;
+    for (int i = 0; i < 3; ++i)
+    {
+        norm[i] = pos[i] - origin_[i];
+    }
+    norm[t_index()] *= -tsq_;
+
+    normalize_direction(&norm);
+    return norm;
+}
+
+//---------------------------------------------------------------------------//
+//!@{
+//! Integer index values for primary and orthogonal axes.
+template<Axis T>
+CELER_CONSTEXPR_FUNCTION int ConeAligned<T>::t_index()
+{
+    return static_cast<int>(T);
+}
+template<Axis T>
+CELER_CONSTEXPR_FUNCTION int ConeAligned<T>::u_index()
+{
+    return static_cast<int>(T == Axis::x ? Axis::y : Axis::x);
+}
+template<Axis T>
+CELER_CONSTEXPR_FUNCTION int ConeAligned<T>::v_index()
+{
+    return static_cast<int>(T == Axis::z ? Axis::y : Axis::z);
+}
+//!@}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
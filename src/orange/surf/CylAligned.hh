@@ -0,0 +1,251 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/surf/CylAligned.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "orange/OrangeTypes.hh"
+
+#include "detail/QuadraticSolver.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Axis-aligned cylinder with an arbitrary center.
+ *
+ * The cylinder is parallel to an Axis template parameter. For a cylinder
+ * along the x axis:
+ * \f[
+    (y - y_0)^2 + (z - z_0)^2 - R^2 = 0
+   \f]
+ *
+ * Only the two coordinates of the origin perpendicular to the axis are
+ * stored.
+ */
+template<Axis T>
+class CylAligned
+{
+  public:
+    //@{
+    //! Type aliases
+    using Intersections = Array<real_type, 2>;
+    using Storage       = Span<const real_type, 3>;
+    //@}
+
+    //// CLASS ATTRIBUTES ////
+
+    // Surface type identifier
+    static CELER_CONSTEXPR_FUNCTION SurfaceType surface_type();
+
+    //! Safety is intersection along surface normal
+    static CELER_CONSTEXPR_FUNCTION bool simple_safety() { return true; }
+
+  public:
+    //// CONSTRUCTORS ////
+
+    // Construct with origin and radius
+    inline CELER_FUNCTION CylAligned(const Real3& origin, real_type radius);
+
+    // Construct from raw data
+    explicit inline CELER_FUNCTION CylAligned(Storage);
+
+    //// ACCESSORS ////
+
+    //! Get the origin position along the first orthogonal axis
+    CELER_FUNCTION real_type origin_u() const { return origin_u_; }
+
+    //! Get the origin position along the second orthogonal axis
+    CELER_FUNCTION real_type origin_v() const { return origin_v_; }
+
+    //! Get the square of the radius
+    CELER_FUNCTION real_type radius_sq() const { return radius_sq_; }
+
+    //! Get a view to the data for type-deleted storage
+    CELER_FUNCTION Storage data() const { return {&origin_u_, 3}; }
+
+    // Get the origin as a 3-vector
+    inline CELER_FUNCTION Real3 calc_origin() const;
+
+    //// CALCULATION ////
+
+    // Determine the sense of the position relative to this surface
+    inline CELER_FUNCTION SignedSense calc_sense(const Real3& pos) const;
+
+    // Calculate all possible straight-line intersections with this surface
+    inline CELER_FUNCTION Intersections calc_intersections(
+        const Real3& pos, const Real3& dir, SurfaceState on_surface) const;
+
+    // Calculate outward normal at a position
+    inline CELER_FUNCTION Real3 calc_normal(const Real3& pos) const;
+
+  private:
+    // Off-axis location
+    real_type origin_u_;
+    real_type origin_v_;
+
+    // Square of the radius
+    real_type radius_sq_;
+
+    static CELER_CONSTEXPR_FUNCTION int t_index();
+    static CELER_CONSTEXPR_FUNCTION int u_index();
+    static CELER_CONSTEXPR_FUNCTION int v_index();
+};
+
+//---------------------------------------------------------------------------//
+// TYPE ALIASES
+//---------------------------------------------------------------------------//
+
+using CylX = CylAligned<Axis::x>;
+using CylY = CylAligned<Axis::y>;
+using CylZ = CylAligned<Axis::z>;
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Surface type identifier.
+ */
+template<Axis T>
+CELER_CONSTEXPR_FUNCTION SurfaceType CylAligned<T>::surface_type()
+{
+    return (T == Axis::x ? SurfaceType::cx
+                         : (T == Axis::y ? SurfaceType::cy : SurfaceType::cz));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with origin and radius.
+ *
+ * The component of the origin along the cylinder axis is ignored.
+ */
+template<Axis T>
+CELER_FUNCTION CylAligned<T>::CylAligned(const Real3& origin, real_type radius)
+    : origin_u_(origin[u_index()])
+    , origin_v_(origin[v_index()])
+    , radius_sq_(ipow<2>(radius))
+{
+    CELER_EXPECT(radius > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from raw data.
+ */
+template<Axis T>
+CELER_FUNCTION CylAligned<T>::CylAligned(Storage data)
+    : origin_u_(data[0]), origin_v_(data[1]), radius_sq_(data[2])
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the origin as a 3-vector, with zero along the cylinder axis.
+ */
+template<Axis T>
+CELER_FUNCTION Real3 CylAligned<T>::calc_origin() const
+{
+    Real3 result{0, 0, 0};
+    result[u_index()] = origin_u_;
+    result[v_index()] = origin_v_;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Determine the sense of the position relative to this surface.
+ */
+template<Axis T>
+CELER_FUNCTION SignedSense CylAligned<T>::calc_sense(const Real3& pos) const
+{
+    const real_type u = pos[u_index()] - origin_u_;
+    const real_type v = pos[v_index()] - origin_v_;
+
+    return real_to_sense(ipow<2>(u) + ipow<2>(v) - radius_sq_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate all possible straight-line intersections with this surface.
+ */
+template<Axis T>
+CELER_FUNCTION auto
+CylAligned<T>::calc_intersections(const Real3& pos,
+                                  const Real3& dir,
+                                  SurfaceState on_surface) const
+    -> Intersections
+{
+    // 1 - \omega \dot e
+    const real_type a = 1 - ipow<2>(dir[t_index()]);
+
+    if (a != 0)
+    {
+        const real_type u = pos[u_index()] - origin_u_;
+        const real_type v = pos[v_index()] - origin_v_;
+
+        // b/2 = \omega \dot (x - x_0)
+        detail::QuadraticSolver solve_quadric(
+            a, dir[u_index()] * u + dir[v_index()] * v);
+        if (on_surface == SurfaceState::off)
+        {
+            // c = (x - x_0) \dot (x - x_0) - R * R
+            return solve_quadric(ipow<2>(u) + ipow<2>(v) - radius_sq_);
+        }
+        else
+        {
+            // Solve degenerate case (c=0)
+            return solve_quadric();
+        }
+    }
+    else
+    {
+        // No intersection if we're traveling along the cylinder axis
+        return {no_intersection(), no_intersection()};
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate outward normal at a position.
+ */
+template<Axis T>
+CELER_FUNCTION Real3 CylAligned<T>::calc_normal(const Real3& pos) const
+{
+    Real3 norm{0, 0, 0};
+
+    norm[u_index()] = pos[u_index()] - origin_u_;
+    norm[v_index()] = pos[v_index()] - origin_v_;
+
+    normalize_direction(&norm);
+    return norm;
+}
+
+//---------------------------------------------------------------------------//
+//!@{
+//! Integer index values for primary and orthogonal axes.
+template<Axis T>
+CELER_CONSTEXPR_FUNCTION int CylAligned<T>::t_index()
+{
+    return static_cast<int>(T);
+}
+template<Axis T>
+CELER_CONSTEXPR_FUNCTION int CylAligned<T>::u_index()
+{
+    return static_cast<int>(T == Axis::x ? Axis::y : Axis::x);
+}
+template<Axis T>
+CELER_CONSTEXPR_FUNCTION int CylAligned<T>::v_index()
+{
+    return static_cast<int>(T == Axis::z ? Axis::y : Axis::z);
+}
+//!@}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
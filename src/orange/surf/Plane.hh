@@ -0,0 +1,162 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/surf/Plane.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "orange/OrangeTypes.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Arbitrarily oriented plane.
+ *
+ * The plane is defined by a unit normal \f$ \mathbf{n} \f$ and displacement
+ * \f$ d \f$ from the origin:
+ * \f[
+    \mathbf{n} \cdot \mathbf{x} - d = 0
+   \f]
+ * The "outside" of the plane is the side the normal points toward.
+ */
+class Plane
+{
+  public:
+    //@{
+    //! Type aliases
+    using Intersections = Array<real_type, 1>;
+    using Storage       = Span<const real_type, 4>;
+    //@}
+
+    //// CLASS ATTRIBUTES ////
+
+    //! Surface type identifier
+    static CELER_CONSTEXPR_FUNCTION SurfaceType surface_type()
+    {
+        return SurfaceType::p;
+    }
+
+    //! Safety is intersection along surface normal
+    static CELER_CONSTEXPR_FUNCTION bool simple_safety() { return true; }
+
+  public:
+    //// CONSTRUCTORS ////
+
+    // Construct with unit normal and displacement
+    inline CELER_FUNCTION Plane(const Real3& normal, real_type displacement);
+
+    // Construct with unit normal and a point on the plane
+    inline CELER_FUNCTION Plane(const Real3& normal, const Real3& point);
+
+    // Construct from raw data
+    explicit inline CELER_FUNCTION Plane(Storage);
+
+    //// ACCESSORS ////
+
+    //! Normal to the plane
+    CELER_FUNCTION const Real3& normal() const { return normal_; }
+
+    //! Distance from the origin along the normal to the plane
+    CELER_FUNCTION real_type displacement() const { return d_; }
+
+    //! Get a view to the data for type-deleted storage
+    CELER_FUNCTION Storage data() const { return {normal_.data(), 4}; }
+
+    //// CALCULATION ////
+
+    // Determine the sense of the position relative to this surface
+    inline CELER_FUNCTION SignedSense calc_sense(const Real3& pos) const;
+
+    // Calculate all possible straight-line intersections with this surface
+    inline CELER_FUNCTION Intersections calc_intersections(
+        const Real3& pos, const Real3& dir, SurfaceState on_surface) const;
+
+    // Calculate outward normal at a position
+    inline CELER_FUNCTION Real3 calc_normal(const Real3&) const;
+
+  private:
+    // Normal to the plane
+    Real3 normal_;
+    // Displacement along the normal
+    real_type d_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with unit normal and displacement.
+ */
+CELER_FUNCTION Plane::Plane(const Real3& normal, real_type displacement)
+    : normal_(normal), d_(displacement)
+{
+    CELER_EXPECT(is_soft_unit_vector(normal_));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with unit normal and a point on the plane.
+ */
+CELER_FUNCTION Plane::Plane(const Real3& normal, const Real3& point)
+    : normal_(normal), d_(dot_product(normal, point))
+{
+    CELER_EXPECT(is_soft_unit_vector(normal_));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from raw data.
+ */
+CELER_FUNCTION Plane::Plane(Storage data)
+    : normal_{data[0], data[1], data[2]}, d_{data[3]}
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Determine the sense of the position relative to this surface.
+ */
+CELER_FUNCTION SignedSense Plane::calc_sense(const Real3& pos) const
+{
+    return real_to_sense(dot_product(normal_, pos) - d_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate all possible straight-line intersections with this surface.
+ */
+CELER_FUNCTION auto Plane::calc_intersections(const Real3& pos,
+                                              const Real3& dir,
+                                              SurfaceState on_surface) const
+    -> Intersections
+{
+    const real_type n_dir = dot_product(normal_, dir);
+    if (on_surface == SurfaceState::off && n_dir != 0)
+    {
+        real_type dist = (d_ - dot_product(normal_, pos)) / n_dir;
+        if (dist > 0)
+        {
+            return {dist};
+        }
+    }
+    return {no_intersection()};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate outward normal at a position.
+ */
+CELER_FUNCTION Real3 Plane::calc_normal(const Real3&) const
+{
+    return normal_;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
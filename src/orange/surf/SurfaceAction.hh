@@ -46,5 +46,19 @@ inline CELER_FUNCTION detail::StaticSurfaceAction<T>
     return detail::StaticSurfaceAction<T>{};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Helper function for creating a SurfaceTypeAction instance.
+ *
+ * The function argument must have an \c operator() whose first argument is a
+ * \c SurfaceClass tag.
+ */
+template<class F>
+inline CELER_FUNCTION detail::SurfaceTypeAction<F>
+                      make_surface_type_action(F&& action)
+{
+    return detail::SurfaceTypeAction<F>{::celeritas::forward<F>(action)};
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -12,9 +12,13 @@
 #include "corecel/cont/Span.hh"
 #include "corecel/cont/SpanIO.hh"
 
+#include "ConeAligned.hh"
+#include "CylAligned.hh"
 #include "CylCentered.hh"
 #include "GeneralQuadric.hh"
+#include "Plane.hh"
 #include "PlaneAligned.hh"
+#include "SimpleQuadric.hh"
 #include "Sphere.hh"
 #include "SphereCentered.hh"
 
@@ -25,6 +29,26 @@ namespace celeritas
     template std::ostream& operator<<(std::ostream&, const SHAPE<Axis::y>&); \
     template std::ostream& operator<<(std::ostream&, const SHAPE<Axis::z>&)
 
+//---------------------------------------------------------------------------//
+template<Axis T>
+std::ostream& operator<<(std::ostream& os, const ConeAligned<T>& s)
+{
+    os << "Cone " << to_char(T) << ": t=" << std::sqrt(s.tangent_sq())
+       << " at " << make_span(s.origin());
+    return os;
+}
+
+ORANGE_INSTANTIATE_SHAPE_STREAM(ConeAligned);
+//---------------------------------------------------------------------------//
+template<Axis T>
+std::ostream& operator<<(std::ostream& os, const CylAligned<T>& s)
+{
+    os << "Cyl " << to_char(T) << ": r=" << std::sqrt(s.radius_sq())
+       << " at " << make_span(s.calc_origin());
+    return os;
+}
+
+ORANGE_INSTANTIATE_SHAPE_STREAM(CylAligned);
 //---------------------------------------------------------------------------//
 template<Axis T>
 std::ostream& operator<<(std::ostream& os, const CylCentered<T>& s)
@@ -43,6 +67,13 @@ std::ostream& operator<<(std::ostream& os, const GeneralQuadric& s)
     return os;
 }
 
+//---------------------------------------------------------------------------//
+std::ostream& operator<<(std::ostream& os, const Plane& s)
+{
+    os << "Plane: n=" << make_span(s.normal()) << ", d=" << s.displacement();
+    return os;
+}
+
 //---------------------------------------------------------------------------//
 template<Axis T>
 std::ostream& operator<<(std::ostream& os, const PlaneAligned<T>& s)
@@ -52,6 +83,13 @@ std::ostream& operator<<(std::ostream& os, const PlaneAligned<T>& s)
 }
 
 ORANGE_INSTANTIATE_SHAPE_STREAM(PlaneAligned);
+//---------------------------------------------------------------------------//
+std::ostream& operator<<(std::ostream& os, const SimpleQuadric& s)
+{
+    os << "SQuadric: " << s.second() << ' ' << s.first() << ' ' << s.zeroth();
+    return os;
+}
+
 //---------------------------------------------------------------------------//
 std::ostream& operator<<(std::ostream& os, const Sphere& s)
 {
@@ -18,14 +18,24 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 //!@{
 //! Print surfaces to a stream.
+template<Axis T>
+std::ostream& operator<<(std::ostream&, const ConeAligned<T>&);
+
+template<Axis T>
+std::ostream& operator<<(std::ostream&, const CylAligned<T>&);
+
 template<Axis T>
 std::ostream& operator<<(std::ostream&, const CylCentered<T>&);
 
 std::ostream& operator<<(std::ostream&, const GeneralQuadric&);
 
+std::ostream& operator<<(std::ostream&, const Plane&);
+
 template<Axis T>
 std::ostream& operator<<(std::ostream&, const PlaneAligned<T>&);
 
+std::ostream& operator<<(std::ostream&, const SimpleQuadric&);
+
 std::ostream& operator<<(std::ostream&, const Sphere&);
 
 std::ostream& operator<<(std::ostream&, const SphereCentered&);
@@ -13,9 +13,13 @@
 #include "corecel/math/Algorithms.hh"
 #include "orange/OrangeTypes.hh"
 
+#include "../ConeAligned.hh"
+#include "../CylAligned.hh"
 #include "../CylCentered.hh"
 #include "../GeneralQuadric.hh"
+#include "../Plane.hh"
 #include "../PlaneAligned.hh"
+#include "../SimpleQuadric.hh"
 #include "../Sphere.hh"
 #include "../SphereCentered.hh"
 #include "../SurfaceTypeTraits.hh"
@@ -70,6 +74,34 @@ struct StaticSurfaceAction
     inline CELER_FUNCTION decltype(auto) operator()(SurfaceType type) const;
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Helper class for applying an action functor to a surface class.
+ *
+ * The function-like instance of \c F is called with an empty \c
+ * SurfaceClass<S> tag for the surface class corresponding to a runtime \c
+ * SurfaceType, followed by any additional arguments. This allows the action
+ * to operate on many surfaces of the same type with a single dispatch.
+ */
+template<class F>
+class SurfaceTypeAction
+{
+  public:
+    // Construct from action
+    explicit inline CELER_FUNCTION SurfaceTypeAction(F&& action);
+
+    // Apply to the surface class specified by a surface type
+    template<class... Args>
+    inline CELER_FUNCTION decltype(auto)
+    operator()(SurfaceType type, Args&&... args);
+
+    //! Access the resulting action
+    CELER_FUNCTION const F& action() const { return action_; }
+
+  private:
+    F action_;
+};
+
 //---------------------------------------------------------------------------//
 // PRIVATE MACRO DEFINITIONS
 //---------------------------------------------------------------------------//
@@ -101,15 +133,15 @@ struct StaticSurfaceAction
             ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, cyc);      \
             ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, czc);      \
             ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, sc);       \
-            /* ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, cx); */ \
-            /* ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, cy); */ \
-            /* ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, cz); */ \
-            /* ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, p);  */ \
+            ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, cx);       \
+            ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, cy);       \
+            ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, cz);       \
+            ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, p);        \
             ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, s);        \
-            /* ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, kx); */ \
-            /* ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, ky); */ \
-            /* ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, kz); */ \
-            /* ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, sq); */ \
+            ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, kx);       \
+            ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, ky);       \
+            ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, kz);       \
+            ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, sq);       \
             ORANGE_SURF_DISPATCH_CASE_IMPL(FUNC, gq);       \
             case SurfaceType::size_:                        \
                 CELER_ASSERT_UNREACHABLE();                 \
@@ -160,6 +192,34 @@ StaticSurfaceAction<T>::operator()(SurfaceType type) const
     CELER_ASSERT_UNREACHABLE();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with action to apply.
+ */
+template<class F>
+CELER_FUNCTION SurfaceTypeAction<F>::SurfaceTypeAction(F&& action)
+    : action_(::celeritas::forward<F>(action))
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Apply to the surface class specified by the given surface type.
+ */
+template<class F>
+template<class... Args>
+CELER_FUNCTION decltype(auto)
+SurfaceTypeAction<F>::operator()(SurfaceType type, Args&&... args)
+{
+#define ORANGE_STA_APPLY_IMPL(SURFACE)       \
+    return action_(SurfaceClass<SURFACE>{}, \
+                   ::celeritas::forward<Args>(args)...);
+
+    ORANGE_SURF_DISPATCH_IMPL(ORANGE_STA_APPLY_IMPL, type);
+#undef ORANGE_STA_APPLY_IMPL
+    CELER_ASSERT_UNREACHABLE();
+}
+
 //---------------------------------------------------------------------------//
 #undef ORANGE_SURF_DISPATCH_CASE_IMPL
 #undef ORANGE_SURF_DISPATCH_IMPL
@@ -0,0 +1,408 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/univ/RectArrayTracker.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/math/Algorithms.hh"
+#include "orange/OrangeData.hh"
+
+#include "detail/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Track a particle in a rectilinear array of cells.
+ *
+ * The cells of the array are the local volumes and the cell edges along each
+ * axis are the local surfaces. The cell containing a point is calculated
+ * directly (for evenly spaced edges) or with a binary search along each axis,
+ * and the distance to the next cell is the nearest edge along the direction
+ * of travel. No surface or volume logic is evaluated.
+ *
+ * The outer edges of the array are never returned as intersections: the
+ * array must exactly fill the parent volume it's placed in, whose boundary
+ * is found by the parent universe.
+ */
+class RectArrayTracker
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ParamsRef      = NativeCRef<OrangeParamsData>;
+    using Initialization = detail::Initialization;
+    using Intersection   = detail::Intersection;
+    using LocalState     = detail::LocalState;
+    using Coords         = Array<size_type, 3>;
+    //!@}
+
+  public:
+    // Construct with parameters (array definitions and this one's ID)
+    inline CELER_FUNCTION
+    RectArrayTracker(const ParamsRef& params, RectArrayId id);
+
+    //// ACCESSORS ////
+
+    //! Number of local volumes
+    CELER_FUNCTION VolumeId::size_type num_volumes() const
+    {
+        return record_.volumes.size();
+    }
+
+    //! Number of local surfaces
+    CELER_FUNCTION SurfaceId::size_type num_surfaces() const
+    {
+        return record_.grid[0].size() + record_.grid[1].size()
+               + record_.grid[2].size();
+    }
+
+    //// OPERATIONS ////
+
+    // Find the local volume from a position
+    inline CELER_FUNCTION Initialization
+    initialize(const LocalState& state) const;
+
+    // Find the new volume by crossing a surface
+    inline CELER_FUNCTION Initialization
+    cross_boundary(const LocalState& state) const;
+
+    // Calculate the distance to an exiting face for the current volume
+    inline CELER_FUNCTION Intersection intersect(const LocalState& state) const;
+
+    // Calculate nearby distance to an exiting face for the current volume
+    inline CELER_FUNCTION Intersection intersect(const LocalState& state,
+                                                 real_type max_dist) const;
+
+    // Calculate closest distance to a surface in any direction
+    inline CELER_FUNCTION real_type safety(const Real3& pos,
+                                           VolumeId     vol) const;
+
+    // Calculate the local surface normal
+    inline CELER_FUNCTION Real3 normal(const Real3& pos, SurfaceId surf) const;
+
+    //// INDEXING ////
+
+    // Find the cell index along an axis (num_cells if outside)
+    inline CELER_FUNCTION size_type find_index(Axis ax, real_type pos) const;
+
+    // Convert cell indices to a local volume
+    inline CELER_FUNCTION VolumeId to_volume(const Coords& coords) const;
+
+    // Convert a local volume to cell indices
+    inline CELER_FUNCTION Coords to_coords(VolumeId vol) const;
+
+    // Convert an edge index along an axis to a local surface
+    inline CELER_FUNCTION SurfaceId to_surface(Axis ax, size_type edge) const;
+
+  private:
+    //// DATA ////
+    const ParamsRef&       params_;
+    const RectArrayRecord& record_;
+
+    //// METHODS ////
+
+    // Get the edges along an axis
+    inline CELER_FUNCTION Span<const real_type> edges(Axis ax) const;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with reference to persistent parameter data.
+ */
+CELER_FUNCTION
+RectArrayTracker::RectArrayTracker(const ParamsRef& params, RectArrayId id)
+    : params_(params), record_(params.rect_arrays[id])
+{
+    CELER_EXPECT(params_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the local volume from a position.
+ *
+ * A point on an interior edge belongs to the cell above it. The result is a
+ * null volume if the point is outside the array.
+ */
+CELER_FUNCTION auto
+RectArrayTracker::initialize(const LocalState& state) const -> Initialization
+{
+    CELER_EXPECT(!state.surface && !state.volume);
+
+    Coords coords;
+    for (auto ax : range(Axis::size_))
+    {
+        const auto i  = static_cast<int>(ax);
+        coords[i]     = this->find_index(ax, state.pos[i]);
+        if (coords[i] == record_.num_cells(ax))
+        {
+            // Outside the array
+            return {};
+        }
+    }
+    return {this->to_volume(coords), {}};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the local volume on the opposite side of a surface.
+ *
+ * The surface sense in the state is the post-crossing sense: "outside" (the
+ * positive side) is the cell above the edge.
+ */
+CELER_FUNCTION auto
+RectArrayTracker::cross_boundary(const LocalState& state) const
+    -> Initialization
+{
+    CELER_EXPECT(state.surface && state.volume);
+
+    // Find the axis and edge index of the surface
+    size_type edge = state.surface.id().unchecked_get();
+    int       i    = 0;
+    while (edge >= record_.grid[i].size())
+    {
+        edge -= record_.grid[i].size();
+        ++i;
+        CELER_ASSERT(i < 3);
+    }
+
+    Coords coords = this->to_coords(state.volume);
+    if (state.surface.sense() == Sense::outside)
+    {
+        coords[i] = edge;
+    }
+    else
+    {
+        coords[i] = edge - 1;
+    }
+
+    if (edge == 0 || coords[i] >= record_.num_cells(static_cast<Axis>(i)))
+    {
+        // Crossed an outer edge of the array
+        return {};
+    }
+    return {this->to_volume(coords), state.surface};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate distance to the next cell.
+ */
+CELER_FUNCTION auto RectArrayTracker::intersect(const LocalState& state) const
+    -> Intersection
+{
+    CELER_EXPECT(state.volume);
+
+    const Coords coords = this->to_coords(state.volume);
+
+    Intersection result;
+    for (auto ax : range(Axis::size_))
+    {
+        const auto      i   = static_cast<int>(ax);
+        const real_type dir = state.dir[i];
+        if (dir == 0)
+        {
+            continue;
+        }
+
+        // Next edge along the direction of travel
+        const size_type edge = coords[i] + (dir > 0 ? 1 : 0);
+        if (edge == 0 || edge == record_.num_cells(ax))
+        {
+            // Outer edges are found by the parent universe
+            continue;
+        }
+
+        real_type dist = (this->edges(ax)[edge] - state.pos[i]) / dir;
+        if (dist < result.distance)
+        {
+            result.surface  = {this->to_surface(ax, edge),
+                              dir > 0 ? Sense::inside : Sense::outside};
+            result.distance = dist;
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate distance to the next cell up to a maximum distance.
+ */
+CELER_FUNCTION auto
+RectArrayTracker::intersect(const LocalState& state, real_type max_dist) const
+    -> Intersection
+{
+    CELER_EXPECT(max_dist > 0);
+    Intersection result = this->intersect(state);
+    if (result.distance > max_dist)
+    {
+        result.surface  = {};
+        result.distance = max_dist;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate nearest distance to a cell edge in any direction.
+ *
+ * The outer edges of the array are included, so this is the distance to the
+ * nearest face of the current cell.
+ */
+CELER_FUNCTION real_type RectArrayTracker::safety(const Real3& pos,
+                                                  VolumeId     vol) const
+{
+    CELER_EXPECT(vol);
+
+    const Coords coords = this->to_coords(vol);
+
+    real_type result = numeric_limits<real_type>::infinity();
+    for (auto ax : range(Axis::size_))
+    {
+        const auto            i     = static_cast<int>(ax);
+        Span<const real_type> edges = this->edges(ax);
+        result = celeritas::min(result, pos[i] - edges[coords[i]]);
+        result = celeritas::min(result, edges[coords[i] + 1] - pos[i]);
+    }
+    return clamp_to_nonneg(result);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the local surface normal.
+ */
+CELER_FUNCTION auto
+RectArrayTracker::normal(const Real3&, SurfaceId surf) const -> Real3
+{
+    CELER_EXPECT(surf < this->num_surfaces());
+
+    size_type edge = surf.unchecked_get();
+    int       i    = 0;
+    while (edge >= record_.grid[i].size())
+    {
+        edge -= record_.grid[i].size();
+        ++i;
+    }
+
+    Real3 result{0, 0, 0};
+    result[i] = 1;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the cell index along an axis.
+ *
+ * Evenly spaced edges let the index be calculated directly; the result is
+ * then corrected for roundoff by comparing against the neighboring edges.
+ * The number of cells is returned if the point is outside the array.
+ */
+CELER_FUNCTION size_type RectArrayTracker::find_index(Axis      ax,
+                                                      real_type pos) const
+{
+    Span<const real_type> edges = this->edges(ax);
+    const size_type       num_cells = edges.size() - 1;
+
+    if (!(pos >= edges.front() && pos < edges.back()))
+    {
+        // Outside the array (or NaN)
+        return num_cells;
+    }
+
+    const real_type width = record_.uniform_width[static_cast<int>(ax)];
+    if (width > 0)
+    {
+        auto result = static_cast<size_type>((pos - edges.front()) / width);
+        result      = celeritas::min(result, num_cells - 1);
+        if (pos < edges[result])
+        {
+            --result;
+        }
+        else if (pos >= edges[result + 1])
+        {
+            ++result;
+        }
+        CELER_ENSURE(result < num_cells);
+        return result;
+    }
+
+    // Binary search for the first edge above the point
+    auto iter = celeritas::upper_bound(edges.begin(), edges.end(), pos);
+    CELER_ASSERT(iter != edges.begin() && iter != edges.end());
+    return (iter - edges.begin()) - 1;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert cell indices to a local volume.
+ */
+CELER_FUNCTION VolumeId RectArrayTracker::to_volume(const Coords& coords) const
+{
+    const size_type ny = record_.num_cells(Axis::y);
+    const size_type nz = record_.num_cells(Axis::z);
+    CELER_EXPECT(coords[0] < record_.num_cells(Axis::x) && coords[1] < ny
+                 && coords[2] < nz);
+
+    return VolumeId{(coords[0] * ny + coords[1]) * nz + coords[2]};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a local volume to cell indices.
+ */
+CELER_FUNCTION auto RectArrayTracker::to_coords(VolumeId vol) const -> Coords
+{
+    CELER_EXPECT(vol < this->num_volumes());
+
+    const size_type ny = record_.num_cells(Axis::y);
+    const size_type nz = record_.num_cells(Axis::z);
+
+    size_type idx = vol.unchecked_get();
+    Coords    result;
+    result[2] = idx % nz;
+    idx /= nz;
+    result[1] = idx % ny;
+    result[0] = idx / ny;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert an edge index along an axis to a local surface.
+ */
+CELER_FUNCTION SurfaceId RectArrayTracker::to_surface(Axis      ax,
+                                                      size_type edge) const
+{
+    CELER_EXPECT(edge < record_.grid[static_cast<int>(ax)].size());
+
+    size_type result = edge;
+    for (int i = 0; i < static_cast<int>(ax); ++i)
+    {
+        result += record_.grid[i].size();
+    }
+    return SurfaceId{result};
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Get the edges along an axis.
+ */
+CELER_FUNCTION Span<const real_type> RectArrayTracker::edges(Axis ax) const
+{
+    return params_.reals[record_.grid[static_cast<int>(ax)]];
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -11,6 +11,7 @@
 
 #include "corecel/Assert.hh"
 #include "corecel/math/Algorithms.hh"
+#include "orange/BoundingBoxUtils.hh"
 #include "orange/OrangeData.hh"
 #include "orange/surf/Surfaces.hh"
 
@@ -93,7 +94,19 @@ class SimpleUnitTracker
     //// METHODS ////
 
     // Get volumes that have the given surface as a "face" (connectivity)
-    inline CELER_FUNCTION Span<const VolumeId> get_neighbors(SurfaceId) const;
+    inline CELER_FUNCTION const Connectivity& get_connectivity(SurfaceId) const;
+
+    // Visit candidate volumes in a hierarchy until the visitor returns true
+    template<class F>
+    inline CELER_FUNCTION VolumeId find_in_bvh(ItemRange<BvhNode>,
+                                               const Real3&,
+                                               F&&) const;
+
+    // Visit neighbors of a surface until the visitor returns true
+    template<class F>
+    inline CELER_FUNCTION VolumeId find_neighbor(SurfaceId,
+                                                 const Real3&,
+                                                 F&&) const;
 
     template<class F>
     inline CELER_FUNCTION Intersection intersect_impl(const LocalState&,
@@ -136,6 +149,10 @@ SimpleUnitTracker::SimpleUnitTracker(const ParamsRef& params, SimpleUnitId suid)
 /*!
  * Find the local volume from a position.
  *
+ * Only volumes whose bounding boxes contain the point are tested: the
+ * bounding volume hierarchy nodes are visited in depth-first order, skipping
+ * past the subtree of any node whose box excludes the point.
+ *
  * To avoid edge cases and inconsistent logical/physical states, it is
  * prohibited to initialize from an arbitrary point directly onto a surface.
  */
@@ -148,35 +165,37 @@ SimpleUnitTracker::initialize(const LocalState& state) const -> Initialization
     detail::SenseCalculator calc_senses(
         this->make_local_surfaces(), state.pos, state.temp_sense);
 
-    // Loop over all volumes (TODO: use BVH)
-    for (VolumeId volid : range(VolumeId{this->num_volumes()}))
-    {
-        VolumeView vol = this->make_local_volume(volid);
-
-        // Calculate the local senses, and see if we're inside.
-        auto logic_state = calc_senses(vol);
+    // Test candidate volumes in the BVH
+    size_type num_tested = 0;
+    bool      on_face    = false;
+    VolumeId  volid      = this->find_in_bvh(
+        unit_record_.bvh, state.pos, [&](VolumeId id) {
+            ++num_tested;
+            VolumeView vol = this->make_local_volume(id);
 
-        // Evalulate whether the senses are "inside" the volume
-        if (!detail::LogicEvaluator(vol.logic())(logic_state.senses))
-        {
-            // State is *not* inside this volume: try the next one
-            continue;
-        }
-        if (logic_state.face)
-        {
-            // Initialized on a boundary in this volume but wasn't known
-            // to be crossing a surface. Fail safe by letting the multi-level
-            // tracking geometry (NOT YET IMPLEMENTED in GPU ORANGE) bump and
-            // try again.
-            break;
-        }
+            // Calculate the local senses, and see if we're inside.
+            auto logic_state = calc_senses(vol);
 
-        // Found and not unexpectedly on a surface!
-        return {volid, {}};
+            // Evalulate whether the senses are "inside" the volume
+            if (!detail::LogicEvaluator(vol.logic())(logic_state.senses))
+            {
+                // State is *not* inside this volume: try the next one
+                return false;
+            }
+            // Initialized on a boundary in this volume but wasn't known to be
+            // crossing a surface if a face is set. Fail safe by letting the
+            // multi-level tracking geometry (NOT YET IMPLEMENTED in GPU
+            // ORANGE) bump and try again.
+            on_face = static_cast<bool>(logic_state.face);
+            return true;
+        });
+
+    if (!volid || on_face)
+    {
+        // Not found, or default to background volume
+        volid = unit_record_.background;
     }
-
-    // Not found, or default to background volume
-    return {unit_record_.background, {}};
+    return {volid, {}, num_tested};
 }
 
 //---------------------------------------------------------------------------//
@@ -191,39 +210,49 @@ SimpleUnitTracker::cross_boundary(const LocalState& state) const
     detail::SenseCalculator calc_senses(
         this->make_local_surfaces(), state.pos, state.temp_sense);
 
-    // Loop over all connected surfaces (TODO: intersect with BVH)
-    for (VolumeId volid : this->get_neighbors(state.surface.id()))
-    {
-        if (volid == state.volume)
-        {
-            // Cannot cross surface into the same volume
-            continue;
-        }
-        VolumeView vol = this->make_local_volume(volid);
+    // Test volumes connected to the surface that may contain the point
+    size_type      num_tested = 0;
+    detail::OnFace face;
+    VolumeId       volid = this->find_neighbor(
+        state.surface.id(), state.pos, [&](VolumeId id) {
+            if (id == state.volume)
+            {
+                // Cannot cross surface into the same volume
+                return false;
+            }
+            ++num_tested;
+            VolumeView vol = this->make_local_volume(id);
 
-        // Calculate the local senses and face
-        auto logic_state
-            = calc_senses(vol, detail::find_face(vol, state.surface));
+            // Calculate the local senses and face
+            auto logic_state
+                = calc_senses(vol, detail::find_face(vol, state.surface));
 
-        // Evaluate whether the senses are "inside" the volume
-        if (!detail::LogicEvaluator(vol.logic())(logic_state.senses))
-        {
-            // Not inside the volume
-            continue;
-        }
+            // Evaluate whether the senses are "inside" the volume
+            if (!detail::LogicEvaluator(vol.logic())(logic_state.senses))
+            {
+                // Not inside the volume
+                return false;
+            }
+            face = logic_state.face;
+            return true;
+        });
 
+    if (volid)
+    {
         // Found the volume! Convert the face to a surface ID and return
-        return {volid, get_surface(vol, logic_state.face)};
+        return {volid,
+                get_surface(this->make_local_volume(volid), face),
+                num_tested};
     }
 
     if (unit_record_.background)
     {
         // In the background volume on the surface equal to the face ID
-        return {unit_record_.background, state.surface};
+        return {unit_record_.background, state.surface, num_tested};
     }
 
     // Not found
-    return {};
+    return {{}, {}, num_tested};
 }
 
 //---------------------------------------------------------------------------//
@@ -259,12 +288,12 @@ SimpleUnitTracker::intersect(const LocalState& state, real_type max_dist) const
 /*!
  * Calculate nearest distance to a surface in any direction.
  *
- * The safety calculation uses a very limited method for calculating the safety
- * distance: it's the nearest distance to any surface, for a certain subset of
- * surfaces.  Other surface types will return a safety distance of zero.
- * Complex surfaces might return the distance to internal surfaces that do not
- * represent the edge of a volume. Such distances are conservative but will
- * necessarily slow down the simulation.
+ * The safety distance is the nearest distance to any face of the volume. It
+ * is exact for volumes bounded only by planes, spheres, and cylinders
+ * ("simple safety"); general quadrics use a conservative lower bound on the
+ * distance. Complex volumes might return the distance to internal surfaces
+ * that do not represent the edge of a volume. Such distances are conservative
+ * but will necessarily slow down the simulation.
  */
 CELER_FUNCTION real_type SimpleUnitTracker::safety(const Real3& pos,
                                                    VolumeId     volid) const
@@ -272,12 +301,6 @@ CELER_FUNCTION real_type SimpleUnitTracker::safety(const Real3& pos,
     CELER_EXPECT(volid);
 
     VolumeView vol = this->make_local_volume(volid);
-    if (!vol.simple_safety())
-    {
-        // Has a tricky surface: we can't use the simple algorithm to calculate
-        // the safety, so return a conservative estimate.
-        return 0;
-    }
 
     // Calculate minimim distance to all local faces
     real_type result      = numeric_limits<real_type>::infinity();
@@ -313,8 +336,8 @@ SimpleUnitTracker::normal(const Real3& pos, SurfaceId surf) const -> Real3
 /*!
  * Get volumes that have the given surface as a "face" (connectivity).
  */
-CELER_FUNCTION auto SimpleUnitTracker::get_neighbors(SurfaceId surf) const
-    -> Span<const VolumeId>
+CELER_FUNCTION auto SimpleUnitTracker::get_connectivity(SurfaceId surf) const
+    -> const Connectivity&
 {
     CELER_EXPECT(surf < this->num_surfaces());
 
@@ -323,7 +346,72 @@ CELER_FUNCTION auto SimpleUnitTracker::get_neighbors(SurfaceId surf) const
     const Connectivity& conn = params_.connectivities[conn_id];
 
     CELER_ENSURE(!conn.neighbors.empty());
-    return params_.volume_ids[conn.neighbors];
+    return conn;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Visit candidate volumes in a hierarchy until the visitor returns true.
+ *
+ * The nodes are visited in depth-first order, skipping past the subtree of
+ * any node whose bounding box excludes the point. The result is the volume
+ * for which the visitor returned true, or a null ID if none did.
+ */
+template<class F>
+CELER_FUNCTION VolumeId SimpleUnitTracker::find_in_bvh(ItemRange<BvhNode> bvh,
+                                                       const Real3&       pos,
+                                                       F&& visit) const
+{
+    Span<const BvhNode> nodes    = params_.bvh_nodes[bvh];
+    size_type           node_idx = 0;
+    while (node_idx < nodes.size())
+    {
+        const BvhNode& node = nodes[node_idx];
+        if (!is_inside(node.bbox, pos))
+        {
+            // Skip this node and its children
+            node_idx = node.escape;
+            continue;
+        }
+        ++node_idx;
+
+        for (VolumeId volid : params_.volume_ids[node.volumes])
+        {
+            if (visit(volid))
+            {
+                return volid;
+            }
+        }
+    }
+    return {};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Visit neighbors of a surface until the visitor returns true.
+ *
+ * Surfaces shared by many volumes have a hierarchy of their neighbors'
+ * bounding boxes so that only those near the point are visited.
+ */
+template<class F>
+CELER_FUNCTION VolumeId SimpleUnitTracker::find_neighbor(SurfaceId    surf,
+                                                         const Real3& pos,
+                                                         F&& visit) const
+{
+    const Connectivity& conn = this->get_connectivity(surf);
+    if (!conn.bvh.empty())
+    {
+        return this->find_in_bvh(conn.bvh, pos, visit);
+    }
+
+    for (VolumeId volid : params_.volume_ids[conn.neighbors])
+    {
+        if (visit(volid))
+        {
+            return volid;
+        }
+    }
+    return {};
 }
 
 //---------------------------------------------------------------------------//
@@ -338,7 +426,9 @@ CELER_FUNCTION auto SimpleUnitTracker::get_neighbors(SurfaceId surf) const
  *   *only* intersections that are valid (either finite *or* less than the
  *   user-supplied maximum). The buffer contains the distances, the face
  *   indices, and an index used for sorting (if the volume has internal
- *   surfaes).
+ *   surfaes). On the host, the surfaces are grouped by type so that each
+ *   group is intersected in a single vectorizable loop. Equal distances are
+ *   ordered by face so that host and device pick the same surface.
  * - If no intersecting surfaces are found, return immediately. (Rely on the
  *   caller to set the "maximum distance" if we're not searching to infinity.)
  * - If the volume has no special cases, find the closest surface by calling \c
@@ -362,20 +452,38 @@ SimpleUnitTracker::intersect_impl(const LocalState& state, F is_valid) const
     // Find all valid (nearby or finite, depending on F) surface intersection
     // distances inside this volume. Fill the `isect` array if the tracking
     // algorithm requires sorting.
+    FaceId on_face = state.surface ? vol.find_face(state.surface.id())
+                                   : FaceId{};
+#if CELER_DEVICE_COMPILE
     auto calc_intersections = make_surface_action(
         this->make_local_surfaces(),
-        detail::CalcIntersections<const F&>{
-            state.pos,
-            state.dir,
-            is_valid,
-            state.surface ? vol.find_face(state.surface.id()) : FaceId{},
-            vol.simple_intersection(),
-            state.temp_next});
+        detail::CalcIntersections<const F&>{state.pos,
+                                            state.dir,
+                                            is_valid,
+                                            on_face,
+                                            vol.simple_intersection(),
+                                            state.temp_next});
     for (SurfaceId surface : vol.faces())
     {
         calc_intersections(surface);
     }
     CELER_ASSERT(calc_intersections.action().face_idx() == vol.num_faces());
+#else
+    // On the host, intersect all faces of each surface type together
+    auto calc_intersections = make_surface_type_action(
+        detail::CalcBatchIntersections<const F&>{state.pos,
+                                                 state.dir,
+                                                 is_valid,
+                                                 on_face,
+                                                 vol.simple_intersection(),
+                                                 state.temp_next});
+    for (const FaceBatchRecord& batch : vol.face_batches())
+    {
+        calc_intersections(
+            batch.type, vol.batch_faces(batch), vol.batch_data(batch));
+    }
+    CELER_ASSERT(calc_intersections.action().num_faces() == vol.num_faces());
+#endif
     size_type num_isect = calc_intersections.action().isect_idx();
     CELER_ASSERT(num_isect <= vol.max_intersections());
 
@@ -393,12 +501,15 @@ SimpleUnitTracker::intersect_impl(const LocalState& state, F is_valid) const
     }
     else
     {
-        // Sort valid intersection distances in ascending order
-        celeritas::sort(state.temp_next.isect,
-                        state.temp_next.isect + num_isect,
-                        [&state](size_type a, size_type b) {
-                            return state.temp_next.distance[a]
-                                   < state.temp_next.distance[b];
+        // Sort valid intersection distances in ascending order, breaking ties
+        // by face so that the order doesn't depend on the intersection order
+        const auto& next = state.temp_next;
+        celeritas::sort(next.isect,
+                        next.isect + num_isect,
+                        [&next](size_type a, size_type b) {
+                            return next.distance[a] < next.distance[b]
+                                   || (next.distance[a] == next.distance[b]
+                                       && next.face[a] < next.face[b]);
                         });
 
         if (vol.internal_surfaces())
@@ -428,13 +539,19 @@ SimpleUnitTracker::simple_intersect(const LocalState& state,
     CELER_EXPECT(num_isect > 0);
 
     // Crossing any surface will leave the volume; perform a linear search for
-    // the smallest (but positive) distance
-    size_type distance_idx
-        = celeritas::min_element(state.temp_next.distance,
-                                 state.temp_next.distance + num_isect,
-                                 Less<real_type>{})
-          - state.temp_next.distance;
-    CELER_ASSERT(distance_idx < num_isect);
+    // the smallest (but positive) distance, breaking ties by face since the
+    // host intersects the faces out of order
+    const auto& next         = state.temp_next;
+    size_type   distance_idx = 0;
+    for (size_type i = 1; i < num_isect; ++i)
+    {
+        if (next.distance[i] < next.distance[distance_idx]
+            || (next.distance[i] == next.distance[distance_idx]
+                && next.face[i] < next.face[distance_idx]))
+        {
+            distance_idx = i;
+        }
+    }
 
     // Determine the crossing surface
     SurfaceId surface;
@@ -579,29 +696,30 @@ SimpleUnitTracker::background_intersect(const LocalState& state,
         Real3 pos{state.pos};
         axpy(state.temp_next.distance[isect] + bump_dist, state.dir, &pos);
 
-        // Loop over volumes connected to this surface.
-        // TODO: intersection of this with BVH/acceleration grid
-        for (VolumeId vid : this->get_neighbors(surface))
+        // Find a volume connected to this surface that contains the point
+        detail::SenseCalculator calc_senses{
+            this->make_local_surfaces(), pos, state.temp_sense};
+        Span<const Sense> senses;
+        VolumeId          vid = this->find_neighbor(
+            surface, pos, [&](VolumeId id) {
+                CELER_ASSERT(id != state.volume);
+                VolumeView vol = this->make_local_volume(id);
+                senses         = calc_senses(vol).senses;
+                return detail::LogicEvaluator{vol.logic()}(senses);
+            });
+
+        if (vid)
         {
-            CELER_ASSERT(vid != state.volume);
-            VolumeView vol         = this->make_local_volume(vid);
-            auto       logic_state = detail::SenseCalculator{
-                this->make_local_surfaces(), pos, state.temp_sense}(vol);
+            // We are in this new volume by crossing the tested surface.
+            // Get the sense corresponding to this "crossed" surface.
+            auto face = this->make_local_volume(vid).find_face(surface);
+            CELER_ASSERT(face);
 
-            if (detail::LogicEvaluator{vol.logic()}(logic_state.senses))
-            {
-                // We are in this new volume by crossing the tested surface.
-                // Get the sense corresponding to this "crossed" surface.
-                auto face = vol.find_face(surface);
-                CELER_ASSERT(face);
-
-                Intersection result;
-                result.distance = state.temp_next.distance[isect];
-                result.surface  = detail::OnSurface{
-                    surface,
-                    flip_sense(logic_state.senses[face.unchecked_get()])};
-                return result;
-            }
+            Intersection result;
+            result.distance = state.temp_next.distance[isect];
+            result.surface  = detail::OnSurface{
+                surface, flip_sense(senses[face.unchecked_get()])};
+            return result;
         }
     }
 
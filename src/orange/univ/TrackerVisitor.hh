@@ -0,0 +1,114 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/univ/TrackerVisitor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/math/Algorithms.hh"
+#include "orange/OrangeData.hh"
+
+#include "RectArrayTracker.hh"
+#include "SimpleUnitTracker.hh"
+#include "UniverseTypeTraits.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a functor to the tracker of a universe.
+ *
+ * The tracker type is chosen at run time from the universe type, and the
+ * functor is called with the tracker as its only argument. The functor must
+ * return the same type for every tracker.
+ *
+ * Example:
+ * \code
+    TrackerVisitor visit_tracker{params};
+    auto safety = visit_tracker(
+        [&pos, vol](const auto& t) { return t.safety(pos, vol); }, uid);
+   \endcode
+ */
+class TrackerVisitor
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ParamsRef = NativeCRef<OrangeParamsData>;
+    //!@}
+
+  public:
+    // Construct from ORANGE params
+    explicit inline CELER_FUNCTION TrackerVisitor(const ParamsRef& params);
+
+    // Apply the function to the tracker for the given universe
+    template<class F>
+    inline CELER_FUNCTION decltype(auto) operator()(F&& func, UniverseId id);
+
+  private:
+    const ParamsRef& params_;
+
+    template<UniverseType U>
+    inline CELER_FUNCTION typename UniverseTypeTraits<U>::tracker_type
+    make_tracker(UniverseId id) const;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from ORANGE params.
+ */
+CELER_FUNCTION TrackerVisitor::TrackerVisitor(const ParamsRef& params)
+    : params_(params)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the function to the tracker for the given universe.
+ */
+template<class F>
+CELER_FUNCTION decltype(auto)
+TrackerVisitor::operator()(F&& func, UniverseId id)
+{
+    CELER_EXPECT(id < params_.universe_type.size());
+
+#define ORANGE_TV_CASE(TYPE)                        \
+    case UniverseType::TYPE:                        \
+        return celeritas::forward<F>(func)(         \
+            this->make_tracker<UniverseType::TYPE>(id))
+
+    switch (params_.universe_type[id])
+    {
+        ORANGE_TV_CASE(simple);
+        ORANGE_TV_CASE(rect_array);
+        default:
+            break;
+    }
+#undef ORANGE_TV_CASE
+    CELER_ASSERT_UNREACHABLE();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create the tracker for a universe of a given type.
+ */
+template<UniverseType U>
+CELER_FUNCTION typename UniverseTypeTraits<U>::tracker_type
+TrackerVisitor::make_tracker(UniverseId id) const
+{
+    CELER_EXPECT(params_.universe_type[id] == U);
+
+    using TraitsT  = UniverseTypeTraits<U>;
+    using IdT      = OpaqueId<typename TraitsT::record_type>;
+    using TrackerT = typename TraitsT::tracker_type;
+
+    return TrackerT{params_, IdT{params_.universe_index[id]}};
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
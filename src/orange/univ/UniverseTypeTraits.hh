@@ -13,7 +13,9 @@ namespace celeritas
 {
 //---------------------------------------------------------------------------//
 struct SimpleUnitRecord;
+struct RectArrayRecord;
 class SimpleUnitTracker;
+class RectArrayTracker;
 
 //---------------------------------------------------------------------------//
 /*!
@@ -31,6 +33,7 @@ struct UniverseTypeTraits;
     }
 
 ORANGE_UNIV_TRAITS(simple, SimpleUnit);
+ORANGE_UNIV_TRAITS(rect_array, RectArray);
 
 #undef ORANGE_UNIV_TRAITS
 
@@ -62,6 +62,17 @@ class VolumeView
     // Get logic definition
     CELER_FORCEINLINE_FUNCTION Span<const logic_int> logic() const;
 
+    // Get faces grouped by surface type
+    CELER_FORCEINLINE_FUNCTION Span<const FaceBatchRecord> face_batches() const;
+
+    // Get the face IDs of a batch
+    CELER_FORCEINLINE_FUNCTION Span<const FaceId>
+    batch_faces(const FaceBatchRecord& batch) const;
+
+    // Get the transposed surface data of a batch
+    CELER_FORCEINLINE_FUNCTION Span<const real_type>
+    batch_data(const FaceBatchRecord& batch) const;
+
     // Get the number of total intersections
     CELER_FORCEINLINE_FUNCTION logic_int max_intersections() const;
 
@@ -168,6 +179,38 @@ CELER_FUNCTION Span<const logic_int> VolumeView::logic() const
     return params_.logic_ints[def_.logic];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get faces grouped by surface type.
+ *
+ * Face batches are only available on the host.
+ */
+CELER_FUNCTION Span<const FaceBatchRecord> VolumeView::face_batches() const
+{
+    return params_.face_batches[def_.face_batches];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the face IDs of a batch of faces with the same surface type.
+ */
+CELER_FUNCTION Span<const FaceId>
+VolumeView::batch_faces(const FaceBatchRecord& batch) const
+{
+    return params_.face_ids[batch.faces];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the surface coefficients of a batch, ordered by coefficient and then
+ * face.
+ */
+CELER_FUNCTION Span<const real_type>
+VolumeView::batch_data(const FaceBatchRecord& batch) const
+{
+    return params_.face_batch_reals[batch.data];
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get the maximum number of surface intersections.
@@ -7,9 +7,24 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cmath>
+
 #include "corecel/Assert.hh"
 #include "corecel/cont/Array.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
 #include "corecel/math/Algorithms.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "orange/surf/ConeAligned.hh"
+#include "orange/surf/CylAligned.hh"
+#include "orange/surf/CylCentered.hh"
+#include "orange/surf/GeneralQuadric.hh"
+#include "orange/surf/Plane.hh"
+#include "orange/surf/PlaneAligned.hh"
+#include "orange/surf/SimpleQuadric.hh"
+#include "orange/surf/Sphere.hh"
+#include "orange/surf/SphereCentered.hh"
+#include "orange/surf/SurfaceTypeTraits.hh"
 
 #include "Types.hh"
 
@@ -56,49 +71,183 @@ struct CalcNormal
 
 //---------------------------------------------------------------------------//
 /*!
- * Calculate the smallest distance from a point to the surface.
+ * Calculate a lower bound on the distance from a point to the surface.
+ *
+ * For planes, spheres, and cylinders, this is the exact distance to the
+ * nearest point on the surface.
  *
- * For certain surface types (spheres, cylinders, planes), defined such that
- * the normal is *outward* (positive when "outside", negative when "inside"),
- * the nearest distance to the surface can be calculated quite trivially.
+ * For cones and quadrics \f$ f(\mathbf{x}) = 0 \f$ with Hessian \f$ H \f$,
+ * the change in the quadric's value over a displacement \f$ \mathbf{s} \f$
+ * is exactly
+ * \f[
+   f(\mathbf{x} + \mathbf{s}) - f(\mathbf{x})
+   = \nabla f \cdot \mathbf{s} + \frac{1}{2} \mathbf{s}^T H \mathbf{s} \,,
+ * \f]
+ * whose magnitude is at most \f$ g r + \lambda r^2 \f$ for a displacement
+ * of length \f$ r \f$, where \f$ g = |\nabla f| \f$ and \f$ \lambda \f$
+ * is half the largest absolute row sum of \f$ H \f$ (which bounds the
+ * magnitude of its eigenvalues). The surface can't be reached until that
+ * bound equals \f$ |f| \f$, so the positive root of the quadratic is a
+ * conservative safety distance:
+ * \f[
+   r = \frac{2|f|}{g + \sqrt{g^2 + 4 \lambda |f|}} \,.
+ * \f]
+ * This is exact for planes and approaches the true distance as the point
+ * nears the surface.
  */
 struct CalcSafetyDistance
 {
     const Real3& pos;
 
-    //! Operate on a surface
-    template<class S>
-    CELER_FUNCTION real_type operator()(S&& surf)
+    //! Distance to an axis-aligned plane
+    template<Axis T>
+    CELER_FUNCTION real_type operator()(const PlaneAligned<T>& surf) const
+    {
+        return std::fabs(this->pos[static_cast<int>(T)] - surf.position());
+    }
+
+    //! Distance to an axis-aligned cylinder centered on the origin
+    template<Axis T>
+    CELER_FUNCTION real_type operator()(const CylCentered<T>& surf) const
     {
-        if (!S::simple_safety())
+        real_type dist_sq = 0;
+        for (auto ax : range(Axis::size_))
         {
-            // Not a surface that satisfies our simplifying constraints: return
-            // a conservative answer.
-            return 0;
+            if (ax != T)
+            {
+                const real_type x = this->pos[static_cast<int>(ax)];
+                dist_sq += x * x;
+            }
         }
+        return std::fabs(std::sqrt(dist_sq) - std::sqrt(surf.radius_sq()));
+    }
 
-        // Calculate outward normal
-        Real3 dir = surf.calc_normal(this->pos);
+    //! Distance to a sphere centered on the origin
+    CELER_FUNCTION real_type operator()(const SphereCentered& surf) const
+    {
+        return std::fabs(norm(this->pos) - std::sqrt(surf.radius_sq()));
+    }
 
-        auto sense = surf.calc_sense(this->pos);
-        // If sense is "positive" (on or outside), flip direction to inward so
-        // that the vector points toward the surface
-        if (sense == SignedSense::outside)
+    //! Distance to a sphere
+    CELER_FUNCTION real_type operator()(const Sphere& surf) const
+    {
+        Real3 rel = this->pos;
+        axpy(real_type(-1), surf.origin(), &rel);
+        return std::fabs(norm(rel) - std::sqrt(surf.radius_sq()));
+    }
+
+    //! Distance to an arbitrary plane
+    CELER_FUNCTION real_type operator()(const Plane& surf) const
+    {
+        return std::fabs(dot_product(surf.normal(), this->pos)
+                         - surf.displacement());
+    }
+
+    //! Distance to an axis-aligned cylinder
+    template<Axis T>
+    CELER_FUNCTION real_type operator()(const CylAligned<T>& surf) const
+    {
+        const Real3 origin  = surf.calc_origin();
+        real_type   dist_sq = 0;
+        for (auto ax : range(Axis::size_))
         {
-            for (real_type& d : dir)
+            if (ax != T)
             {
-                d *= -1;
+                const real_type x = this->pos[static_cast<int>(ax)]
+                                    - origin[static_cast<int>(ax)];
+                dist_sq += x * x;
             }
         }
-        else if (sense == SignedSense::on)
+        return std::fabs(std::sqrt(dist_sq) - std::sqrt(surf.radius_sq()));
+    }
+
+    //! Lower bound on the distance to an axis-aligned cone
+    template<Axis T>
+    CELER_FUNCTION real_type operator()(const ConeAligned<T>& surf) const
+    {
+        const real_type tsq = surf.tangent_sq();
+
+        Real3 rel = this->pos;
+        axpy(real_type(-1), surf.origin(), &rel);
+        real_type val = 0;
+        for (auto ax : range(Axis::size_))
         {
-            return 0;
+            const int i = static_cast<int>(ax);
+            val += (ax == T ? -tsq : 1) * rel[i] * rel[i];
         }
 
-        // Return the closest intersection
-        auto intersect
-            = surf.calc_intersections(this->pos, dir, SurfaceState::off);
-        return *celeritas::min_element(intersect.begin(), intersect.end());
+        // Gradient is twice the scaled relative position
+        Real3 grad = rel;
+        grad[static_cast<int>(T)] *= -tsq;
+        return quadric_safety(
+            val, 2 * norm(grad), celeritas::max(tsq, real_type(1)));
+    }
+
+    //! Lower bound on the distance to a simple quadric
+    CELER_FUNCTION real_type operator()(const SimpleQuadric& surf) const
+    {
+        const auto second = surf.second();
+        const auto first  = surf.first();
+
+        real_type val  = surf.zeroth();
+        Real3     grad = {first[0], first[1], first[2]};
+        for (auto i : range(3))
+        {
+            const real_type x = this->pos[i];
+            val += (second[i] * x + first[i]) * x;
+            grad[i] += 2 * second[i] * x;
+        }
+
+        using std::fabs;
+        const real_type lambda = celeritas::max(
+            celeritas::max(fabs(second[0]), fabs(second[1])), fabs(second[2]));
+        return quadric_safety(val, norm(grad), lambda);
+    }
+
+    //! Lower bound on the distance to a general quadric
+    CELER_FUNCTION real_type operator()(const GeneralQuadric& surf) const
+    {
+        const real_type x = this->pos[0];
+        const real_type y = this->pos[1];
+        const real_type z = this->pos[2];
+        const auto      second = surf.second();
+        const auto      cross  = surf.cross();
+        const auto      first  = surf.first();
+
+        // Value of the quadric at the point
+        const real_type val
+            = (second[0] * x + cross[0] * y + cross[2] * z + first[0]) * x
+              + (second[1] * y + cross[1] * z + first[1]) * y
+              + (second[2] * z + first[2]) * z + surf.zeroth();
+
+        // Magnitude of the gradient
+        const Real3 grad = {
+            2 * second[0] * x + cross[0] * y + cross[2] * z + first[0],
+            2 * second[1] * y + cross[0] * x + cross[1] * z + first[1],
+            2 * second[2] * z + cross[1] * y + cross[2] * x + first[2]};
+
+        // Half the largest absolute row sum of the Hessian
+        using std::fabs;
+        const real_type lambda = celeritas::max(
+            celeritas::max(
+                fabs(second[0]) + (fabs(cross[0]) + fabs(cross[2])) / 2,
+                fabs(second[1]) + (fabs(cross[0]) + fabs(cross[1])) / 2),
+            fabs(second[2]) + (fabs(cross[1]) + fabs(cross[2])) / 2);
+
+        return quadric_safety(val, norm(grad), lambda);
+    }
+
+    //! Safety from the quadric value, gradient norm, and curvature bound
+    static CELER_FUNCTION real_type quadric_safety(real_type val,
+                                                   real_type grad,
+                                                   real_type lambda)
+    {
+        val = std::fabs(val);
+        if (val == 0)
+        {
+            return 0;
+        }
+        return 2 * val / (grad + std::sqrt(grad * grad + 4 * lambda * val));
     }
 };
 
@@ -180,6 +329,121 @@ class CalcIntersections
     size_type        isect_idx_{0};
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Fill an array with valid distances-to-intersection for batches of faces.
+ *
+ * Each call operates on all faces of a single surface type, whose transposed
+ * coefficients (see \c FaceBatchRecord ) are gathered into a local surface
+ * instance. The distances for a fixed-size chunk of faces are calculated in a
+ * loop without branches or loop-carried dependencies so that the compiler can
+ * vectorize it; the valid distances are then compacted into the output. The
+ * resulting intersections are the same as for \c CalcIntersections but are
+ * ordered by surface type rather than by face.
+ */
+template<class IsValid>
+class CalcBatchIntersections
+{
+  public:
+    //! Construct from the particle point, direction, face ID, and temp storage
+    CELER_FUNCTION CalcBatchIntersections(const Real3&        pos,
+                                          const Real3&        dir,
+                                          IsValid             is_valid_isect,
+                                          FaceId              on_face,
+                                          bool                is_simple,
+                                          const TempNextFace& next_face)
+        : pos_(pos)
+        , dir_(dir)
+        , is_valid_isect_(is_valid_isect)
+        , on_face_(on_face)
+        , fill_isect_(!is_simple)
+        , face_(next_face.face)
+        , distance_(next_face.distance)
+        , isect_(next_face.isect)
+    {
+        CELER_EXPECT(face_ && distance_);
+    }
+
+    //! Operate on all faces of a single surface type
+    template<class S>
+    CELER_FUNCTION void operator()(SurfaceClass<S>,
+                                   Span<const FaceId>    faces,
+                                   Span<const real_type> data)
+    {
+        using Intersections = typename S::Intersections;
+        constexpr size_type extent    = S::Storage::extent;
+        constexpr size_type num_isect = Intersections{}.size();
+
+        const size_type num_faces = faces.size();
+        CELER_EXPECT(data.size() == num_faces * extent);
+
+        for (size_type start = 0; start < num_faces; start += chunk_size)
+        {
+            const size_type stop = celeritas::min(start + chunk_size,
+                                                  num_faces);
+
+            // Calculate distances to all faces in the chunk
+            Array<Intersections, chunk_size> all_dist;
+            for (size_type i = start; i < stop; ++i)
+            {
+                Array<real_type, extent> coeffs;
+                for (size_type c = 0; c < extent; ++c)
+                {
+                    coeffs[c] = data[c * num_faces + i];
+                }
+                S    surf{typename S::Storage{coeffs.data(), extent}};
+                auto on_surface = (faces[i] == on_face_) ? SurfaceState::on
+                                                         : SurfaceState::off;
+                all_dist[i - start]
+                    = surf.calc_intersections(pos_, dir_, on_surface);
+            }
+
+            // Copy possible intersections and their faces to the output
+            for (size_type i = start; i < stop; ++i)
+            {
+                for (size_type j = 0; j < num_isect; ++j)
+                {
+                    real_type dist = all_dist[i - start][j];
+                    CELER_ASSERT(dist > 0);
+                    if (is_valid_isect_(dist))
+                    {
+                        face_[isect_idx_]     = faces[i];
+                        distance_[isect_idx_] = dist;
+                        if (fill_isect_)
+                        {
+                            isect_[isect_idx_] = isect_idx_;
+                        }
+                        ++isect_idx_;
+                    }
+                }
+            }
+        }
+        num_faces_ += num_faces;
+    }
+
+    CELER_FUNCTION size_type num_faces() const { return num_faces_; }
+    CELER_FUNCTION size_type isect_idx() const { return isect_idx_; }
+
+  private:
+    //// CONSTANTS ////
+
+    //! Number of faces whose distances are calculated together
+    static constexpr size_type chunk_size = 8;
+
+    //// DATA ////
+
+    const Real3&     pos_;
+    const Real3&     dir_;
+    const IsValid    is_valid_isect_;
+    const FaceId     on_face_;
+    const bool       fill_isect_;
+    FaceId* const    face_;
+    real_type* const distance_;
+    size_type* const isect_;
+    size_type        num_faces_{0};
+    size_type        isect_idx_{0};
+};
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
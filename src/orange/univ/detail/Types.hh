@@ -128,11 +128,16 @@ struct Intersection
  *        |   X     | Initialized on a surface (reject)
  *   X    |         | Initialized
  *   X    |   X     | Crossed surface into new volume
+ *
+ * The number of candidate volumes tested is provided for profiling the
+ * acceleration structures: the track view accumulates it into the
+ * \c volumes_tested state counter.
  */
 struct Initialization
 {
     VolumeId  volume;
     OnSurface surface;
+    size_type num_tested{0}; //!< Number of volumes whose logic was evaluated
 
     //! Whether initialization succeeded
     explicit CELER_FUNCTION operator bool() const
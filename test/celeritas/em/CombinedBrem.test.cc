@@ -10,13 +10,18 @@
 #include "corecel/math/ArrayUtils.hh"
 #include "celeritas/Quantities.hh"
 #include "celeritas/em/interactor/CombinedBremInteractor.hh"
+#include "celeritas/em/interactor/detail/PhysicsConstants.hh"
 #include "celeritas/em/model/CombinedBremModel.hh"
+#include "celeritas/em/process/BremsstrahlungProcess.hh"
+#include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/grid/XsCalculator.hh"
 #include "celeritas/io/SeltzerBergerReader.hh"
 #include "celeritas/mat/MaterialTrackView.hh"
 #include "celeritas/mat/MaterialView.hh"
 #include "celeritas/phys/CutoffView.hh"
 #include "celeritas/phys/InteractionIO.hh"
 #include "celeritas/phys/InteractorHostTestBase.hh"
+#include "celeritas/phys/PhysicsParams.hh"
 
 #include "celeritas_test.hh"
 
@@ -361,6 +366,112 @@ TEST_F(CombinedBremTest, stress_test_combined)
     EXPECT_VEC_SOFT_EQ(expected_avg_energy_samples, avg_energy_samples);
 }
 
+
+TEST_F(CombinedBremTest, multi_element)
+{
+    using namespace constants;
+
+    // Brass-like material with two elements
+    MaterialParams::Input mat_inp;
+    mat_inp.elements  = {{AtomicNumber{29}, units::AmuMass{63.546}, "Cu"},
+                        {AtomicNumber{30}, units::AmuMass{65.38}, "Zn"}};
+    mat_inp.materials = {
+        {0.14 * na_avogadro,
+         293.0,
+         MatterState::solid,
+         {{ElementId{0}, 0.7}, {ElementId{1}, 0.3}},
+         "brass"},
+    };
+    this->set_material_params(mat_inp);
+
+    // Tabulate a constant value on a log grid
+    auto make_vector = [](real_type emin, real_type emax, double value) {
+        ImportPhysicsVector vec{ImportPhysicsVectorType::log, {}, {}};
+        const size_type size = 5;
+        for (auto i : range(size))
+        {
+            vec.x.push_back(emin * std::pow(emax / emin, i / (size - 1.0)));
+            vec.y.push_back(value);
+        }
+        return vec;
+    };
+    const real_type emin = 1e-3;
+    const real_type esb  = seltzer_berger_limit().value();
+    const real_type emax = high_energy_limit().value();
+
+    // Element cross sections differ by a factor of three
+    ImportProcess brems;
+    brems.process_type  = ImportProcessType::electromagnetic;
+    brems.process_class = ImportProcessClass::e_brems;
+    brems.models
+        = {ImportModelClass::e_brems_sb, ImportModelClass::e_brems_lpm};
+    brems.tables = {{ImportTableType::lambda,
+                     ImportUnits::mev,
+                     ImportUnits::cm_inv,
+                     {make_vector(emin, emax, 1.0)}}};
+    brems.micro_xs[ImportModelClass::e_brems_sb]
+        = {{make_vector(emin, esb, 1.0), make_vector(emin, esb, 3.0)}};
+    brems.micro_xs[ImportModelClass::e_brems_lpm]
+        = {{make_vector(esb, emax, 1.0), make_vector(esb, emax, 3.0)}};
+
+    std::vector<ImportProcess> imported;
+    for (int pdg : {11, -11})
+    {
+        brems.particle_pdg  = pdg;
+        brems.secondary_pdg = 22;
+        imported.push_back(brems);
+    }
+    this->set_imported_processes(imported);
+
+    // Only Cu data is available: use it for both elements
+    std::string         data_path = this->test_data_path("celeritas", "");
+    SeltzerBergerReader read_element_data(data_path.c_str());
+    auto read_cu = [&read_element_data](AtomicNumber) {
+        return read_element_data(AtomicNumber{29});
+    };
+
+    BremsstrahlungProcess::Options options;
+    options.combined_model  = true;
+    options.use_integral_xs = false;
+
+    ActionRegistry       actions;
+    PhysicsParams::Input input;
+    input.particles = this->particle_params();
+    input.materials = this->material_params();
+    input.processes.push_back(
+        std::make_shared<BremsstrahlungProcess>(this->particle_params(),
+                                                this->material_params(),
+                                                this->imported_processes(),
+                                                read_cu,
+                                                options));
+    input.action_registry = &actions;
+
+    // Multi-element materials are supported by the combined model
+    std::shared_ptr<PhysicsParams> physics;
+    ASSERT_NO_THROW(physics = std::make_shared<PhysicsParams>(input));
+    ASSERT_EQ(1, physics->num_models());
+
+    // Element-selection CDF spans both the SB and relativistic energy ranges
+    const auto& data = physics->host_ref();
+    ASSERT_EQ(2, data.model_xs.size());
+    for (auto pmid : range(ParticleModelId{data.model_xs.size()}))
+    {
+        const ModelXsTable& model_xs = data.model_xs[pmid];
+        ASSERT_TRUE(model_xs);
+        ASSERT_EQ(1, model_xs.material.size());
+        const ValueTable& table
+            = data.value_tables[data.value_table_ids[model_xs.material[0]]];
+        ASSERT_EQ(2, table.grids.size());
+
+        ValueGridId  grid_id = data.value_grid_ids[table.grids[0]];
+        XsCalculator calc_cdf(data.value_grids[grid_id], data.reals);
+        for (real_type e : {1e-2, 10.0, 1e4, 1e7})
+        {
+            EXPECT_SOFT_EQ(0.7 / (0.7 + 0.3 * 3), calc_cdf(MevEnergy{e}));
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 } // namespace test
 } // namespace celeritas
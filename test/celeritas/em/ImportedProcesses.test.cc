@@ -410,7 +410,12 @@ TEST_F(ImportedProcessesTest, bremsstrahlung_combined_model)
         for (const auto& model : models)
         {
             auto builders = model->micro_xs(applic);
-            EXPECT_TRUE(builders.empty());
+            auto material = materials_->get(mat_id);
+            EXPECT_EQ(material.num_elements(), builders.size());
+            for (auto elcomp_idx : range(material.num_elements()))
+            {
+                EXPECT_TRUE(builders[elcomp_idx]);
+            }
         }
     }
 }
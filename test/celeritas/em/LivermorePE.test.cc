@@ -11,6 +11,7 @@
 
 #include "corecel/cont/Range.hh"
 #include "corecel/data/Ref.hh"
+#include "corecel/math/Algorithms.hh"
 #include "corecel/math/ArrayUtils.hh"
 #include "corecel/sys/Device.hh"
 #include "celeritas/Quantities.hh"
@@ -19,12 +20,15 @@
 #include "celeritas/em/interactor/LivermorePEInteractor.hh"
 #include "celeritas/em/model/LivermorePEModel.hh"
 #include "celeritas/em/xs/LivermorePEMacroXsCalculator.hh"
+#include "celeritas/em/xs/LivermorePEMicroXsCalculator.hh"
 #include "celeritas/grid/ValueGridBuilder.hh"
 #include "celeritas/grid/ValueGridInserter.hh"
 #include "celeritas/grid/XsCalculator.hh"
 #include "celeritas/io/AtomicRelaxationReader.hh"
+#include "celeritas/io/ImportLivermorePE.hh"
 #include "celeritas/io/ImportPhysicsTable.hh"
 #include "celeritas/io/LivermorePEReader.hh"
+#include "celeritas/mat/ElementSelector.hh"
 #include "celeritas/mat/MaterialTrackView.hh"
 #include "celeritas/phys/InteractionIO.hh"
 #include "celeritas/phys/InteractorHostTestBase.hh"
@@ -35,6 +39,48 @@ namespace celeritas
 {
 namespace test
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Mock a heavier element by scaling the energies of the given data.
+ *
+ * The tabulated values are cross sections times the cube of the energy, and
+ * the fits are polynomials in inverse energy.
+ */
+ImportLivermorePE scale_energies(ImportLivermorePE data, double factor)
+{
+    for (ImportPhysicsVector* vec : {&data.xs_lo, &data.xs_hi})
+    {
+        for (double& x : vec->x)
+        {
+            x *= factor;
+        }
+        for (double& y : vec->y)
+        {
+            y *= ipow<3>(factor);
+        }
+    }
+    data.thresh_lo *= factor;
+    data.thresh_hi *= factor;
+    for (ImportLivermoreSubshell& shell : data.shells)
+    {
+        shell.binding_energy *= factor;
+        for (double& e : shell.energy)
+        {
+            e *= factor;
+        }
+        for (std::vector<double>* param : {&shell.param_lo, &shell.param_hi})
+        {
+            double scale = factor;
+            for (double& p : *param)
+            {
+                p *= scale;
+                scale *= factor;
+            }
+        }
+    }
+    return data;
+}
+
 //---------------------------------------------------------------------------//
 class LivermorePETest : public InteractorHostTestBase
 {
@@ -512,6 +558,94 @@ TEST_F(LivermorePETest, macro_xs)
            4.594922185898e-14, 1.367605938008e-14};
     EXPECT_VEC_SOFT_EQ(expected_macro_xs, macro_xs);
 }
+
+TEST_F(LivermorePETest, element_selection)
+{
+    using namespace units;
+    using namespace constants;
+
+    // Mix potassium with a mock element whose edges are at twice the energy
+    MaterialParams::Input mi;
+    mi.elements  = {{AtomicNumber{19}, AmuMass{39.0983}, "K"},
+                   {AtomicNumber{20}, AmuMass{40.078}, "X"}};
+    mi.materials = {{1e-5 * na_avogadro,
+                     293.,
+                     MatterState::solid,
+                     {{ElementId{0}, 0.5}, {ElementId{1}, 0.5}},
+                     "KX"}};
+    this->set_material_params(mi);
+    this->set_material("KX");
+
+    std::string       data_path = this->test_data_path("celeritas", "");
+    LivermorePEReader read_element_data(data_path.c_str());
+    LivermorePEModel  model(
+        ActionId{0},
+        *this->particle_params(),
+        *this->material_params(),
+        [&read_element_data](AtomicNumber z) {
+            auto result = read_element_data(AtomicNumber{19});
+            return z == AtomicNumber{19} ? result
+                                         : scale_energies(std::move(result), 2);
+        });
+
+    // Check the mock element
+    const auto& xs     = model.host_ref().xs;
+    real_type   k_edge = xs.shells[xs.elements[ElementId{0}].shells]
+                           .front()
+                           .binding_energy.value();
+    {
+        LivermorePEMicroXsCalculator calc_xs(model.host_ref(),
+                                             MevEnergy{k_edge});
+        LivermorePEMicroXsCalculator calc_scaled_xs(model.host_ref(),
+                                                    MevEnergy{2 * k_edge});
+        EXPECT_SOFT_EQ(calc_xs(ElementId{0}), calc_scaled_xs(ElementId{1}));
+    }
+
+    // Elements are sampled in the interaction kernel from the exact cross
+    // sections rather than from tabulated CDFs that smear the edges
+    Applicability applic;
+    applic.particle = model.host_ref().ids.gamma;
+    applic.material = MaterialId{0};
+    EXPECT_TRUE(model.micro_xs(applic).empty());
+
+    // Sample elements just below and above the K edge of each element
+    auto          material    = this->material_track().make_material_view();
+    RandomEngine& rng_engine  = this->rng();
+    const int     num_samples = 10000;
+    std::vector<real_type> exact_k_frac;
+    std::vector<real_type> sampled_k_frac;
+    for (real_type energy : {k_edge * (1 - 1e-6),
+                             k_edge * (1 + 1e-6),
+                             2 * k_edge * (1 - 1e-6),
+                             2 * k_edge * (1 + 1e-6)})
+    {
+        ElementSelector select_el(
+            material,
+            LivermorePEMicroXsCalculator{model.host_ref(), MevEnergy{energy}},
+            this->material_track().element_scratch());
+        auto micro_xs = select_el.elemental_micro_xs();
+        exact_k_frac.push_back(micro_xs[0] / (micro_xs[0] + micro_xs[1]));
+
+        int num_k = 0;
+        for (int i = 0; i < num_samples; ++i)
+        {
+            if (select_el(rng_engine) == ElementComponentId{0})
+            {
+                ++num_k;
+            }
+        }
+        sampled_k_frac.push_back(real_type(num_k) / num_samples);
+    }
+
+    // The fraction of potassium jumps at each edge
+    static const real_type expected_exact_k_frac[] = {0.131059727608115,
+                                                      0.577646889912101,
+                                                      0.597603162677282,
+                                                      0.140728327306106};
+    EXPECT_VEC_SOFT_EQ(expected_exact_k_frac, exact_k_frac);
+    EXPECT_VEC_NEAR(exact_k_frac, sampled_k_frac, 0.05);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace test
 
@@ -5,11 +5,15 @@
 //---------------------------------------------------------------------------//
 //! \file celeritas/em/SeltzerBerger.test.cc
 //---------------------------------------------------------------------------//
+#include <algorithm>
+#include <cmath>
+
 #include "corecel/cont/Range.hh"
 #include "corecel/math/Algorithms.hh"
 #include "corecel/math/ArrayUtils.hh"
 #include "celeritas/Quantities.hh"
 #include "celeritas/em/distribution/SBEnergyDistribution.hh"
+#include "celeritas/em/distribution/SBInverseCdfDistribution.hh"
 #include "celeritas/em/interactor/SeltzerBergerInteractor.hh"
 #include "celeritas/em/interactor/detail/SBPositronXsCorrector.hh"
 #include "celeritas/em/model/SeltzerBergerModel.hh"
@@ -91,6 +95,15 @@ class SeltzerBergerTest : public InteractorHostTestBase
                                                    read_element_data);
         data_ = model_->host_ref();
 
+        // Construct a second model that also builds sampling tables
+        cdf_model_
+            = std::make_shared<SeltzerBergerModel>(ActionId{0},
+                                                   *this->particle_params(),
+                                                   *this->material_params(),
+                                                   this->imported_processes(),
+                                                   read_element_data,
+                                                   true);
+
         // Set cutoffs
         CutoffParams::Input           input;
         CutoffParams::MaterialCutoffs material_cutoffs;
@@ -134,6 +147,7 @@ class SeltzerBergerTest : public InteractorHostTestBase
 
   protected:
     std::shared_ptr<SeltzerBergerModel> model_;
+    std::shared_ptr<SeltzerBergerModel> cdf_model_;
     SeltzerBergerRef                    data_;
 };
 
@@ -304,6 +318,171 @@ TEST_F(SeltzerBergerTest, sb_energy_dist)
     EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
 }
 
+TEST_F(SeltzerBergerTest, sb_cdf_tables)
+{
+    EXPECT_TRUE(model_->host_ref().differential_xs.elements[ElementId{0}]
+                    .cdf.empty());
+
+    const auto& xs    = cdf_model_->host_ref().differential_xs;
+    const auto& table = xs.elements[ElementId{0}];
+    ASSERT_EQ(table.grid.values.size(), table.cdf.size());
+
+    // Each row starts at zero and increases monotonically
+    auto            cdf   = xs.reals[table.cdf];
+    const size_type num_y = table.grid.y.size();
+    for (size_type i : range(table.grid.x.size()))
+    {
+        auto row = cdf.subspan(i * num_y, num_y);
+        EXPECT_EQ(0, row.front());
+        EXPECT_TRUE(std::is_sorted(row.begin(), row.end())) << "row " << i;
+    }
+
+    // Integral over the full first and last rows
+    EXPECT_SOFT_EQ(55.891931062058987, cdf[num_y - 1]);
+    EXPECT_SOFT_EQ(354.42883402997762, cdf[cdf.size() - 1]);
+}
+
+TEST_F(SeltzerBergerTest, sb_inverse_cdf)
+{
+    const MevEnergy gamma_cutoff{0.0009};
+    const int       num_samples = 16384;
+
+    // Sample the reduced exiting energy with the given distribution
+    double engine_samples = 0;
+    auto   sample_many = [&](real_type inc_energy, auto& sample_energy) {
+        std::vector<double> result(num_samples);
+        RandomEngine&       rng_engine = this->rng();
+        for (double& kappa : result)
+        {
+            Energy exit_gamma = sample_energy(rng_engine);
+            EXPECT_GT(exit_gamma.value(), gamma_cutoff.value());
+            EXPECT_LT(exit_gamma.value(), inc_energy);
+            kappa = exit_gamma.value() / inc_energy;
+        }
+        engine_samples = double(rng_engine.count()) / num_samples;
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+
+    // Two-sample Kolmogorov-Smirnov statistic
+    auto calc_ks = [](const std::vector<double>& a,
+                      const std::vector<double>& b) {
+        double      result = 0;
+        std::size_t i = 0, j = 0;
+        while (i < a.size() && j < b.size())
+        {
+            if (a[i] <= b[j])
+                ++i;
+            else
+                ++j;
+            result = std::max(result,
+                              std::fabs(double(i) / a.size()
+                                        - double(j) / b.size()));
+        }
+        return result;
+    };
+    // Critical value for a significance of 0.001
+    const double ks_crit = 1.95 * std::sqrt(2.0 / num_samples);
+
+    const ParticleParams& pp = *this->particle_params();
+    const auto positron_mass = pp.get(pp.find(pdg::positron())).mass();
+    const ElementView el     = this->material_params()->get(ElementId{0});
+
+    std::vector<double> ks;
+    std::vector<double> rejection_engine_samples;
+    std::vector<double> cdf_engine_samples;
+    for (real_type inc_energy : {0.001, 0.0045, 0.567, 7.89, 89.0, 901.})
+    {
+        SCOPED_TRACE("Incident energy: " + std::to_string(inc_energy));
+        const Energy   inc{inc_energy};
+        const EnergySq dens_corr
+            = this->density_correction(MaterialId{0}, inc);
+
+        SBEnergyDistHelper helper(model_->host_ref().differential_xs,
+                                  inc,
+                                  ElementId{0},
+                                  dens_corr,
+                                  gamma_cutoff);
+
+        // Electrons
+        {
+            SBEnergyDistribution<SBElectronXsCorrector> sample_rejection(
+                helper, {});
+            SBInverseCdfDistribution<SBElectronXsCorrector> sample_cdf(
+                cdf_model_->host_ref().differential_xs,
+                inc,
+                ElementId{0},
+                dens_corr,
+                gamma_cutoff,
+                {});
+            auto expected = sample_many(inc_energy, sample_rejection);
+            rejection_engine_samples.push_back(engine_samples);
+            auto actual = sample_many(inc_energy, sample_cdf);
+            cdf_engine_samples.push_back(engine_samples);
+            ks.push_back(calc_ks(expected, actual));
+        }
+
+        // Positrons: the rejection sampler's bounding cross section is
+        // only valid well above the cutoff
+        if (inc_energy > 0.1)
+        {
+            SBPositronXsCorrector scale_xs(
+                positron_mass, el, gamma_cutoff, inc);
+            SBEnergyDistribution<SBPositronXsCorrector> sample_rejection(
+                helper, scale_xs);
+            SBInverseCdfDistribution<SBPositronXsCorrector> sample_cdf(
+                cdf_model_->host_ref().differential_xs,
+                inc,
+                ElementId{0},
+                dens_corr,
+                gamma_cutoff,
+                scale_xs);
+            auto expected = sample_many(inc_energy, sample_rejection);
+            auto actual   = sample_many(inc_energy, sample_cdf);
+            ks.push_back(calc_ks(expected, actual));
+        }
+    }
+
+    for (double d : ks)
+    {
+        EXPECT_LT(d, ks_crit);
+    }
+
+    // The inverse CDF sampler uses one uniform real (two engine samples)
+    // per electron, plus one for the density correction acceptance when the
+    // photon is sampled from the tabulated CDF: the acceptance there is at
+    // least 99%, so the sampler practically never loops
+    // clang-format off
+    const double expected_rejection_engine_samples[] = {4.075439453125,
+        4.063720703125, 5.109130859375, 4.67333984375, 4.433349609375,
+        4.337646484375};
+    const double expected_cdf_engine_samples[] = {4, 4, 4.001220703125,
+        2.6617431640625, 2.6982421875, 2.7147216796875};
+    // clang-format on
+    EXPECT_VEC_SOFT_EQ(expected_rejection_engine_samples,
+                       rejection_engine_samples);
+    EXPECT_VEC_SOFT_EQ(expected_cdf_engine_samples, cdf_engine_samples);
+
+    // The interactor uses the tables when they're available
+    this->resize_secondaries(num_samples);
+    auto material_view = this->material_track().make_material_view();
+    auto cutoffs       = this->cutoff_params()->get(MaterialId{0});
+    SeltzerBergerInteractor interact(cdf_model_->host_ref(),
+                                     this->particle_track(),
+                                     this->direction(),
+                                     cutoffs,
+                                     this->secondary_allocator(),
+                                     material_view,
+                                     ElementComponentId{0});
+    RandomEngine& rng_engine = this->rng();
+    for (int i = 0; i < 16; ++i)
+    {
+        Interaction result = interact(rng_engine);
+        this->sanity_check(result);
+        ASSERT_EQ(1, result.secondaries.size());
+    }
+}
+
 TEST_F(SeltzerBergerTest, basic)
 {
     // Reserve 4 secondaries, one for each sample
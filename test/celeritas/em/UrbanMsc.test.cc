@@ -272,6 +272,7 @@ TEST_F(UrbanMscTest, msc_scattering)
         SimTrackState state = {TrackId{i},
                                TrackId{i},
                                EventId{1},
+                               i,
                                i % 2,
                                0,
                                TrackStatus::alive,
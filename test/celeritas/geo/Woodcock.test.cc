@@ -0,0 +1,110 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/geo/Woodcock.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/geo/WoodcockParams.hh"
+
+#include "celeritas/SimpleTestBase.hh"
+#include "celeritas/geo/GeoParams.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class WoodcockTest : public SimpleTestBase
+{
+  protected:
+    using VecRegion = std::vector<WoodcockParams::VecString>;
+
+    WoodcockParams build(VecRegion regions)
+    {
+        WoodcockParams::Input input;
+        input.geometry    = this->geometry();
+        input.geomaterial = this->geomaterial();
+        input.regions     = std::move(regions);
+        return WoodcockParams(input);
+    }
+
+    //! Get the region index of each volume (-1 if none)
+    std::vector<int> volume_regions(const WoodcockParams& woodcock)
+    {
+        const auto&      data = woodcock.host_ref();
+        std::vector<int> result;
+        for (auto vol_id : range(VolumeId{this->geometry()->num_volumes()}))
+        {
+            WoodcockRegionId region = data.volume_region[vol_id];
+            result.push_back(region ? static_cast<int>(region.get()) : -1);
+        }
+        return result;
+    }
+
+    //! Get the material indices of each region
+    std::vector<int> region_materials(const WoodcockParams& woodcock)
+    {
+        const auto&      data = woodcock.host_ref();
+        std::vector<int> result;
+        for (auto region_id : range(WoodcockRegionId{woodcock.num_regions()}))
+        {
+            for (MaterialId mat_id :
+                 data.materials[data.regions[region_id].materials])
+            {
+                result.push_back(mat_id.get());
+            }
+            result.push_back(-1);
+        }
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(WoodcockTest, single)
+{
+    auto woodcock = this->build({{"inner", "world"}});
+    EXPECT_EQ(1, woodcock.num_regions());
+
+    static const int expected_volume_regions[] = {-1, 0, 0};
+    EXPECT_VEC_EQ(expected_volume_regions, this->volume_regions(woodcock));
+    static const int expected_region_materials[] = {0, 1, -1};
+    EXPECT_VEC_EQ(expected_region_materials,
+                  this->region_materials(woodcock));
+}
+
+TEST_F(WoodcockTest, multiple)
+{
+    auto woodcock = this->build({{"world"}, {"inner"}});
+    EXPECT_EQ(2, woodcock.num_regions());
+
+    static const int expected_volume_regions[] = {-1, 1, 0};
+    EXPECT_VEC_EQ(expected_volume_regions, this->volume_regions(woodcock));
+    static const int expected_region_materials[] = {1, -1, 0, -1};
+    EXPECT_VEC_EQ(expected_region_materials,
+                  this->region_materials(woodcock));
+}
+
+TEST_F(WoodcockTest, errors)
+{
+    // No regions
+    EXPECT_THROW(this->build({}), RuntimeError);
+    // Unknown volume
+    EXPECT_THROW(this->build({{"inner", "outer"}}), RuntimeError);
+    // Same volume in multiple regions
+    EXPECT_THROW(this->build({{"inner"}, {"world", "inner"}}), RuntimeError);
+    // No materials
+    EXPECT_THROW(this->build({{"[EXTERIOR]"}}), RuntimeError);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
@@ -6,6 +6,9 @@
 //! \file celeritas/global/AlongStep.test.cc
 //---------------------------------------------------------------------------//
 #include "celeritas/TestEm3Base.hh"
+#include "celeritas/geo/WoodcockParams.hh"
+#include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/alongstep/AlongStepGeneralLinearAction.hh"
 #include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/phys/ParticleParams.hh"
 
@@ -26,6 +29,31 @@ class KnAlongStepTest : public SimpleTestBase, public AlongStepTestBase
   public:
 };
 
+class KnWoodcockAlongStepTest : public KnAlongStepTest
+{
+  public:
+    SPConstAction build_along_step() override
+    {
+        WoodcockParams::Input input;
+        input.geometry    = this->geometry();
+        input.geomaterial = this->geomaterial();
+        input.regions     = regions_;
+
+        auto result = AlongStepGeneralLinearAction::from_params(
+            this->action_reg()->next_id(),
+            *this->material(),
+            *this->particle(),
+            *this->physics(),
+            false,
+            std::make_shared<WoodcockParams>(input));
+        CELER_ASSERT(result->has_woodcock());
+        this->action_reg()->insert(result);
+        return result;
+    }
+
+    std::vector<WoodcockParams::VecString> regions_;
+};
+
 #define Em3AlongStepTest TEST_IF_CELERITAS_GEANT(Em3AlongStepTest)
 class Em3AlongStepTest : public TestEm3Base, public AlongStepTestBase
 {
@@ -206,6 +234,68 @@ TEST_F(Em3AlongStepTest, fluct_nomsc)
         EXPECT_EQ("geo-boundary", result.action);
     }
 }
+
+TEST_F(KnWoodcockAlongStepTest, whole_world)
+{
+    regions_ = {{"inner", "world"}};
+
+    size_type num_tracks = 10;
+    Input     inp;
+    inp.particle_id = this->particle()->find(pdg::gamma());
+    inp.energy      = MevEnergy{10};
+    {
+        SCOPED_TRACE("cross internal boundary from aluminum");
+        auto result = this->run(inp, num_tracks);
+        EXPECT_SOFT_EQ(0, result.eloss);
+        EXPECT_SOFT_EQ(10.008918838569, result.displacement);
+        EXPECT_SOFT_EQ(1, result.angle);
+        EXPECT_SOFT_EQ(3.338615956299e-10, result.time);
+        EXPECT_SOFT_EQ(10.008918838569, result.step);
+        EXPECT_EQ("physics-discrete-select", result.action);
+    }
+    {
+        SCOPED_TRACE("sample from aluminum majorant in vacuum");
+        inp.position = {0, 0, -40};
+        auto result  = this->run(inp, num_tracks);
+        EXPECT_SOFT_EQ(10.008918838569, result.displacement);
+        EXPECT_SOFT_EQ(10.008918838569, result.step);
+        EXPECT_EQ("physics-discrete-select", result.action);
+    }
+    {
+        SCOPED_TRACE("leave the world");
+        inp.position = {0, 0, 45};
+        auto result  = this->run(inp, num_tracks);
+        EXPECT_SOFT_EQ(5, result.displacement);
+        EXPECT_SOFT_EQ(5, result.step);
+        EXPECT_EQ("geo-propagation-limit", result.action);
+    }
+}
+
+TEST_F(KnWoodcockAlongStepTest, inner_only)
+{
+    regions_ = {{"inner"}};
+
+    size_type num_tracks = 10;
+    Input     inp;
+    inp.particle_id = this->particle()->find(pdg::gamma());
+    inp.energy      = MevEnergy{10};
+    {
+        SCOPED_TRACE("stop after leaving the region");
+        auto result = this->run(inp, num_tracks);
+        EXPECT_SOFT_EQ(5, result.displacement);
+        EXPECT_SOFT_EQ(5, result.step);
+        EXPECT_EQ("geo-propagation-limit", result.action);
+    }
+    {
+        SCOPED_TRACE("conventional tracking outside the region");
+        inp.position = {0, 0, -40};
+        auto result  = this->run(inp, num_tracks);
+        EXPECT_SOFT_EQ(35, result.displacement);
+        EXPECT_SOFT_EQ(35, result.step);
+        EXPECT_EQ("geo-boundary", result.action);
+    }
+}
+
 //---------------------------------------------------------------------------//
 } // namespace test
 } // namespace celeritas
@@ -0,0 +1,84 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/StepScratchArena.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/global/StepScratchArena.hh"
+
+#include <cstdint>
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+TEST(StepScratchArenaTest, host)
+{
+    using Arena = StepScratchArena<MemSpace::host>;
+
+    Arena arena;
+    EXPECT_EQ(0, arena.capacity());
+    EXPECT_EQ(0, arena.num_allocations());
+    EXPECT_EQ(nullptr, arena.allocate(0));
+
+    // First allocation creates a block
+    Span<int> a = arena.allocate<int>(10);
+    ASSERT_EQ(10, a.size());
+    EXPECT_EQ(Arena::alignment(), arena.size());
+    EXPECT_EQ(Arena::alignment(), arena.capacity());
+    EXPECT_EQ(1, arena.num_allocations());
+    a[0] = 1;
+    a[9] = 10;
+
+    // Second allocation doesn't fit: a new block is added and the old data
+    // remains valid
+    Span<double> b = arena.allocate<double>(100);
+    ASSERT_EQ(100, b.size());
+    EXPECT_EQ(2, arena.num_allocations());
+    EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(b.data()) % alignof(double));
+    b[99] = 2.0;
+    EXPECT_EQ(1, a[0]);
+    EXPECT_EQ(10, a[9]);
+    const auto step_size = arena.size();
+    EXPECT_EQ(Arena::alignment() + 1024, step_size);
+    EXPECT_LE(step_size, arena.capacity());
+
+    // Reset consolidates into a single block that can hold a full step
+    arena.reset();
+    EXPECT_EQ(0, arena.size());
+    EXPECT_EQ(3, arena.num_allocations());
+    const auto capacity = arena.capacity();
+    EXPECT_LE(step_size, capacity);
+
+    // Repeating the same sequence of allocations needs no more memory
+    for (int i = 0; i < 3; ++i)
+    {
+        arena.allocate<int>(10);
+        arena.allocate<double>(100);
+        EXPECT_EQ(step_size, arena.size());
+        arena.reset();
+    }
+    EXPECT_EQ(3, arena.num_allocations());
+    EXPECT_EQ(capacity, arena.capacity());
+}
+
+TEST(StepScratchArenaTest, TEST_IF_CELER_DEVICE(device))
+{
+    StepScratchArena<MemSpace::device> arena(1024);
+    EXPECT_EQ(1024, arena.capacity());
+    EXPECT_EQ(1, arena.num_allocations());
+
+    Span<int> a = arena.allocate<int>(256);
+    EXPECT_EQ(256, a.size());
+    EXPECT_EQ(1, arena.num_allocations());
+    EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(a.data()) % 256);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
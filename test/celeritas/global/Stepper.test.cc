@@ -7,15 +7,28 @@
 //---------------------------------------------------------------------------//
 #include "celeritas/global/Stepper.hh"
 
+#include <algorithm>
+#include <cstring>
 #include <random>
+#include <string>
+#include <utility>
 
+#include "celeritas_config.h"
 #include "corecel/Types.hh"
 #include "corecel/cont/Range.hh"
 #include "corecel/cont/Span.hh"
+#include "corecel/io/StringUtils.hh"
 #include "celeritas/field/UniformFieldData.hh"
+#include "celeritas/geo/GeoMaterialParams.hh"
+#include "celeritas/geo/GeoParams.hh"
+#include "celeritas/geo/WoodcockParams.hh"
 #include "celeritas/global/ActionInterface.hh"
 #include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/CoreTrackView.hh"
+#include "celeritas/global/alongstep/AlongStepGeneralLinearAction.hh"
+#include "celeritas/global/alongstep/AlongStepNeutralAction.hh"
 #include "celeritas/global/alongstep/AlongStepUniformMscAction.hh"
+#include "celeritas/global/detail/ActionSequence.hh"
 #include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/phys/ParticleParams.hh"
 #include "celeritas/phys/Primary.hh"
@@ -30,6 +43,12 @@
 
 using celeritas::units::MevEnergy;
 
+#if CELERITAS_RNG == CELERITAS_RNG_PHILOX
+#    define TEST_IF_CELERITAS_PHILOX(name) name
+#else
+#    define TEST_IF_CELERITAS_PHILOX(name) DISABLED_##name
+#endif
+
 namespace celeritas
 {
 namespace test
@@ -111,7 +130,167 @@ class TestEm3MscNofluctTest : public TestEm3Test
 };
 
 //---------------------------------------------------------------------------//
-#define TestEm15Test TEST_IF_CELERITAS_GEANT(TestEm15Test)
+//! Names of the TestEm3 calorimeter layer volumes
+std::vector<std::string> testem3_layer_names()
+{
+    std::vector<std::string> result;
+    for (auto i : range(50))
+    {
+        result.push_back("gap_lv_" + std::to_string(i));
+        result.push_back("absorber_lv_" + std::to_string(i));
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Count the steps taken by tracks of a single particle type.
+ */
+class ParticleStepCounter final : public ExplicitActionInterface,
+                                  public ConcreteAction
+{
+  public:
+    ParticleStepCounter(ActionId id, ParticleId particle)
+        : ConcreteAction(id, "particle-step-counter", "count steps")
+        , particle_(particle)
+    {
+    }
+
+    void execute(CoreHostRef const& data) const final
+    {
+        this->count(data.params.scalars,
+                    data.states.sim.state,
+                    data.states.particles.state);
+    }
+
+    void execute(CoreDeviceRef const& data) const final
+    {
+        // Copy the simulation and particle states to host
+        StateCollection<SimTrackState, Ownership::value, MemSpace::host> sim;
+        StateCollection<ParticleTrackState, Ownership::value, MemSpace::host>
+            particles;
+        sim       = data.states.sim.state;
+        particles = data.states.particles.state;
+        this->count(data.params.scalars, sim, particles);
+    }
+
+    ActionOrder order() const final { return ActionOrder::post_post; }
+
+    size_type num_steps() const { return num_steps_; }
+    size_type num_tracks() const { return num_tracks_; }
+    size_type num_boundary_steps() const { return num_boundary_steps_; }
+
+  private:
+    //! Count steps from host-accessible track states
+    template<class SimStates, class ParticleStates>
+    void count(CoreScalars const&    scalars,
+               SimStates const&      sim,
+               ParticleStates const& particles) const
+    {
+        for (auto tid : range(ThreadId{sim.size()}))
+        {
+            const SimTrackState& state = sim[tid];
+            if (state.status == TrackStatus::inactive
+                || particles[tid].particle_id != particle_)
+            {
+                continue;
+            }
+            ++num_steps_;
+            if (state.num_steps == 1)
+            {
+                ++num_tracks_;
+            }
+            if (state.step_limit.action == scalars.boundary_action)
+            {
+                ++num_boundary_steps_;
+            }
+        }
+    }
+
+    ParticleId        particle_;
+    mutable size_type num_steps_{0};
+    mutable size_type num_tracks_{0};
+    mutable size_type num_boundary_steps_{0};
+};
+
+//---------------------------------------------------------------------------//
+#define TestEm3WoodcockTest TEST_IF_CELERITAS_GEANT(TestEm3WoodcockTest)
+class TestEm3WoodcockTest : public TestEm3Test
+{
+  public:
+    //! Count photon steps
+    TestEm3WoodcockTest()
+    {
+        auto& action_reg = *this->action_reg();
+        counter_         = std::make_shared<ParticleStepCounter>(
+            action_reg.next_id(), this->particle()->find(pdg::gamma()));
+        action_reg.insert(counter_);
+    }
+
+    //! Optionally track photons through the calorimeter layers as one region
+    SPConstAction build_along_step() override
+    {
+        std::shared_ptr<WoodcockParams> woodcock;
+        if (use_woodcock_)
+        {
+            WoodcockParams::Input input;
+            input.geometry    = this->geometry();
+            input.geomaterial = this->geomaterial();
+            input.regions     = {testem3_layer_names()};
+            woodcock = std::make_shared<WoodcockParams>(input);
+        }
+
+        auto& action_reg = *this->action_reg();
+        auto  result     = AlongStepGeneralLinearAction::from_params(
+            action_reg.next_id(),
+            *this->material(),
+            *this->particle(),
+            *this->physics(),
+            this->enable_fluctuation(),
+            std::move(woodcock));
+        CELER_ASSERT(result->has_woodcock() == use_woodcock_);
+        action_reg.insert(result);
+        return result;
+    }
+
+    //! Make 1GeV photons along +x
+    std::vector<Primary> make_primaries(size_type count) const override
+    {
+        auto result = this->make_primaries_with_energy(count, MevEnergy{1000});
+        for (Primary& p : result)
+        {
+            p.particle_id = this->particle()->find(pdg::gamma());
+        }
+        return result;
+    }
+
+    //! Run photons and print the number of steps per photon
+    const ParticleStepCounter& run_photons()
+    {
+        size_type num_primaries = 4;
+        size_type num_tracks    = 256;
+
+        Stepper<MemSpace::host> step(this->make_stepper_input(num_tracks));
+        this->run(step, num_primaries);
+
+        const ParticleStepCounter& counter = *counter_;
+        EXPECT_LT(0, counter.num_tracks());
+        cout << (use_woodcock_ ? "With" : "Without")
+             << " Woodcock tracking: "
+             << real_type(counter.num_steps()) / counter.num_tracks()
+             << " steps per photon" << std::endl;
+        return counter;
+    }
+
+  protected:
+    bool use_woodcock_{false};
+
+  private:
+    std::shared_ptr<ParticleStepCounter> counter_;
+};
+
+//---------------------------------------------------------------------------//
+#define TestEm15FieldTest TEST_IF_CELERITAS_GEANT(TestEm15FieldTest)
 class TestEm15FieldTest : public TestEm15Base, public StepperTestBase
 {
     bool enable_fluctuation() const override { return false; }
@@ -162,6 +341,326 @@ class TestEm15FieldTest : public TestEm15Base, public StepperTestBase
     size_type max_average_steps() const override { return 500; }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Compton scattering with a secondary stack that is too small.
+ */
+class SimpleComptonTest : public SimpleTestBase, public StepperTestBase
+{
+  public:
+    //! Make 10MeV gammas along +x
+    std::vector<Primary> make_primaries(size_type count) const override
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::gamma());
+        CELER_ASSERT(p.particle_id);
+        p.energy    = MevEnergy{10};
+        p.track_id  = TrackId{0};
+        p.position  = {0, 0, 0};
+        p.direction = {1, 0, 0};
+        p.time      = 0;
+
+        std::vector<Primary> result(count, p);
+        for (auto i : range(count))
+        {
+            result[i].event_id = EventId{i};
+        }
+        return result;
+    }
+
+    size_type max_average_steps() const override { return 100; }
+
+    //! Start with room for one secondary per 32 track slots
+    real_type secondary_stack_factor() const override { return 1.0 / 32; }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compton scattering with room for every secondary.
+ */
+class SimpleComptonFusedTest : public SimpleComptonTest
+{
+  public:
+    real_type secondary_stack_factor() const override { return 1; }
+
+    //! Get the number of secondaries and queued initializers after one step
+    StepperResult run_step(StepperInput input)
+    {
+        // Take a single step from the primaries
+        auto primaries = this->make_primaries(input.num_track_slots);
+        Stepper<MemSpace::host> step(std::move(input));
+        return step(make_span(primaries));
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compton scattering run until every track escapes the world.
+ */
+class SimpleComptonEscapeTest : public SimpleComptonTest
+{
+  public:
+    //! Leave room for every secondary so that no interaction is retried
+    real_type secondary_stack_factor() const override { return 1; }
+
+    //! Low-energy photons scatter many times before escaping
+    size_type max_average_steps() const override { return 1000; }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Kill low-energy photons as a stand-in for photoelectric absorption.
+ */
+class PhotonAbsorber final : public ExplicitActionInterface,
+                             public ConcreteAction
+{
+  public:
+    PhotonAbsorber(ActionId id, ParticleId gamma, MevEnergy threshold)
+        : ConcreteAction(id, "photon-absorber", "absorb low-energy photons")
+        , gamma_(gamma)
+        , threshold_(threshold)
+    {
+    }
+
+    void execute(CoreHostRef const& data) const final
+    {
+        for (auto tid : range(ThreadId{data.states.size()}))
+        {
+            CoreTrackView track(data.params, data.states, tid);
+            auto          sim      = track.make_sim_view();
+            auto          particle = track.make_particle_view();
+            if (sim.status() == TrackStatus::alive
+                && particle.particle_id() == gamma_
+                && particle.energy() < threshold_)
+            {
+                sim.status(TrackStatus::killed);
+            }
+        }
+    }
+
+    void execute(CoreDeviceRef const&) const final
+    {
+        CELER_NOT_IMPLEMENTED("absorbing photons on device");
+    }
+
+    ActionOrder order() const final { return ActionOrder::post_post; }
+
+  private:
+    ParticleId gamma_;
+    MevEnergy  threshold_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compton scattering in the TestEm3 calorimeter layers.
+ *
+ * The absorbers are mock aluminum and everything else is vacuum, so photons
+ * cross many thin layers between interactions. Unlike \c TestEm3WoodcockTest
+ * this does not need Geant4 data. Since the only process is Compton
+ * scattering, low-energy photons are killed rather than left to diffuse
+ * through the calorimeter.
+ */
+class SimpleLayersTest : public SimpleTestBase, public StepperTestBase
+{
+  public:
+    //! Count photon steps and absorb photons below 100 keV
+    SimpleLayersTest()
+    {
+        auto&      action_reg = *this->action_reg();
+        ParticleId gamma      = this->particle()->find(pdg::gamma());
+        counter_ = std::make_shared<ParticleStepCounter>(action_reg.next_id(),
+                                                         gamma);
+        action_reg.insert(counter_);
+        action_reg.insert(std::make_shared<PhotonAbsorber>(
+            action_reg.next_id(), gamma, MevEnergy{0.1}));
+    }
+
+    const char* geometry_basename() const override { return "testem3-flat"; }
+
+    //! Fill the absorbers with mock aluminum and the rest with vacuum
+    SPConstGeoMaterial build_geomaterial() override
+    {
+        const auto&              geo = *this->geometry();
+        GeoMaterialParams::Input input;
+        input.geometry  = this->geometry();
+        input.materials = this->material();
+        for (auto vol_id : range(VolumeId{geo.num_volumes()}))
+        {
+            const Label& label = geo.id_to_label(vol_id);
+            MaterialId   mat_id{1};
+            if (label.name == "[EXTERIOR]")
+            {
+                mat_id = {};
+            }
+            else if (starts_with(label.name, "absorber"))
+            {
+                mat_id = MaterialId{0};
+            }
+            input.volume_to_mat.push_back(mat_id);
+            input.volume_labels.push_back(label);
+        }
+        return std::make_shared<GeoMaterialParams>(std::move(input));
+    }
+
+    //! Optionally track photons through the layers as one region
+    SPConstAction build_along_step() override
+    {
+        std::shared_ptr<WoodcockParams> woodcock;
+        if (use_woodcock_)
+        {
+            WoodcockParams::Input input;
+            input.geometry    = this->geometry();
+            input.geomaterial = this->geomaterial();
+            input.regions     = {testem3_layer_names()};
+            woodcock = std::make_shared<WoodcockParams>(input);
+        }
+
+        auto& action_reg = *this->action_reg();
+        auto  result     = std::make_shared<AlongStepNeutralAction>(
+            action_reg.next_id(), std::move(woodcock));
+        CELER_ASSERT(result->has_woodcock() == use_woodcock_);
+        action_reg.insert(result);
+        return result;
+    }
+
+    //! Make 1MeV photons along +x
+    std::vector<Primary> make_primaries(size_type count) const override
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::gamma());
+        p.energy      = MevEnergy{1};
+        p.track_id    = TrackId{0};
+        p.position    = {-22, 0, 0};
+        p.direction   = {1, 0, 0};
+        p.time        = 0;
+
+        std::vector<Primary> result(count, p);
+        for (auto i : range(count))
+        {
+            result[i].event_id = EventId{i};
+        }
+        return result;
+    }
+
+    //! Electrons have no physics and stop at every layer
+    size_type max_average_steps() const override { return 1000; }
+
+    //! Run photons and print the number of steps per photon
+    const ParticleStepCounter& run_photons()
+    {
+        size_type num_primaries = 64;
+        size_type num_tracks    = 256;
+
+        Stepper<MemSpace::host> step(this->make_stepper_input(num_tracks));
+        this->run(step, num_primaries);
+
+        const ParticleStepCounter& counter = *counter_;
+        EXPECT_EQ(num_primaries, counter.num_tracks());
+        cout << (use_woodcock_ ? "With" : "Without")
+             << " Woodcock tracking: "
+             << real_type(counter.num_steps()) / counter.num_tracks()
+             << " steps and "
+             << real_type(counter.num_boundary_steps()) / counter.num_tracks()
+             << " boundary steps per photon" << std::endl;
+        return counter;
+    }
+
+  protected:
+    bool use_woodcock_{false};
+
+  private:
+    std::shared_ptr<ParticleStepCounter> counter_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate a random number drawn from every active track at each step.
+ *
+ * Each raw 32-bit value is weighted by the bits of the track's energy so that
+ * the sum depends on which track drew it but not on the order in which
+ * tracks are visited.
+ */
+class RngChecksum final : public ExplicitActionInterface, public ConcreteAction
+{
+  public:
+    explicit RngChecksum(ActionId id)
+        : ConcreteAction(id, "rng-checksum", "sum random numbers")
+    {
+    }
+
+    void execute(CoreHostRef const& data) const final
+    {
+        for (auto tid : range(ThreadId{data.states.size()}))
+        {
+            CoreTrackView track(data.params, data.states, tid);
+            if (track.make_sim_view().status() == TrackStatus::inactive)
+            {
+                continue;
+            }
+            real_type energy
+                = value_as<MevEnergy>(track.make_particle_view().energy());
+            ull_int weight{0};
+            std::memcpy(&weight, &energy, sizeof(energy));
+
+            auto rng = track.make_rng_engine();
+            checksum_ += static_cast<ull_int>(rng()) * (weight | 1u);
+        }
+    }
+
+    void execute(CoreDeviceRef const&) const final
+    {
+        CELER_NOT_IMPLEMENTED("summing random numbers on device");
+    }
+
+    ActionOrder order() const final { return ActionOrder::post_post; }
+
+    //! Get and reset the accumulated sum
+    ull_int release() const { return std::exchange(checksum_, 0); }
+
+  private:
+    mutable ull_int checksum_{0};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compton scattering with counter-based random number streams.
+ *
+ * Only the photons interact, but every track draws from its stream so that
+ * the secondaries' streams are also checked.
+ */
+#define SimpleComptonPhiloxTest \
+    TEST_IF_CELERITAS_PHILOX(SimpleComptonPhiloxTest)
+class SimpleComptonPhiloxTest : public SimpleComptonEscapeTest
+{
+  public:
+    SimpleComptonPhiloxTest()
+    {
+        auto& action_reg = *this->action_reg();
+        checksum_ = std::make_shared<RngChecksum>(action_reg.next_id());
+        action_reg.insert(checksum_);
+    }
+
+    //! Make 10MeV gammas in a single event, optionally in reverse order
+    std::vector<Primary> make_primaries(size_type count) const override
+    {
+        auto result = SimpleComptonEscapeTest::make_primaries(count);
+        for (auto i : range(count))
+        {
+            result[i].event_id = EventId{0};
+            result[i].track_id = TrackId{i};
+        }
+        if (reverse_primaries_)
+        {
+            std::reverse(result.begin(), result.end());
+        }
+        return result;
+    }
+
+  protected:
+    std::shared_ptr<RngChecksum> checksum_;
+    bool                         reverse_primaries_{false};
+};
+
 //---------------------------------------------------------------------------//
 // TESTEM3
 //---------------------------------------------------------------------------//
@@ -183,6 +682,7 @@ TEST_F(TestEm3Test, setup)
         "pre-step",
         "along-step-general-linear",
         "physics-discrete-select",
+        "sort-tracks-post",
         "scat-klein-nishina",
         "photoel-livermore",
         "conv-bethe-heitler",
@@ -267,6 +767,110 @@ TEST_F(TestEm3Test, host_multi)
     EXPECT_EQ(44, counts.alive);
 }
 
+TEST_F(TestEm3Test, host_staged)
+{
+    // Stage primaries between steps: results should match host_multi
+
+    size_type num_primaries = 8;
+    size_type num_tracks    = 128;
+
+    Stepper<MemSpace::host> step(this->make_stepper_input(num_tracks));
+
+    // Stage primaries in multiple batches before the first step
+    auto primaries = this->make_primaries(num_primaries);
+    step.stage_primaries(make_span(primaries).subspan(0, 3));
+    step.stage_primaries(make_span(primaries).subspan(3, num_primaries - 3));
+    EXPECT_EQ(num_primaries, step.num_staged());
+    primaries.clear();
+
+    auto counts = step();
+    EXPECT_EQ(0, step.num_staged());
+    EXPECT_EQ(num_primaries, counts.active);
+    EXPECT_EQ(num_primaries, counts.alive);
+    // Host and staging buffers were allocated for each batch
+    EXPECT_EQ(4, counts.allocations);
+
+    counts = step();
+    EXPECT_EQ(num_primaries, counts.active);
+    EXPECT_EQ(num_primaries, counts.alive);
+    EXPECT_EQ(0, counts.allocations);
+
+    // Reuse the staging buffers
+    primaries = this->make_primaries(num_primaries);
+    step.stage_primaries(make_span(primaries));
+    counts = step();
+    EXPECT_EQ(24, counts.active);
+    EXPECT_EQ(24, counts.alive);
+    EXPECT_EQ(0, counts.allocations);
+}
+
+TEST_F(TestEm3Test, host_pool)
+{
+    // Results are independent of the host execution backend
+    size_type num_primaries = 1;
+    size_type num_tracks    = 256;
+
+    auto                    input = this->make_stepper_input(num_tracks);
+    Stepper<MemSpace::host> step(input);
+    auto                    expected = this->run(step, num_primaries);
+
+    input.host_pool.num_threads = 4;
+    input.host_pool.grain_size  = 16;
+    Stepper<MemSpace::host> pool_step(std::move(input));
+    auto                    result = this->run(pool_step, num_primaries);
+    EXPECT_EQ(expected.active, result.active);
+    EXPECT_EQ(expected.queued, result.queued);
+}
+
+TEST_F(TestEm3Test, host_fused)
+{
+    // Fused actions are equivalent to unfused ones, but secondaries are
+    // allocated in a different order so results only match statistically
+    size_type num_primaries = 1;
+    size_type num_tracks    = 256;
+
+    auto input             = this->make_stepper_input(num_tracks);
+    input.fused_chunk_size = 16;
+    Stepper<MemSpace::host> step(std::move(input));
+    EXPECT_TRUE(step.actions().fused());
+
+    auto result = this->run(step, num_primaries);
+    EXPECT_SOFT_NEAR(63490, result.calc_avg_steps_per_primary(), 0.10);
+
+    // User actions are not fused and are called once per step
+    EXPECT_EQ(result.active.size(), this->dummy_action().num_execute_host());
+}
+
+TEST_F(TestEm3Test, host_reorder)
+{
+    size_type num_primaries = 1;
+    size_type num_tracks    = 256;
+
+    auto input           = this->make_stepper_input(num_tracks);
+    input.reorder_period = 1;
+    Stepper<MemSpace::host> step(input);
+
+    // Sorting the tracks groups them by physics tables
+    auto      primaries    = this->make_primaries(num_primaries);
+    auto      counts       = step(make_span(primaries));
+    size_type total_before = 0;
+    for (int i = 0; i < 64; ++i)
+    {
+        counts = step();
+        EXPECT_LT(counts.mixed_after, 9);
+        EXPECT_LE(counts.mixed_after, counts.mixed_before);
+        total_before += counts.mixed_before;
+    }
+    EXPECT_GT(total_before, 0);
+
+    // Tracks are initialized from secondaries in a different order, so
+    // results only match statistically
+    input.reorder_period = 4;
+    Stepper<MemSpace::host> reorder_step(std::move(input));
+    auto result = this->run(reorder_step, num_primaries);
+    EXPECT_SOFT_NEAR(63490, result.calc_avg_steps_per_primary(), 0.10);
+}
+
 TEST_F(TestEm3Test, TEST_IF_CELER_DEVICE(device))
 {
     size_type num_primaries = 8;
@@ -323,6 +927,7 @@ TEST_F(TestEm3MscTest, setup)
         "pre-step",
         "along-step-general-linear",
         "physics-discrete-select",
+        "sort-tracks-post",
         "scat-klein-nishina",
         "photoel-livermore",
         "conv-bethe-heitler",
@@ -492,6 +1097,7 @@ TEST_F(TestEm15FieldTest, setup)
         "pre-step",
         "along-step-uniform-msc",
         "physics-discrete-select",
+        "sort-tracks-post",
         "scat-klein-nishina",
         "photoel-livermore",
         "conv-bethe-heitler",
@@ -565,6 +1171,167 @@ TEST_F(TestEm15FieldTest, TEST_IF_CELER_DEVICE(device))
     }
 }
 
+//---------------------------------------------------------------------------//
+// TESTEM3 - WOODCOCK TRACKING
+//---------------------------------------------------------------------------//
+
+TEST_F(TestEm3WoodcockTest, host_conventional)
+{
+    use_woodcock_ = false;
+
+    // Most photons cross at least one thin layer before interacting
+    const auto& counter = this->run_photons();
+    EXPECT_GT(counter.num_boundary_steps(), counter.num_tracks());
+}
+
+TEST_F(TestEm3WoodcockTest, host_woodcock)
+{
+    use_woodcock_ = true;
+
+    // Photons only stop at a boundary when entering the calorimeter
+    const auto& counter = this->run_photons();
+    EXPECT_LT(counter.num_boundary_steps(), counter.num_tracks());
+}
+
+//---------------------------------------------------------------------------//
+// SIMPLE COMPTON
+//---------------------------------------------------------------------------//
+
+TEST_F(SimpleComptonTest, host_stack_growth)
+{
+    size_type num_primaries = 64;
+    size_type num_tracks    = 64;
+
+    Stepper<MemSpace::host> step(this->make_stepper_input(num_tracks));
+
+    // Most of the first interactions fail to allocate their secondary, and
+    // the stack is grown at the end of the step
+    auto primaries = this->make_primaries(num_primaries);
+    auto counts    = step(make_span(primaries));
+    EXPECT_EQ(num_primaries, counts.active);
+    EXPECT_EQ(num_primaries, counts.alive);
+    EXPECT_LT(2, counts.secondaries);
+    EXPECT_EQ(2, counts.queued);
+    EXPECT_EQ(counts.secondaries, step.max_secondaries());
+    size_type num_first  = counts.secondaries;
+    size_type num_failed = counts.secondaries - counts.queued;
+
+    // The failed interactions are resampled and every secondary fits
+    counts = step();
+    EXPECT_EQ(num_tracks, counts.active);
+    EXPECT_LE(num_failed, counts.secondaries);
+    EXPECT_EQ(2 + counts.secondaries, counts.queued);
+    EXPECT_EQ(0, counts.allocations);
+    EXPECT_EQ(std::max(num_first, counts.secondaries), step.max_secondaries());
+}
+
+TEST_F(SimpleComptonEscapeTest, host_no_processes)
+{
+    size_type num_primaries = 32;
+
+    // Compton electrons have no processes: they must travel to the world
+    // boundary in a single step instead of sampling a discrete interaction
+    Stepper<MemSpace::host> step(this->make_stepper_input(num_primaries));
+    auto result = this->run(step, num_primaries);
+    EXPECT_EQ(0, result.queued.back());
+}
+
+TEST_F(SimpleComptonTest, host_reorder)
+{
+    size_type num_primaries = 64;
+    size_type num_tracks    = 64;
+
+    auto input           = this->make_stepper_input(num_tracks);
+    input.reorder_period = 1;
+    Stepper<MemSpace::host> step(std::move(input));
+
+    // All tracks start in the same material
+    auto primaries = this->make_primaries(num_primaries);
+    auto counts    = step(make_span(primaries));
+    EXPECT_EQ(num_primaries, counts.alive);
+    EXPECT_EQ(0, counts.mixed_before);
+    EXPECT_EQ(0, counts.mixed_after);
+
+    // Many photons have scattered into the world volume: sorting leaves a
+    // single boundary between the materials
+    counts = step();
+    EXPECT_EQ(num_tracks, counts.active);
+    EXPECT_LT(1, counts.mixed_before);
+    EXPECT_EQ(1, counts.mixed_after);
+}
+
+TEST_F(SimpleComptonFusedTest, host)
+{
+    size_type num_tracks = 256;
+
+    auto unfused = this->run_step(this->make_stepper_input(num_tracks));
+    EXPECT_LT(0, unfused.secondaries);
+    EXPECT_EQ(unfused.secondaries, unfused.queued);
+
+    // Chunks of the fused pre-step and interaction actions run concurrently:
+    // every secondary allocated during the step must be kept
+    for (int i = 0; i < 8; ++i)
+    {
+        auto input                  = this->make_stepper_input(num_tracks);
+        input.fused_chunk_size      = 4;
+        input.host_pool.num_threads = 4;
+        auto fused                  = this->run_step(std::move(input));
+        EXPECT_EQ(unfused.secondaries, fused.secondaries);
+        EXPECT_EQ(unfused.queued, fused.queued);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// SIMPLE LAYERS
+//---------------------------------------------------------------------------//
+
+TEST_F(SimpleLayersTest, host_conventional)
+{
+    use_woodcock_ = false;
+
+    // Photons cross several layers between interactions
+    const auto& counter = this->run_photons();
+    EXPECT_GT(counter.num_boundary_steps(), 4 * counter.num_tracks());
+}
+
+TEST_F(SimpleLayersTest, host_woodcock)
+{
+    use_woodcock_ = true;
+
+    // Photons stop at a boundary when entering or leaving the calorimeter
+    const auto& counter = this->run_photons();
+    EXPECT_LT(counter.num_boundary_steps(), 2 * counter.num_tracks());
+}
+
+//---------------------------------------------------------------------------//
+// SIMPLE COMPTON (PHILOX)
+//---------------------------------------------------------------------------//
+
+TEST_F(SimpleComptonPhiloxTest, host_slot_invariance)
+{
+    // Random streams are keyed on the track lineage rather than the slot or
+    // track ID, so results are independent of the decomposition. Reversing
+    // the primaries changes the order in which secondary IDs are assigned.
+    size_type num_primaries = 32;
+
+    Stepper<MemSpace::host> step(this->make_stepper_input(num_primaries));
+    auto                    expected = this->run(step, num_primaries);
+    ull_int                 expected_checksum = checksum_->release();
+
+    reverse_primaries_ = true;
+    for (size_type num_tracks : {64u, 256u})
+    {
+        auto input = this->make_stepper_input(num_tracks);
+        input.host_pool.num_threads = 4;
+        Stepper<MemSpace::host> other_step(std::move(input));
+        auto result = this->run(other_step, num_primaries);
+        EXPECT_NE(expected.active, result.active);
+        EXPECT_EQ(expected.calc_avg_steps_per_primary(),
+                  result.calc_avg_steps_per_primary());
+        EXPECT_EQ(expected_checksum, checksum_->release());
+    }
+}
+
 //---------------------------------------------------------------------------//
 } // namespace test
 } // namespace celeritas
@@ -0,0 +1,94 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/grid/EnergyGridLocator.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/grid/EnergyGridLocator.hh"
+
+#include <cmath>
+
+#include "celeritas/grid/RangeCalculator.hh"
+#include "celeritas/grid/XsCalculator.hh"
+
+#include "CalculatorTestBase.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class EnergyGridLocatorTest : public CalculatorTestBase
+{
+  protected:
+    using Energy = EnergyGridLocator::Energy;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(EnergyGridLocatorTest, find)
+{
+    const auto coarse = UniformGridData::from_bounds(0, std::log(1e4), 5);
+    const auto fine   = UniformGridData::from_bounds(0, std::log(1e4), 9);
+
+    EnergyGridLocator locate(Energy{20});
+    EXPECT_SOFT_EQ(20, locate.energy().value());
+    EXPECT_SOFT_EQ(std::log(20.0), locate.log_energy());
+
+    auto bin = locate.find(UniformGrid(coarse));
+    EXPECT_EQ(1, bin.index);
+    EXPECT_SOFT_EQ(10, bin.lower_energy);
+    EXPECT_SOFT_EQ(100, bin.upper_energy);
+
+    // A grid with the same spacing reuses the bin
+    auto copy = coarse;
+    bin       = locate.find(UniformGrid(copy));
+    EXPECT_EQ(1, bin.index);
+    EXPECT_SOFT_EQ(100, bin.upper_energy);
+
+    // A different grid is located again
+    bin = locate.find(UniformGrid(fine));
+    EXPECT_EQ(2, bin.index);
+    EXPECT_SOFT_EQ(10, bin.lower_energy);
+    EXPECT_SOFT_NEAR(std::sqrt(1e3), bin.upper_energy, 1e-12);
+
+    bin = locate.find(UniformGrid(coarse));
+    EXPECT_EQ(1, bin.index);
+}
+
+TEST_F(EnergyGridLocatorTest, shared_lookups)
+{
+    // Cross section and range lookups on the same grid give the same result
+    // as independent lookups from the energy
+    this->build(0.1, 1e4, 6);
+    this->set_prime_index(2);
+
+    XsGridData range_data  = this->data();
+    range_data.prime_index = XsGridData::no_scaling();
+
+    XsCalculator    calc_xs(this->data(), this->values());
+    RangeCalculator calc_range(range_data, this->values());
+
+    for (real_type e : {0.05, 0.1, 0.2, 3.0, 1e2 - 1e-6, 1e2, 5e3, 1e4, 2e4})
+    {
+        EnergyGridLocator locate(Energy{e});
+        EXPECT_SOFT_EQ(calc_xs(Energy{e}), calc_xs(locate));
+        EXPECT_SOFT_EQ(calc_range(Energy{e}), calc_range(locate));
+        EXPECT_SOFT_EQ(calc_xs(Energy{e}), calc_xs(locate));
+    }
+
+    // Zero energy is below the grid
+    EnergyGridLocator locate(zero_quantity());
+    EXPECT_SOFT_EQ(calc_xs[0], calc_xs(locate));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
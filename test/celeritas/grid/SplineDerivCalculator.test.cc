@@ -0,0 +1,87 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/grid/SplineDerivCalculator.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/grid/SplineDerivCalculator.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(SplineDerivCalculatorTest, linear)
+{
+    SplineDerivCalculator calc_deriv;
+    {
+        const real_type x[] = {1, 2};
+        const real_type y[] = {3, -1};
+        EXPECT_VEC_SOFT_EQ((std::vector<real_type>{0, 0}),
+                           calc_deriv(make_span(x), make_span(y)));
+    }
+    {
+        // Splines reproduce linear functions exactly
+        const real_type x[] = {1, 1.5, 4, 10};
+        const real_type y[] = {3, 4, 9, 21};
+        EXPECT_VEC_NEAR((std::vector<real_type>{0, 0, 0, 0}),
+                        calc_deriv(make_span(x), make_span(y)),
+                        1e-12);
+    }
+}
+
+TEST(SplineDerivCalculatorTest, polynomial)
+{
+    SplineDerivCalculator calc_deriv;
+    {
+        // Parabola
+        const real_type x[] = {0, 1, 3};
+        const real_type y[] = {0, 1, 9};
+        EXPECT_VEC_SOFT_EQ((std::vector<real_type>{2, 2, 2}),
+                           calc_deriv(make_span(x), make_span(y)));
+    }
+    {
+        // Cubic: y = x^3 - 2x
+        const real_type x[] = {1, 2, 4, 5, 8};
+        const real_type y[] = {-1, 4, 56, 115, 496};
+        EXPECT_VEC_SOFT_EQ((std::vector<real_type>{6, 12, 24, 30, 48}),
+                           calc_deriv(make_span(x), make_span(y)));
+    }
+}
+
+TEST(SplineDerivCalculatorTest, nonuniform)
+{
+    SplineDerivCalculator calc_deriv;
+    {
+        // Four points: single cubic with linear second derivative
+        const real_type x[]              = {1, 2, 4, 5};
+        const real_type y[]              = {1, 3, 2, 6};
+        const real_type expected_deriv[] = {-6.3333333333333,
+                                            -2.8333333333333,
+                                            4.1666666666667,
+                                            7.6666666666667};
+        EXPECT_VEC_SOFT_EQ(expected_deriv,
+                           calc_deriv(make_span(x), make_span(y)));
+    }
+    {
+        const real_type x[]              = {1, 2, 4, 5, 8};
+        const real_type y[]              = {1, 3, 2, 6, 0};
+        const real_type expected_deriv[] = {-7.3733333333333,
+                                            -3.0933333333333,
+                                            5.4666666666667,
+                                            0.38666666666667,
+                                            -14.853333333333};
+        EXPECT_VEC_SOFT_EQ(expected_deriv,
+                           calc_deriv(make_span(x), make_span(y)));
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
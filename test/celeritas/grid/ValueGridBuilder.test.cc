@@ -124,6 +124,32 @@ TEST_F(ValueGridBuilderTest, log_grid)
     }
 }
 
+TEST_F(ValueGridBuilderTest, joined_log_grid)
+{
+    using Builder_t = ValueGridLogBuilder;
+
+    // Upper grid is twice as coarse as the lower
+    Builder_t lower(1e1, 1e3, VecReal{.1, .2, .3});
+    Builder_t upper(1e3, 1e7, VecReal{1, 2, 4});
+    auto      joined = Builder_t::from_joined(lower, upper);
+    ASSERT_TRUE(joined);
+    EXPECT_EQ(7, joined->value().size());
+
+    // Build
+    this->build({std::move(joined)});
+
+    // Test results using the physics calculator
+    ASSERT_EQ(1, grid_storage.size());
+    {
+        XsCalculator calc_xs(grid_storage[XsIndex{0}], real_ref);
+        EXPECT_SOFT_EQ(0.1, calc_xs(Energy{1e1}));
+        EXPECT_SOFT_EQ(0.2, calc_xs(Energy{1e2}));
+        EXPECT_SOFT_EQ(1 + 9e3 / 99e3, calc_xs(Energy{1e4}));
+        EXPECT_SOFT_EQ(2.0, calc_xs(Energy{1e5}));
+        EXPECT_SOFT_EQ(4.0, calc_xs(Energy{1e7}));
+    }
+}
+
 TEST_F(ValueGridBuilderTest, DISABLED_generic_grid)
 {
     using Builder_t = ValueGridGenericBuilder;
@@ -12,6 +12,7 @@
 
 #include "corecel/cont/Range.hh"
 #include "corecel/data/CollectionBuilder.hh"
+#include "celeritas/grid/ValueGridInserter.hh"
 
 #include "CalculatorTestBase.hh"
 #include "celeritas_test.hh"
@@ -160,6 +161,107 @@ TEST_F(XsCalculatorTest, TEST_IF_CELERITAS_DEBUG(scaled_off_the_end))
 
     EXPECT_THROW(XsCalculator(data, this->values()), DebugError);
 }
+
+TEST_F(XsCalculatorTest, spline)
+{
+    // Smooth cross section with five points per decade from 1 to 1e4 MeV,
+    // scaled by E above 100 MeV
+    auto calc_exact = [](real_type e) { return std::sqrt(e) / (1 + e / 30); };
+    const size_type   prime_index = 10;
+    const size_type   num_points  = 21;
+    const auto        loge_data   = UniformGridData::from_bounds(
+        0, std::log(real_type(1e4)), num_points);
+    const UniformGrid loge_grid(loge_data);
+    std::vector<real_type> values(num_points);
+    for (auto i : range(num_points))
+    {
+        real_type e = std::exp(loge_grid[i]);
+        values[i]   = calc_exact(e) * (i >= prime_index ? e : 1);
+    }
+
+    Collection<real_type, Ownership::value, MemSpace::host>  reals;
+    Collection<XsGridData, Ownership::value, MemSpace::host> grids;
+    ValueGridInserter insert_linear(&reals, &grids);
+    ValueGridInserter insert_spline(&reals, &grids, true);
+    auto linear_id
+        = insert_linear(loge_grid.data(), prime_index, make_span(values));
+    auto spline_id
+        = insert_spline(loge_grid.data(), prime_index, make_span(values));
+    EXPECT_TRUE(grids[linear_id].second_deriv.empty());
+    EXPECT_EQ(num_points, grids[spline_id].second_deriv.size());
+
+    Collection<real_type, Ownership::const_reference, MemSpace::host> ref;
+    ref = reals;
+    XsCalculator calc_linear(grids[linear_id], ref);
+    XsCalculator calc_spline(grids[spline_id], ref);
+
+    // Compare at grid points and bin midpoints
+    real_type max_linear_err = 0;
+    real_type max_spline_err = 0;
+    for (auto i : range(2 * num_points - 1))
+    {
+        real_type e = std::exp(loge_grid.front()
+                               + i * real_type(0.5) * loge_grid.data().delta);
+        real_type exact = calc_exact(e);
+        max_linear_err  = std::max(
+            max_linear_err, std::fabs(calc_linear(Energy{e}) / exact - 1));
+        max_spline_err  = std::max(
+            max_spline_err, std::fabs(calc_spline(Energy{e}) / exact - 1));
+    }
+    EXPECT_SOFT_NEAR(0.00978, max_linear_err, 1e-3);
+    EXPECT_GT(2e-4, max_spline_err);
+}
+
+TEST_F(XsCalculatorTest, spline_resampled)
+{
+    // Same cross section with twenty points per decade
+    auto calc_exact = [](real_type e) { return std::sqrt(e) / (1 + e / 30); };
+    const size_type   prime_index = 40;
+    const size_type   num_points  = 81;
+    const auto        loge_data   = UniformGridData::from_bounds(
+        0, std::log(real_type(1e4)), num_points);
+    const UniformGrid loge_grid(loge_data);
+    std::vector<real_type> values(num_points);
+    for (auto i : range(num_points))
+    {
+        real_type e = std::exp(loge_grid[i]);
+        values[i]   = calc_exact(e) * (i >= prime_index ? e : 1);
+    }
+
+    Collection<real_type, Ownership::value, MemSpace::host>  reals;
+    Collection<XsGridData, Ownership::value, MemSpace::host> grids;
+    std::vector<size_type>                                   sizes;
+    std::vector<size_type>                                   primes;
+    for (real_type tol : {0.0, 1e-2, 1e-3, 1e-5})
+    {
+        ValueGridInserter insert(&reals, &grids, true, tol);
+        auto grid_id
+            = insert(loge_grid.data(), prime_index, make_span(values));
+        const XsGridData& grid = grids[grid_id];
+        sizes.push_back(grid.log_energy.size);
+        primes.push_back(grid.prime_index);
+        EXPECT_EQ(grid.log_energy.size, grid.second_deriv.size());
+
+        Collection<real_type, Ownership::const_reference, MemSpace::host> ref;
+        ref = reals;
+        XsCalculator calc_xs(grid, ref);
+        real_type    max_err = 0;
+        for (auto i : range(num_points))
+        {
+            real_type e = std::exp(loge_grid[i]);
+            max_err     = std::max(
+                max_err, std::fabs(calc_xs(Energy{e}) / calc_exact(e) - 1));
+        }
+        EXPECT_GE(std::max(tol, real_type(1e-12)), max_err) << "tol=" << tol;
+    }
+
+    // The prime energy stays on the resampled grid
+    static const size_type expected_sizes[]  = {81u, 11u, 17u, 41u};
+    static const size_type expected_primes[] = {40u, 5u, 8u, 20u};
+    EXPECT_VEC_EQ(expected_sizes, sizes);
+    EXPECT_VEC_EQ(expected_primes, primes);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace test
 } // namespace celeritas
@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #include "Physics.test.hh"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 
 #include "corecel/cont/Range.hh"
@@ -621,6 +623,44 @@ TEST_F(PhysicsTrackViewHostTest, cuda_surrogate)
     EXPECT_VEC_SOFT_EQ(expected_step, step);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolate the macroscopic cross sections with cubic splines.
+ */
+class PhysicsTrackViewSplineTest : public PhysicsTrackViewHostTest
+{
+  protected:
+    PhysicsOptions build_physics_options() const override
+    {
+        PhysicsOptions result;
+        result.spline_tables[ValueGridType::macro_xs] = true;
+        return result;
+    }
+};
+
+TEST_F(PhysicsTrackViewSplineTest, use_integral)
+{
+    // The four barks cross sections form a single cubic, which peaks between
+    // the two highest grid points
+    const auto phys = this->make_track_view("electron", MaterialId{2});
+    auto       ppid = this->find_ppid(phys, "barks");
+    ASSERT_TRUE(ppid);
+    const auto& integral_proc = phys.integral_xs_process(ppid);
+    ASSERT_TRUE(integral_proc);
+
+    MaterialView material = this->material()->get(MaterialId{2});
+    real_type    max_xs   = 0;
+    for (real_type loge = std::log(1e-5); loge < std::log(10.0); loge += 0.01)
+    {
+        MevEnergy energy{std::exp(loge)};
+        real_type xs = phys.calc_xs(ppid, material, energy);
+        EXPECT_LE(xs, phys.calc_max_xs(integral_proc, ppid, material, energy))
+            << "at " << energy.value() << " MeV";
+        max_xs = std::max(max_xs, xs);
+    }
+    EXPECT_LT(1.2, max_xs);
+}
+
 //---------------------------------------------------------------------------//
 // PHYSICS TRACK VIEW (DEVICE)
 //---------------------------------------------------------------------------//
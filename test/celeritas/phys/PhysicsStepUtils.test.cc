@@ -7,7 +7,11 @@
 //---------------------------------------------------------------------------//
 #include "celeritas/phys/PhysicsStepUtils.hh"
 
+#include <cmath>
+#include <iomanip>
+
 #include "corecel/data/CollectionStateStore.hh"
+#include "corecel/sys/Stopwatch.hh"
 #include "celeritas/MockTestBase.hh"
 #include "celeritas/phys/CutoffParams.hh"
 #include "celeritas/phys/ParticleParams.hh"
@@ -23,6 +27,80 @@ namespace test
 //---------------------------------------------------------------------------//
 using units::MevEnergy;
 
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the physics step limit with independent table lookups.
+ *
+ * This is \c calc_physics_step_limit with every cross section and range
+ * lookup recalculating the log energy and grid location from the energy, for
+ * benchmarking.
+ */
+StepLimit calc_separate_step_limit(const MaterialTrackView& material,
+                                   const ParticleTrackView& particle,
+                                   PhysicsTrackView&        physics,
+                                   PhysicsStepView&         pstep)
+{
+    const MaterialView mat_view = material.make_material_view();
+
+    real_type total_macro_xs = 0;
+    auto      num_ppid = ParticleProcessId{physics.num_particle_processes()};
+    for (auto ppid : range(num_ppid))
+    {
+        real_type process_xs = 0;
+        if (const auto& process = physics.integral_xs_process(ppid))
+        {
+            process_xs = physics.calc_max_xs(
+                process, ppid, mat_view, particle.energy());
+        }
+        else
+        {
+            process_xs = physics.calc_xs(ppid, mat_view, particle.energy());
+        }
+        total_macro_xs += process_xs;
+        pstep.per_process_xs(ppid) = process_xs;
+    }
+    pstep.macro_xs(total_macro_xs);
+
+    StepLimit limit;
+    limit.step   = 0;
+    limit.action = physics.scalars().discrete_action();
+    if (!particle.is_stopped())
+    {
+        if (total_macro_xs > 0)
+        {
+            limit.step = physics.interaction_mfp() / total_macro_xs;
+        }
+        else
+        {
+            limit.step   = numeric_limits<real_type>::infinity();
+            limit.action = {};
+        }
+
+        if (auto ppid = physics.eloss_ppid())
+        {
+            auto grid_id = physics.value_grid(ValueGridType::range, ppid);
+            real_type range = physics.make_calculator<RangeCalculator>(
+                grid_id)(particle.energy());
+            physics.dedx_range(range);
+
+            real_type eloss_step = physics.range_to_step(range);
+            if (eloss_step <= limit.step)
+            {
+                limit.step   = eloss_step;
+                limit.action = physics.scalars().range_action();
+            }
+
+            real_type fixed_limit = physics.scalars().fixed_step_limiter;
+            if (fixed_limit > 0 && fixed_limit < limit.step)
+            {
+                limit.step   = fixed_limit;
+                limit.action = physics.scalars().fixed_step_action;
+            }
+        }
+    }
+    return limit;
+}
+
 //---------------------------------------------------------------------------//
 // TEST HARNESS
 //---------------------------------------------------------------------------//
@@ -81,6 +159,9 @@ class PhysicsStepUtilsTest : public MockTestBase
                               par->particle_id(),
                               mat->material_id(),
                               ThreadId{0});
+
+        // Clear step data that's normally reset by the pre-step action
+        this->step_view().majorant_xs(false);
         return phys;
     }
 
@@ -359,6 +440,123 @@ TEST_F(PhysicsStepUtilsTest, select_discrete_interaction)
             = {0.9204, 0.9999, 0.4972, 1};
         EXPECT_VEC_EQ(expected_acceptance_rate, acceptance_rate);
     }
+
+    {
+        // Test rejection of virtual collisions with majorant cross sections
+        unsigned int           num_samples = 10000;
+        std::vector<real_type> acceptance_rate;
+
+        auto reject_action
+            = this->physics()->host_ref().scalars.integral_rejection_action();
+
+        MaterialView     mat_view(this->material()->host_ref(), MaterialId{0});
+        PhysicsTrackView phys = this->init_track(
+            &material, MaterialId{0}, &particle, "gamma", MevEnergy{1});
+
+        // Use twice the actual cross section of each process as the majorant
+        real_type xs_maj = 0;
+        auto num_ppid = ParticleProcessId{phys.num_particle_processes()};
+        for (auto ppid : range(num_ppid))
+        {
+            real_type xs = 2 * phys.calc_xs(ppid, mat_view, particle.energy());
+            pstep.per_process_xs(ppid) = xs;
+            xs_maj += xs;
+        }
+
+        for (bool majorant : {false, true})
+        {
+            unsigned int count = 0;
+            for (unsigned int j = 0; j < num_samples; ++j)
+            {
+                phys.reset_interaction_mfp();
+                pstep.macro_xs(xs_maj);
+                pstep.majorant_xs(majorant);
+
+                auto action = select_discrete_interaction(
+                    mat_view, particle, phys, pstep, this->rng());
+                if (action != reject_action)
+                    ++count;
+            }
+            acceptance_rate.push_back(real_type(count) / num_samples);
+        }
+        const real_type expected_acceptance_rate[] = {1, 0.4975};
+        EXPECT_VEC_EQ(expected_acceptance_rate, acceptance_rate);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compare step limit calculation with shared and independent table lookups.
+ *
+ * The reference calculation is identical except that every cross section and
+ * range lookup recalculates the log energy and grid location.
+ */
+TEST_F(PhysicsStepUtilsTest, DISABLED_benchmark)
+{
+    MaterialTrackView material(
+        this->material()->host_ref(), mat_state.ref(), ThreadId{0});
+    ParticleTrackView particle(
+        this->particle()->host_ref(), par_state.ref(), ThreadId{0});
+    PhysicsStepView pstep = this->step_view();
+
+    const size_type num_samples = 1000000;
+
+    cout << std::setw(16) << "particle" << std::setw(14) << "shared [ns]"
+         << std::setw(14) << "separate [ns]" << std::endl;
+    for (const char* name : {"gamma", "celeriton", "electron"})
+    {
+        PhysicsTrackView phys = this->init_track(
+            &material, MaterialId{1}, &particle, name, MevEnergy{1});
+
+        // Log-spaced energies inside the tabulated range
+        std::vector<MevEnergy> energies;
+        for (auto i : range(64))
+        {
+            energies.push_back(MevEnergy{1e-2 * std::pow(10.0, i / 16.0)});
+        }
+
+        // Both calculations must give the same limits
+        for (MevEnergy energy : energies)
+        {
+            particle.energy(energy);
+            phys.interaction_mfp(1);
+            auto shared
+                = calc_physics_step_limit(material, particle, phys, pstep);
+            auto separate
+                = calc_separate_step_limit(material, particle, phys, pstep);
+            EXPECT_EQ(shared.step, separate.step);
+            EXPECT_EQ(shared.action, separate.action);
+        }
+
+        real_type shared_sink = 0;
+        Stopwatch get_shared_time;
+        for (auto i : range(num_samples))
+        {
+            particle.energy(energies[i % energies.size()]);
+            phys.interaction_mfp(1);
+            shared_sink
+                += calc_physics_step_limit(material, particle, phys, pstep)
+                       .step;
+        }
+        double shared_time = get_shared_time();
+
+        real_type separate_sink = 0;
+        Stopwatch get_separate_time;
+        for (auto i : range(num_samples))
+        {
+            particle.energy(energies[i % energies.size()]);
+            phys.interaction_mfp(1);
+            separate_sink
+                += calc_separate_step_limit(material, particle, phys, pstep)
+                       .step;
+        }
+        double separate_time = get_separate_time();
+
+        EXPECT_EQ(shared_sink, separate_sink);
+        cout << std::setw(16) << name << std::setw(14)
+             << shared_time * 1e9 / num_samples << std::setw(14)
+             << separate_time * 1e9 / num_samples << std::endl;
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,146 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/random/PhiloxRngEngine.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/random/PhiloxRngEngine.hh"
+
+#include <vector>
+
+#include "corecel/data/CollectionStateStore.hh"
+#include "celeritas/random/PhiloxRngParams.hh"
+
+#include "RngTally.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+class PhiloxRngEngineTest : public Test
+{
+  protected:
+    using HostStore = CollectionStateStore<PhiloxRngStateData, MemSpace::host>;
+    using uint_t    = PhiloxState::uint_t;
+    using VecUint   = std::vector<uint_t>;
+
+    void SetUp() override
+    {
+        params = std::make_shared<PhiloxRngParams>(12345);
+    }
+
+    //! Draw several values from the given slot
+    VecUint draw(HostStore& states, ThreadId tid, size_type count)
+    {
+        PhiloxRngEngine rng(states.ref(), tid);
+        VecUint         result(count);
+        for (uint_t& u : result)
+        {
+            u = rng();
+        }
+        return result;
+    }
+
+    std::shared_ptr<PhiloxRngParams> params;
+};
+
+TEST_F(PhiloxRngEngineTest, known_answer)
+{
+    using Block = PhiloxRngEngine::Block;
+
+    // Reference values from the Random123 known-answer tests
+    auto result = PhiloxRngEngine::philox({0, 0, 0, 0}, {0, 0});
+    EXPECT_VEC_EQ(
+        (VecUint{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}),
+        (VecUint{result.begin(), result.end()}));
+
+    result = PhiloxRngEngine::philox(
+        {0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu},
+        {0xffffffffu, 0xffffffffu});
+    EXPECT_VEC_EQ(
+        (VecUint{0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu}),
+        (VecUint{result.begin(), result.end()}));
+
+    result = PhiloxRngEngine::philox(
+        Block{0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u},
+        {0xa4093822u, 0x299f31d0u});
+    EXPECT_VEC_EQ(
+        (VecUint{0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}),
+        (VecUint{result.begin(), result.end()}));
+}
+
+TEST_F(PhiloxRngEngineTest, slot_independence)
+{
+    HostStore states(params->host_ref(), 8);
+
+    // Initial per-slot streams differ
+    EXPECT_NE(draw(states, ThreadId{0}, 6), draw(states, ThreadId{1}, 6));
+
+    // The same track and step give the same values in any slot
+    PhiloxRngInitializer init;
+    init.event_id = 3;
+    init.lineage  = 10;
+    init.step     = 2;
+    PhiloxRngEngine(states.ref(), ThreadId{1}) = init;
+    PhiloxRngEngine(states.ref(), ThreadId{6}) = init;
+    VecUint expected = draw(states, ThreadId{1}, 9);
+    EXPECT_EQ(expected, draw(states, ThreadId{6}, 9));
+
+    // Values continue across blocks and restart when reinitialized
+    PhiloxRngEngine(states.ref(), ThreadId{6}) = init;
+    EXPECT_EQ(expected, draw(states, ThreadId{6}, 9));
+
+    // Different steps and events give different values
+    for (auto modify :
+         {&PhiloxRngInitializer::event_id, &PhiloxRngInitializer::step})
+    {
+        PhiloxRngInitializer other = init;
+        ++(other.*modify);
+        PhiloxRngEngine(states.ref(), ThreadId{2}) = other;
+        EXPECT_NE(expected, draw(states, ThreadId{2}, 9));
+    }
+
+    // Both halves of the lineage select the stream
+    for (ull_int delta : {1ull, 1ull << 32})
+    {
+        PhiloxRngInitializer other = init;
+        other.lineage += delta;
+        PhiloxRngEngine(states.ref(), ThreadId{2}) = other;
+        EXPECT_NE(expected, draw(states, ThreadId{2}, 9));
+    }
+
+    // The seed changes all streams
+    PhiloxRngParams other_params(54321);
+    HostStore       other_states(other_params.host_ref(), 2);
+    PhiloxRngEngine(other_states.ref(), ThreadId{0}) = init;
+    EXPECT_NE(expected, draw(other_states, ThreadId{0}, 9));
+}
+
+TEST_F(PhiloxRngEngineTest, moments)
+{
+    unsigned int num_samples = 1 << 12;
+    unsigned int num_seeds   = 1 << 8;
+
+    HostStore states(params->host_ref(), num_seeds);
+    RngTally  tally;
+
+    for (unsigned int i = 0; i < num_seeds; ++i)
+    {
+        PhiloxRngEngine      rng(states.ref(), ThreadId{i});
+        PhiloxRngInitializer init;
+        init.lineage = i;
+        rng          = init;
+        for (unsigned int j = 0; j < num_samples; ++j)
+        {
+            tally(generate_canonical(rng));
+        }
+    }
+    tally.check(num_samples * num_seeds, 1e-3);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
@@ -16,6 +16,7 @@
 #include "celeritas/SimpleTestBase.hh"
 #include "celeritas/global/CoreParams.hh"
 #include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/phys/PhysicsStepView.hh"
 #include "celeritas/track/TrackInitParams.hh"
 #include "celeritas/track/TrackInitUtils.hh"
 
@@ -345,6 +346,137 @@ TEST_F(TrackInitSecondaryTest, secondaries)
     }
 }
 
+//---------------------------------------------------------------------------//
+
+class TrackInitSpillTest : public SimpleTestBase
+{
+  protected:
+    using VecId = std::vector<unsigned int>;
+
+    //! Store only a few pending track initializers in the state
+    SPConstTrackInit build_init() override
+    {
+        TrackInitParams::Input input;
+        input.capacity   = 4;
+        input.max_events = 1;
+        return std::make_shared<TrackInitParams>(input);
+    }
+
+    //! Create host states and initializers from primaries
+    void build(size_type num_tracks, size_type num_primaries)
+    {
+        resize(&host_states, this->core()->host_ref(), num_tracks);
+        core_data.params = this->core()->host_ref();
+        core_data.states = host_states;
+
+        std::vector<Primary> primaries(num_primaries);
+        for (auto i : range(num_primaries))
+        {
+            Primary& p    = primaries[i];
+            p.particle_id = ParticleId{0};
+            p.energy      = units::MevEnergy{1};
+            p.position    = {0, 0, 0};
+            p.direction   = {0, 0, 1};
+            p.time        = 0;
+            p.event_id    = EventId{0};
+            p.track_id    = TrackId{i};
+        }
+        extend_from_primaries(core_data, make_span(primaries), &spill);
+    }
+
+    //! Kill all tracks without secondaries and find the vacancies
+    void kill_tracks()
+    {
+        for (auto tid : range(ThreadId{host_states.size()}))
+        {
+            core_data.states.sim.state[tid].status = TrackStatus::killed;
+            PhysicsStepView step(
+                core_data.params.physics, core_data.states.physics, tid);
+            step.secondaries({});
+        }
+        extend_from_secondaries(core_data, &spill);
+    }
+
+    //! Track IDs in each track slot
+    VecId track_ids()
+    {
+        VecId result;
+        for (auto tid : range(ThreadId{host_states.size()}))
+        {
+            result.push_back(
+                core_data.states.sim.state[tid].track_id.unchecked_get());
+        }
+        return result;
+    }
+
+    //! Track IDs of initializers in the state followed by the spill buffer
+    VecId init_ids()
+    {
+        VecId result;
+        for (const auto& init : spill)
+        {
+            result.push_back(init.sim.track_id.get());
+        }
+        for (const auto& init : core_data.states.init.initializers.data())
+        {
+            result.push_back(init.sim.track_id.get());
+        }
+        return result;
+    }
+
+    CoreStateData<Ownership::value, MemSpace::host> host_states;
+    CoreHostRef                                     core_data;
+    TrackInitSpill                                  spill;
+};
+
+TEST_F(TrackInitSpillTest, few_tracks)
+{
+    this->build(3, 10);
+
+    // The oldest initializers are spilled
+    EXPECT_EQ(6, spill.size());
+    EXPECT_EQ(4, core_data.states.init.initializers.size());
+    EXPECT_VEC_EQ((VecId{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}), this->init_ids());
+
+    // Tracks are initialized in the same order as without spilling
+    initialize_tracks(core_data, &spill);
+    EXPECT_VEC_EQ((VecId{7, 8, 9}), this->track_ids());
+    EXPECT_EQ(6, spill.size());
+
+    this->kill_tracks();
+    initialize_tracks(core_data, &spill);
+    EXPECT_VEC_EQ((VecId{4, 5, 6}), this->track_ids());
+    EXPECT_VEC_EQ((VecId{0, 1, 2, 3}), this->init_ids());
+    EXPECT_EQ(3, spill.size());
+
+    this->kill_tracks();
+    initialize_tracks(core_data, &spill);
+    EXPECT_VEC_EQ((VecId{1, 2, 3}), this->track_ids());
+    EXPECT_EQ(0, spill.size());
+
+    this->kill_tracks();
+    initialize_tracks(core_data, &spill);
+    EXPECT_VEC_EQ((VecId{1, 2, 0}), this->track_ids());
+    EXPECT_EQ(0, core_data.states.init.initializers.size());
+    EXPECT_EQ(2, core_data.states.init.vacancies.size());
+}
+
+TEST_F(TrackInitSpillTest, many_tracks)
+{
+    this->build(8, 10);
+
+    // Spilled initializers are returned in batches to fill all the slots
+    initialize_tracks(core_data, &spill);
+    EXPECT_VEC_EQ((VecId{2, 3, 4, 5, 6, 7, 8, 9}), this->track_ids());
+    EXPECT_VEC_EQ((VecId{0, 1}), this->init_ids());
+    EXPECT_EQ(0, core_data.states.init.vacancies.size());
+
+    // Without a spill buffer, overflowing the capacity is an error
+    std::vector<Primary> primaries(5);
+    EXPECT_THROW(extend_from_primaries(core_data, make_span(primaries)),
+                 RuntimeError);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace test
 } // namespace celeritas
@@ -0,0 +1,190 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/TrackInitAlgorithms.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/track/detail/TrackInitAlgorithms.hh"
+
+#include <algorithm>
+#include <iomanip>
+#include <random>
+#include <vector>
+
+#include "corecel/cont/Span.hh"
+#include "corecel/sys/Stopwatch.hh"
+#include "celeritas/global/StepScratchArena.hh"
+#include "celeritas/track/detail/Utils.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class TrackInitAlgorithmsTest : public Test
+{
+  protected:
+    using VecSize = std::vector<size_type>;
+    using Arena   = StepScratchArena<MemSpace::host>;
+
+    //! Create vacancies with about a quarter of slots still alive
+    VecSize make_vacancies(size_type size)
+    {
+        std::bernoulli_distribution is_alive(0.25);
+        VecSize                     result(size);
+        for (auto i : range(size))
+        {
+            result[i] = is_alive(rng_) ? detail::occupied() : i;
+        }
+        return result;
+    }
+
+    //! Create secondary counts between 0 and 3
+    VecSize make_counts(size_type size)
+    {
+        std::uniform_int_distribution<size_type> sample_count(0, 3);
+        VecSize                                  result(size);
+        for (auto& c : result)
+        {
+            c = sample_count(rng_);
+        }
+        return result;
+    }
+
+    //! Serial reference implementation for compaction
+    static size_type serial_remove_if_alive(VecSize* vacancies)
+    {
+        auto end = std::remove(
+            vacancies->begin(), vacancies->end(), detail::occupied());
+        return end - vacancies->begin();
+    }
+
+    //! Serial reference implementation for scan
+    static size_type serial_exclusive_scan(VecSize* counts)
+    {
+        size_type acc = 0;
+        for (auto& c : *counts)
+        {
+            size_type current = c;
+            c                 = acc;
+            acc += current;
+        }
+        return acc;
+    }
+
+    std::mt19937 rng_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(TrackInitAlgorithmsTest, remove_if_alive)
+{
+    Arena arena;
+    for (size_type size : {0u, 1u, 1000u, 65536u, 100003u})
+    {
+        for (Arena* scratch : {static_cast<Arena*>(nullptr), &arena})
+        {
+            VecSize expected = this->make_vacancies(size);
+            VecSize actual   = expected;
+
+            size_type expected_size = serial_remove_if_alive(&expected);
+            size_type actual_size   = detail::remove_if_alive<MemSpace::host>(
+                make_span(actual), scratch);
+            ASSERT_EQ(expected_size, actual_size) << "size=" << size;
+            expected.resize(expected_size);
+            actual.resize(actual_size);
+            EXPECT_EQ(expected, actual) << "size=" << size;
+            arena.reset();
+        }
+    }
+}
+
+TEST_F(TrackInitAlgorithmsTest, exclusive_scan_counts)
+{
+    Arena arena;
+    for (size_type size : {0u, 1u, 1000u, 65536u, 100003u})
+    {
+        for (Arena* scratch : {static_cast<Arena*>(nullptr), &arena})
+        {
+            VecSize expected = this->make_counts(size);
+            VecSize actual   = expected;
+
+            size_type expected_sum = serial_exclusive_scan(&expected);
+            size_type actual_sum
+                = detail::exclusive_scan_counts<MemSpace::host>(
+                    make_span(actual), scratch);
+            EXPECT_EQ(expected_sum, actual_sum) << "size=" << size;
+            EXPECT_EQ(expected, actual) << "size=" << size;
+            arena.reset();
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compare parallel and serial performance across state sizes.
+ *
+ * Run with \c --gtest_also_run_disabled_tests and set \c OMP_NUM_THREADS to
+ * the number of cores to test.
+ */
+TEST_F(TrackInitAlgorithmsTest, DISABLED_benchmark)
+{
+    constexpr int num_repeats = 20;
+
+    Arena arena;
+    cout << std::setw(10) << "size" << std::setw(14) << "remove serial"
+         << std::setw(14) << "remove par" << std::setw(14) << "scan serial"
+         << std::setw(14) << "scan par" << " (ms)" << std::endl;
+    for (size_type size = 1024; size <= (1u << 22); size *= 4)
+    {
+        const VecSize vacancies = this->make_vacancies(size);
+        const VecSize counts    = this->make_counts(size);
+        double        time[4]   = {0, 0, 0, 0};
+
+        for (int i = 0; i < num_repeats; ++i)
+        {
+            VecSize temp = vacancies;
+            Stopwatch get_time;
+            serial_remove_if_alive(&temp);
+            time[0] += get_time();
+
+            temp     = vacancies;
+            get_time = Stopwatch{};
+            detail::remove_if_alive<MemSpace::host>(make_span(temp), &arena);
+            time[1] += get_time();
+
+            temp     = counts;
+            get_time = Stopwatch{};
+            serial_exclusive_scan(&temp);
+            time[2] += get_time();
+
+            temp     = counts;
+            get_time = Stopwatch{};
+            detail::exclusive_scan_counts<MemSpace::host>(make_span(temp),
+                                                          &arena);
+            time[3] += get_time();
+
+            arena.reset();
+        }
+
+        cout << std::setw(10) << size;
+        for (double t : time)
+        {
+            cout << std::setw(14) << std::setprecision(4)
+                 << 1000 * t / num_repeats;
+        }
+        cout << std::endl;
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
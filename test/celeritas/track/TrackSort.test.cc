@@ -0,0 +1,128 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/TrackSort.test.cc
+//---------------------------------------------------------------------------//
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionStateStore.hh"
+#include "celeritas/track/SimData.hh"
+#include "celeritas/track/TrackSortData.hh"
+#include "celeritas/track/detail/TrackSortAlgorithms.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class TrackSortTest : public Test
+{
+  protected:
+    //! Create states with the given post-step actions
+    void build_states(const std::vector<ActionId>& actions,
+                      ActionId::size_type          num_actions)
+    {
+        HostVal<SimStateData> sim;
+        resize(&sim, actions.size());
+        for (auto i : range(actions.size()))
+        {
+            sim.state[ThreadId(i)].step_limit.action = actions[i];
+        }
+        sim_ = CollectionStateStore<SimStateData, MemSpace::host>(
+            std::move(sim));
+
+        HostVal<TrackSortStateData> sort;
+        resize(&sort, num_actions, actions.size());
+        sort_ = CollectionStateStore<TrackSortStateData, MemSpace::host>(
+            std::move(sort));
+    }
+
+    //! Get the track slots for an action
+    std::vector<size_type> slots(ActionId action) const
+    {
+        std::vector<size_type> result;
+        for (ThreadId t : sort_.ref().action_threads(action))
+        {
+            result.push_back(sort_.ref().track_slots[t].get());
+        }
+        return result;
+    }
+
+    CollectionStateStore<SimStateData, MemSpace::host>       sim_;
+    CollectionStateStore<TrackSortStateData, MemSpace::host> sort_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(TrackSortTest, unsorted)
+{
+    this->build_states({ActionId{1}, ActionId{0}}, 3);
+
+    // Before sorting, all ranges are empty and slots are in order
+    for (auto aid : range(ActionId{3}))
+    {
+        EXPECT_TRUE(sort_.ref().action_threads(aid).empty());
+    }
+    EXPECT_EQ(ThreadId{1}, sort_.ref().track_slots[ThreadId{1}]);
+}
+
+TEST_F(TrackSortTest, host)
+{
+    const ActionId         a{0}, b{1}, c{2}, d{3}, unset{};
+    std::vector<ActionId>  actions = {c, a, unset, c, b, a, ActionId{10}, c};
+    for (auto i : range(1000))
+    {
+        // Add a lot more tracks so that multiple chunks are used
+        actions.push_back(ActionId(i % 3));
+    }
+    this->build_states(actions, 4);
+
+    detail::sort_by_action(sim_.ref(), sort_.ref());
+
+    // Sort is stable, so slots are in increasing order
+    auto a_slots = this->slots(a);
+    auto b_slots = this->slots(b);
+    auto c_slots = this->slots(c);
+    ASSERT_EQ(2 + 334, a_slots.size());
+    EXPECT_EQ(1, a_slots[0]);
+    EXPECT_EQ(5, a_slots[1]);
+    EXPECT_EQ(8, a_slots[2]);
+    EXPECT_EQ(11, a_slots[3]);
+    ASSERT_EQ(1 + 333, b_slots.size());
+    EXPECT_EQ(4, b_slots[0]);
+    EXPECT_EQ(9, b_slots[1]);
+    ASSERT_EQ(3 + 333, c_slots.size());
+    EXPECT_EQ(0, c_slots[0]);
+    EXPECT_EQ(3, c_slots[1]);
+    EXPECT_EQ(7, c_slots[2]);
+    EXPECT_EQ(10, c_slots[3]);
+    EXPECT_TRUE(this->slots(d).empty());
+
+    // Every slot must appear exactly once
+    std::vector<int> found(actions.size(), 0);
+    for (ThreadId t : range(ThreadId{sort_.size()}))
+    {
+        ++found[sort_.ref().track_slots[t].get()];
+    }
+    EXPECT_EQ(std::vector<int>(actions.size(), 1), found);
+
+    // Re-sorting after changing an action should update the ranges
+    sim_.ref().state[ThreadId{2}].step_limit.action = d;
+    detail::sort_by_action(sim_.ref(), sort_.ref());
+    EXPECT_EQ(std::vector<size_type>{2}, this->slots(d));
+    EXPECT_EQ(c_slots, this->slots(c));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
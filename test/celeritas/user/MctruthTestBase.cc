@@ -78,8 +78,9 @@ auto MctruthTestBase::run(size_type num_tracks, size_type num_steps)
     -> RunResult
 {
     StepperInput step_inp;
-    step_inp.params          = this->core();
-    step_inp.num_track_slots = num_tracks;
+    step_inp.params           = this->core();
+    step_inp.num_track_slots  = num_tracks;
+    step_inp.fused_chunk_size = fused_chunk_size_;
 
     Stepper<MemSpace::host> step(step_inp);
 
@@ -14,6 +14,7 @@
 #include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/phys/ParticleParams.hh"
 #include "celeritas/phys/Primary.hh"
+#include "celeritas/track/TrackInitParams.hh"
 
 #include "../SimpleTestBase.hh"
 #include "../TestEm15Base.hh"
@@ -67,6 +68,18 @@ class KnCaloTest : public KnStepCollectorTestBase, public CaloTestBase
     VecString get_detector_names() const final { return {"inner"}; }
 };
 
+class KnSpillCaloTest : public KnCaloTest
+{
+    //! Store only a single pending track initializer in the state
+    SPConstTrackInit build_init() override
+    {
+        TrackInitParams::Input input;
+        input.capacity   = 1;
+        input.max_events = 4096;
+        return std::make_shared<TrackInitParams>(input);
+    }
+};
+
 //---------------------------------------------------------------------------//
 
 class TestEm3CollectorTestBase : public TestEm3Base,
@@ -218,6 +231,22 @@ TEST_F(KnMctruthTest, two_step)
     // clang-format on
 }
 
+TEST_F(KnMctruthTest, two_step_fused)
+{
+    // Fusing host actions gives identical steps
+    fused_chunk_size_ = 3;
+    auto result       = this->run(4, 2);
+
+    // clang-format off
+    static const int expected_step[] = {1, 2, 1, 2, 1, 2, 1, 2};
+    EXPECT_VEC_EQ(expected_step, result.step);
+    static const double expected_pos[] = {0, 0, 0, 2.6999255778482, 0, 0, 0, 0, 0, 3.5717683161497, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 5, 0, 0};
+    EXPECT_VEC_SOFT_EQ(expected_pos, result.pos);
+    static const double expected_dir[] = {1, 0, 0, 0.45619379667222, 0.14402721708137, -0.87814769863479, 1, 0, 0, 0.8985574206844, -0.27508545475671, -0.34193940152356, 1, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0};
+    EXPECT_VEC_SOFT_EQ(expected_dir, result.dir);
+    // clang-format on
+}
+
 TEST_F(KnCaloTest, single_event)
 {
     auto result = this->run(1, 64);
@@ -226,6 +255,15 @@ TEST_F(KnCaloTest, single_event)
     EXPECT_VEC_SOFT_EQ(expected_edep, result.edep);
 }
 
+TEST_F(KnSpillCaloTest, single_event)
+{
+    // Secondaries spilled to host are transported in the same order
+    auto result = this->run(1, 64);
+
+    static const double expected_edep[] = {0.00043564799352598};
+    EXPECT_VEC_SOFT_EQ(expected_edep, result.edep);
+}
+
 //---------------------------------------------------------------------------//
 // TESTEM3
 //---------------------------------------------------------------------------//
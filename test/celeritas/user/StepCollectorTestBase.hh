@@ -25,6 +25,10 @@ class StepCollectorTestBase : virtual public GlobalTestBase
 
   public:
     virtual VecPrimary make_primaries(size_type count) = 0;
+
+  protected:
+    //! Track slots per fused host action chunk (zero for unfused)
+    size_type fused_chunk_size_{0};
 };
 
 //---------------------------------------------------------------------------//
@@ -8,8 +8,12 @@
 #include "corecel/data/StackAllocator.hh"
 
 #include <cstdint>
+#include <numeric>
+#include <vector>
 
+#include "corecel/cont/Range.hh"
 #include "corecel/data/CollectionStateStore.hh"
+#include "corecel/sys/ThreadPool.hh"
 
 #include "StackAllocator.test.hh"
 #include "celeritas_test.hh"
@@ -75,12 +79,94 @@ TEST_F(StackAllocatorTest, host)
     ptr = alloc(9);
     EXPECT_EQ(nullptr, ptr);
     EXPECT_EQ(8, alloc.get().size());
+    EXPECT_EQ(9, alloc.overflow());
 
     // Ask for an amount that barely fits
     ptr = alloc(8);
     ASSERT_NE(nullptr, ptr);
     EXPECT_EQ(16, alloc.get().size());
     EXPECT_EQ(16, const_cast<const Allocator&>(alloc).get().size());
+
+    // Failed requests accumulate until cleared
+    EXPECT_EQ(nullptr, alloc(1));
+    EXPECT_EQ(10, alloc.overflow());
+    alloc.clear();
+    EXPECT_EQ(0, alloc.size());
+    EXPECT_EQ(0, alloc.overflow());
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(StackAllocatorTest, host_thread_pool)
+{
+    // Pool threads allocate concurrently whether or not OpenMP is enabled
+    using StateStore = CollectionStateStore<MockAllocatorData, MemSpace::host>;
+    StateStore data(1 << 18);
+    Allocator  alloc(data.ref());
+    ThreadPool pool({8, 16});
+
+    // Allocate batches of one to three items without filling the stack
+    {
+        const size_type  num_requests = 100000;
+        std::vector<int> allocated(num_requests, 0);
+        pool.parallel_for(num_requests, [&](size_type i) {
+            size_type count = 1 + i % 3;
+            if (MockSecondary* ptr = alloc(count))
+            {
+                for (auto j : range(count))
+                {
+                    ptr[j].mock_id = static_cast<int>(i);
+                }
+                allocated[i] = count;
+            }
+        });
+
+        size_type expected = 0;
+        for (auto i : range(num_requests))
+        {
+            expected += 1 + i % 3;
+        }
+        EXPECT_EQ(expected,
+                  std::accumulate(allocated.begin(), allocated.end(), 0u));
+        EXPECT_EQ(expected, alloc.size());
+        EXPECT_EQ(0, alloc.overflow());
+
+        // Every item belongs to exactly one request
+        std::vector<int> num_items(num_requests, 0);
+        for (const MockSecondary& sec : alloc.get())
+        {
+            ASSERT_GE(sec.mock_id, 0);
+            ++num_items[sec.mock_id];
+        }
+        EXPECT_EQ(allocated, num_items);
+    }
+
+    // Overfill the stack with single items
+    {
+        alloc.clear();
+        const size_type  num_requests = alloc.capacity() + 10000;
+        std::vector<int> allocated(num_requests, 0);
+        pool.parallel_for(num_requests, [&](size_type i) {
+            if (MockSecondary* ptr = alloc(1))
+            {
+                ptr->mock_id = static_cast<int>(i);
+                allocated[i] = 1;
+            }
+        });
+
+        EXPECT_EQ(alloc.capacity(),
+                  std::accumulate(allocated.begin(), allocated.end(), 0u));
+        EXPECT_EQ(alloc.capacity(), alloc.size());
+        EXPECT_EQ(10000, alloc.overflow());
+
+        std::vector<int> num_items(num_requests, 0);
+        for (const MockSecondary& sec : alloc.get())
+        {
+            ASSERT_GE(sec.mock_id, 0);
+            ++num_items[sec.mock_id];
+        }
+        EXPECT_EQ(allocated, num_items);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,114 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/Stream.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/sys/Stream.hh"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "corecel/data/DeviceVector.hh"
+#include "corecel/data/PinnedAllocator.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+TEST(StreamTest, empty)
+{
+    Stream stream;
+    EXPECT_FALSE(stream);
+
+    Stream other(MemSpace::host);
+    EXPECT_TRUE(other);
+    stream = std::move(other);
+    EXPECT_TRUE(stream);
+    EXPECT_EQ(MemSpace::host, stream.memspace());
+}
+
+TEST(StreamTest, host)
+{
+    std::vector<int> src(100000);
+    std::iota(src.begin(), src.end(), 0);
+    std::vector<int> mid(src.size());
+    std::vector<int> dst(src.size() + 1, -1);
+
+    Stream stream(MemSpace::host);
+
+    // Copies are executed in order
+    stream.copy_async(make_span(mid), Span<const int>{make_span(src)});
+    stream.copy_async(make_span(dst).subspan(1, mid.size()),
+                      Span<const int>{make_span(mid)});
+    stream.sync();
+    EXPECT_EQ(-1, dst.front());
+    EXPECT_EQ(0, dst[1]);
+    EXPECT_EQ(99999, dst.back());
+
+    // Sync without pending work is a null-op
+    stream.sync();
+
+    // Fencing on host waits for the pending work
+    std::fill(mid.begin(), mid.end(), -1);
+    stream.copy_async(make_span(mid), Span<const int>{make_span(src)});
+    stream.fence();
+    EXPECT_EQ(99999, mid.back());
+
+    // Unsynchronized work is finished before destruction
+    {
+        Stream temp(MemSpace::host);
+        temp.copy_async(make_span(mid).subspan(0, 10),
+                        Span<const int>{make_span(src)}.subspan(10, 10));
+    }
+    EXPECT_EQ(10, mid[0]);
+    EXPECT_EQ(19, mid[9]);
+    EXPECT_EQ(10, mid[10]);
+}
+
+TEST(StreamTest, pinned)
+{
+    std::vector<double, PinnedAllocator<double>> pinned(64, 2.0);
+    std::vector<double>                          dst(pinned.size());
+
+    Stream stream(MemSpace::host);
+    stream.copy_async(make_span(dst), Span<const double>{make_span(pinned)});
+    stream.sync();
+    EXPECT_EQ(2.0, dst.back());
+}
+
+TEST(StreamTest, TEST_IF_CELER_DEVICE(device))
+{
+    std::vector<int, PinnedAllocator<int>> src(1024);
+    std::iota(src.begin(), src.end(), 0);
+    DeviceVector<int> device_vec(src.size());
+    std::vector<int>  dst(src.size());
+
+    Stream stream(MemSpace::device);
+    stream.copy_async(device_vec.device_ref(),
+                      Span<const int>{make_span(src)});
+    stream.copy_async(make_span(dst),
+                      Span<const int>{device_vec.device_ref()});
+    stream.sync();
+    EXPECT_EQ(0, dst.front());
+    EXPECT_EQ(1023, dst.back());
+
+    // Work on the default stream is ordered after the fence
+    std::fill(src.begin(), src.end(), 3);
+    stream.copy_async(device_vec.device_ref(),
+                      Span<const int>{make_span(src)});
+    stream.fence();
+    device_vec.copy_to_host(make_span(dst));
+    EXPECT_EQ(3, dst.front());
+    EXPECT_EQ(3, dst.back());
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
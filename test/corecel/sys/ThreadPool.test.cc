@@ -0,0 +1,144 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/ThreadPool.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/sys/ThreadPool.hh"
+
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/sys/Stopwatch.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+//! Count how many times each index is visited
+std::vector<int>
+count_visits(ThreadPool& pool, size_type size, size_type grain)
+{
+    std::vector<std::atomic<int>> visits(size);
+    pool.parallel_for(size, grain, [&visits](size_type i) { ++visits[i]; });
+
+    std::vector<int> result(size);
+    for (auto i : range(size))
+    {
+        result[i] = visits[i].load();
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(ThreadPoolTest, serial)
+{
+    ThreadPool pool({1, 4});
+    EXPECT_EQ(1, pool.num_threads());
+    EXPECT_EQ(4, pool.grain_size());
+
+    // Indices are visited in order on the calling thread
+    std::vector<size_type> visited;
+    pool.parallel_for(10, [&visited](size_type i) { visited.push_back(i); });
+    EXPECT_EQ((std::vector<size_type>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}), visited);
+}
+
+TEST(ThreadPoolTest, coverage)
+{
+    ThreadPool pool({4, 16});
+    EXPECT_EQ(4, pool.num_threads());
+
+    // Every index is visited exactly once for a variety of sizes and grains,
+    // including more threads than chunks and uneven final chunks
+    for (size_type size : {0u, 1u, 3u, 16u, 17u, 100u, 1000u, 65537u})
+    {
+        for (size_type grain : {1u, 7u, 16u, 256u})
+        {
+            EXPECT_EQ(std::vector<int>(size, 1),
+                      count_visits(pool, size, grain))
+                << "size=" << size << ", grain=" << grain;
+        }
+    }
+
+    // Default grain size
+    std::atomic<size_type> total{0};
+    pool.parallel_for(1000, [&total](size_type i) { total += i; });
+    EXPECT_EQ(1000 * 999 / 2, total.load());
+}
+
+TEST(ThreadPoolTest, exception)
+{
+    ThreadPool pool({3, 8});
+
+    std::atomic<size_type> count{0};
+    auto                   throw_some = [&count](size_type i) {
+        ++count;
+        if (i % 100 == 5)
+        {
+            throw std::runtime_error("failed");
+        }
+    };
+    EXPECT_THROW(pool.parallel_for(1000, throw_some), std::runtime_error);
+
+    // All other chunks were still processed, and the pool is still usable
+    EXPECT_LE(1000 - 10 * 8, count.load());
+    EXPECT_EQ(std::vector<int>(500, 1), count_visits(pool, 500, 8));
+}
+
+TEST(ThreadPoolTest, DISABLED_benchmark)
+{
+    // Measure the per-loop cost of many short parallel loops compared to a
+    // serial loop
+    const size_type     num_loops = 1000;
+    std::vector<double> data(65536, 1.0);
+    auto                update = [&data](size_type i) {
+        data[i] = data[i] * 0.5 + 1.0;
+    };
+
+    Stopwatch get_serial_time;
+    for (size_type loop = 0; loop < num_loops; ++loop)
+    {
+        for (auto i : range(data.size()))
+        {
+            update(i);
+        }
+    }
+    double serial_time = get_serial_time();
+    cout << "serial: " << serial_time * 1e6 / num_loops << " us/loop"
+         << std::endl;
+
+    cout << std::setw(10) << "threads" << std::setw(10) << "grain"
+         << std::setw(14) << "pool [us]" << std::endl;
+    for (size_type num_threads : {1u, 2u, 4u, 8u})
+    {
+        ThreadPool pool({num_threads, 1});
+        for (size_type grain : {64u, 256u, 1024u, 4096u})
+        {
+            Stopwatch get_time;
+            for (size_type loop = 0; loop < num_loops; ++loop)
+            {
+                pool.parallel_for(data.size(), grain, update);
+            }
+            cout << std::setw(10) << num_threads << std::setw(10) << grain
+                 << std::setw(14) << get_time() * 1e6 / num_loops
+                 << std::endl;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
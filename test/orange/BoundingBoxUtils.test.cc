@@ -0,0 +1,80 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/BoundingBoxUtils.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/BoundingBoxUtils.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+using BoundingBoxUtilsTest = Test;
+
+TEST_F(BoundingBoxUtilsTest, is_inside)
+{
+    BoundingBox bb{{-1, -2, 3}, {4, 5, 6}};
+    EXPECT_TRUE(is_inside(bb, {0, 0, 4}));
+    EXPECT_TRUE(is_inside(bb, {-1, 5, 6}));
+    EXPECT_FALSE(is_inside(bb, {-1.5, 0, 4}));
+    EXPECT_FALSE(is_inside(bb, {0, 5.5, 4}));
+    EXPECT_FALSE(is_inside(bb, {0, 0, 2}));
+
+    EXPECT_TRUE(is_inside(BoundingBox::from_infinite(), {1e300, 0, -1e300}));
+}
+
+TEST_F(BoundingBoxUtilsTest, is_finite)
+{
+    EXPECT_TRUE(is_finite(BoundingBox{{-1, -2, 3}, {4, 5, 6}}));
+    EXPECT_FALSE(is_finite(BoundingBox::from_infinite()));
+    EXPECT_FALSE(is_finite(BoundingBox{{-1, -2, 3}, {4, inf, 6}}));
+}
+
+TEST_F(BoundingBoxUtilsTest, calc_center)
+{
+    EXPECT_VEC_SOFT_EQ((Real3{1.5, 1.5, 4.5}),
+                       calc_center(BoundingBox{{-1, -2, 3}, {4, 5, 6}}));
+}
+
+TEST_F(BoundingBoxUtilsTest, calc_union)
+{
+    BoundingBox a{{-1, -2, 3}, {4, 5, 6}};
+    BoundingBox b{{0, -3, 4}, {5, 4, 5}};
+
+    BoundingBox result = calc_union(a, b);
+    EXPECT_VEC_SOFT_EQ((Real3{-1, -3, 3}), result.lower());
+    EXPECT_VEC_SOFT_EQ((Real3{5, 5, 6}), result.upper());
+
+    // Null boxes are empty
+    result = calc_union(a, BoundingBox{});
+    EXPECT_VEC_SOFT_EQ(a.lower(), result.lower());
+    EXPECT_VEC_SOFT_EQ(a.upper(), result.upper());
+    EXPECT_FALSE(calc_union(BoundingBox{}, BoundingBox{}));
+}
+
+TEST_F(BoundingBoxUtilsTest, calc_intersection)
+{
+    BoundingBox a{{-1, -2, 3}, {4, 5, 6}};
+    BoundingBox b{{0, -3, 4}, {5, 4, 5}};
+
+    BoundingBox result = calc_intersection(a, b);
+    EXPECT_VEC_SOFT_EQ((Real3{0, -2, 4}), result.lower());
+    EXPECT_VEC_SOFT_EQ((Real3{4, 4, 5}), result.upper());
+
+    result = calc_intersection(a, BoundingBox::from_infinite());
+    EXPECT_VEC_SOFT_EQ(a.lower(), result.lower());
+    EXPECT_VEC_SOFT_EQ(a.upper(), result.upper());
+
+    // Disjoint and null boxes are empty
+    EXPECT_FALSE(calc_intersection(a, BoundingBox{{5, 0, 0}, {6, 1, 1}}));
+    EXPECT_FALSE(calc_intersection(a, BoundingBox{}));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
@@ -7,8 +7,15 @@
 //---------------------------------------------------------------------------//
 #include "orange/OrangeParams.hh"
 #include "orange/OrangeTrackView.hh"
+
+#include <random>
+#include <vector>
+
+#include "corecel/sys/Stopwatch.hh"
 #include "orange/construct/OrangeInput.hh"
 #include "celeritas/Constants.hh"
+#include "celeritas/random/distribution/IsotropicDistribution.hh"
+#include "celeritas/random/distribution/UniformBoxDistribution.hh"
 
 #include "OrangeGeoTestBase.hh"
 #include "celeritas_test.hh"
@@ -38,6 +45,78 @@ class OrangeTest : public OrangeGeoTestBase
             this->params().host_ref(), host_state_.ref(), ThreadId{0});
     }
 
+    //! Volumes and distances along a track until it leaves the geometry
+    struct TrackResult
+    {
+        std::vector<std::string> volumes;
+        std::vector<real_type>   distances;
+    };
+
+    //! Track until exiting the geometry
+    TrackResult track(const Initializer_t& init)
+    {
+        TrackResult     result;
+        OrangeTrackView geo = this->make_track_view();
+        geo                 = init;
+        while (!geo.is_outside())
+        {
+            result.volumes.push_back(
+                this->params().id_to_label(geo.volume_id()).name);
+            auto next = geo.find_next_step();
+            CELER_ASSERT(next.boundary);
+            result.distances.push_back(next.distance);
+            geo.move_to_boundary();
+            geo.cross_boundary();
+        }
+        return result;
+    }
+
+    //! Time the transport of random tracks through the geometry
+    void run_benchmark(size_type num_tracks)
+    {
+        std::mt19937             rng;
+        const BoundingBox&       bbox = this->params().bbox();
+        UniformBoxDistribution<> sample_pos{bbox.lower(), bbox.upper()};
+        IsotropicDistribution<>  sample_dir;
+        OrangeTrackView          geo       = this->make_track_view();
+        size_type                num_steps = 0;
+
+        Stopwatch get_time;
+        for (size_type i = 0; i < num_tracks; ++i)
+        {
+            geo = Initializer_t{sample_pos(rng), sample_dir(rng)};
+            while (!geo.is_outside())
+            {
+                geo.find_next_step();
+                geo.move_to_boundary();
+                geo.cross_boundary();
+                ++num_steps;
+            }
+        }
+        double time = get_time();
+
+        cout << "Transport time per track: " << time * 1e6 / num_tracks
+             << " us (" << real_type(num_steps) / num_tracks
+             << " crossings per track)" << std::endl;
+    }
+
+    //! Next step hits and misses, then safety hits and misses
+    std::vector<size_type> cache_counters() const
+    {
+        const auto& state = host_state_.ref();
+        ThreadId    tid{0};
+        return {state.next_step_hits[tid],
+                state.next_step_misses[tid],
+                state.safety_hits[tid],
+                state.safety_misses[tid]};
+    }
+
+    //! Number of volumes tested while initializing and crossing
+    size_type volumes_tested() const
+    {
+        return host_state_.ref().volumes_tested[ThreadId{0}];
+    }
+
   private:
     using HostStateStore
         = CollectionStateStore<OrangeStateData, MemSpace::host>;
@@ -75,6 +154,18 @@ class UniversesTest : public OrangeTest
     void SetUp() override { this->build_geometry("universes.org.json"); }
 };
 
+#define UniversesFlatTest TEST_IF_CELERITAS_JSON(UniversesFlatTest)
+class UniversesFlatTest : public OrangeTest
+{
+    void SetUp() override { this->build_geometry("universes-flat.org.json"); }
+};
+
+#define RectArrayTest TEST_IF_CELERITAS_JSON(RectArrayTest)
+class RectArrayTest : public OrangeTest
+{
+    void SetUp() override { this->build_geometry("rect-array.org.json"); }
+};
+
 #define Geant4Testem15Test TEST_IF_CELERITAS_JSON(Geant4Testem15Test)
 class Geant4Testem15Test : public OrangeTest
 {
@@ -499,6 +590,72 @@ TEST_F(TwoVolumeTest, intersect_limited)
     EXPECT_FALSE(next.boundary);
 }
 
+TEST_F(TwoVolumeTest, cache)
+{
+    {
+        auto geo = this->make_track_view();
+        geo      = Initializer_t{{0, 0, 0}, {1, 0, 0}};
+        auto next = geo.find_next_step();
+        EXPECT_SOFT_EQ(1.5, next.distance);
+        geo.move_internal(0.5);
+    }
+    EXPECT_VEC_EQ((std::vector<size_type>{0, 1, 0, 0}),
+                  this->cache_counters());
+    {
+        // A new view reuses the distance and then the safety sphere
+        auto geo  = this->make_track_view();
+        auto next = geo.find_next_step();
+        EXPECT_SOFT_EQ(1.0, next.distance);
+        EXPECT_TRUE(next.boundary);
+        next = geo.find_next_step(0.25);
+        EXPECT_SOFT_EQ(0.25, next.distance);
+        EXPECT_FALSE(next.boundary);
+
+        EXPECT_SOFT_EQ(1.0, geo.find_safety());
+        geo.move_internal(0.25);
+        EXPECT_SOFT_EQ(0.75, geo.find_safety());
+    }
+    EXPECT_VEC_EQ((std::vector<size_type>{2, 1, 1, 1}),
+                  this->cache_counters());
+    {
+        // Changing direction invalidates the distance
+        auto geo = this->make_track_view();
+        geo.set_dir({0, 1, 0});
+        auto next = geo.find_next_step();
+        EXPECT_SOFT_EQ(1.299038105676658, next.distance);
+
+        // Moving too far from the sphere's center recalculates the safety
+        geo.move_internal(0.6);
+        EXPECT_SOFT_EQ(0.5395313643850727, geo.find_safety());
+    }
+    EXPECT_VEC_EQ((std::vector<size_type>{2, 2, 1, 2}),
+                  this->cache_counters());
+    {
+        // Reinitializing clears both
+        auto geo = this->make_track_view();
+        geo      = Initializer_t{{0.75, 0.6, 0}, {0, 1, 0}};
+        geo.find_safety();
+        geo.find_next_step();
+    }
+    EXPECT_VEC_EQ((std::vector<size_type>{2, 3, 1, 3}),
+                  this->cache_counters());
+}
+
+TEST_F(TwoVolumeTest, volumes_tested)
+{
+    auto geo = this->make_track_view();
+    geo      = Initializer_t{{0, 0, 0}, {1, 0, 0}};
+    EXPECT_EQ("inside", this->params().id_to_label(geo.volume_id()).name);
+    size_type num_init = this->volumes_tested();
+    EXPECT_LE(1, num_init);
+
+    geo.find_next_step();
+    geo.move_to_boundary();
+    geo.cross_boundary();
+    EXPECT_EQ("outside", this->params().id_to_label(geo.volume_id()).name);
+    EXPECT_LT(num_init, this->volumes_tested());
+}
+
 TEST_F(FiveVolumesTest, params)
 {
     const OrangeParams& geo = this->params();
@@ -514,6 +671,7 @@ TEST_F(UniversesTest, params)
     EXPECT_EQ(9, geo.num_volumes());
     EXPECT_EQ(21, geo.num_surfaces());
     EXPECT_FALSE(geo.supports_safety());
+    EXPECT_EQ(2, geo.host_ref().scalars.max_level);
 
     EXPECT_VEC_SOFT_EQ(Real3({-2, -6, -1}), geo.bbox().lower());
     EXPECT_VEC_SOFT_EQ(Real3({8, 4, 2}), geo.bbox().upper());
@@ -557,6 +715,174 @@ TEST_F(UniversesTest, initialize_with_multiple_universes)
     EXPECT_FALSE(geo.is_on_boundary());
 }
 
+TEST_F(UniversesTest, cross_universes)
+{
+    const OrangeParams& params = this->params();
+    auto                geo    = this->make_track_view();
+
+    // Start in the outer universe and head into the upper hole
+    geo = Initializer_t{{-1, -2, 1}, {1, 0, 0}};
+    EXPECT_EQ(0, geo.level());
+    auto next = geo.find_next_step();
+    EXPECT_SOFT_EQ(1.0, next.distance);
+    EXPECT_TRUE(next.boundary);
+    EXPECT_EQ("bob.mx", params.id_to_label(geo.next_surface_id()).name);
+    geo.move_to_boundary();
+    geo.cross_boundary();
+    EXPECT_VEC_SOFT_EQ(Real3({0, -2, 1}), geo.pos());
+    EXPECT_EQ("c", params.id_to_label(geo.volume_id()).name);
+    EXPECT_EQ("bob.mx", params.id_to_label(geo.surface_id()).name);
+    EXPECT_EQ(1, geo.level());
+
+    // Cross a surface in the daughter universe
+    next = geo.find_next_step();
+    EXPECT_SOFT_EQ(1.0, next.distance);
+    EXPECT_EQ("alpha.mx", params.id_to_label(geo.next_surface_id()).name);
+    geo.move_to_boundary();
+    geo.cross_boundary();
+    EXPECT_VEC_SOFT_EQ(Real3({1, -2, 1}), geo.pos());
+    EXPECT_EQ("a", params.id_to_label(geo.volume_id()).name);
+    EXPECT_EQ("alpha.mx", params.id_to_label(geo.surface_id()).name);
+    EXPECT_EQ(1, geo.level());
+
+    // Continue through the daughter and out the far side of the hole
+    auto result = this->track(Initializer_t{{1.5, -2, 1}, {1, 0, 0}});
+    static const char* const expected_volumes[] = {"a", "b", "c", "johnny"};
+    static const real_type expected_distances[] = {1.5, 2, 1, 2};
+    EXPECT_VEC_EQ(expected_volumes, result.volumes);
+    EXPECT_VEC_SOFT_EQ(expected_distances, result.distances);
+}
+
+TEST_F(UniversesTest, move_between_daughters)
+{
+    const OrangeParams& params = this->params();
+    auto                geo    = this->make_track_view();
+
+    // Start in 'a' in the lower hole
+    geo = Initializer_t{{2, -2, 0}, {0, 0, 1}};
+    EXPECT_EQ("a", params.id_to_label(geo.volume_id()).name);
+    EXPECT_EQ(1, geo.level());
+
+    // Safety is limited by the hole's z extents in the parent universe
+    EXPECT_SOFT_EQ(0.5, geo.find_safety());
+
+    // Move to a point nearer the upper hole
+    geo.move_internal({2.5, -2.5, 0.25});
+    EXPECT_EQ("a", params.id_to_label(geo.volume_id()).name);
+    EXPECT_SOFT_EQ(0.25, geo.find_safety());
+
+    // Cross from the lower into the upper hole
+    auto next = geo.find_next_step();
+    EXPECT_SOFT_EQ(0.25, next.distance);
+    EXPECT_EQ("inner_a.pz", params.id_to_label(geo.next_surface_id()).name);
+    geo.move_to_boundary();
+    geo.cross_boundary();
+    EXPECT_EQ("a", params.id_to_label(geo.volume_id()).name);
+    EXPECT_EQ("inner_a.pz", params.id_to_label(geo.surface_id()).name);
+    EXPECT_EQ(1, geo.level());
+
+    // Leave the upper hole into the outer volume
+    next = geo.find_next_step();
+    EXPECT_SOFT_EQ(1.0, next.distance);
+    EXPECT_EQ("bob.pz", params.id_to_label(geo.next_surface_id()).name);
+    geo.move_to_boundary();
+    geo.cross_boundary();
+    EXPECT_VEC_SOFT_EQ(Real3({2.5, -2.5, 1.5}), geo.pos());
+    EXPECT_EQ("johnny", params.id_to_label(geo.volume_id()).name);
+    EXPECT_EQ(0, geo.level());
+}
+
+TEST_F(UniversesTest, DISABLED_benchmark)
+{
+    this->run_benchmark(1 << 16);
+}
+
+TEST_F(UniversesFlatTest, params)
+{
+    const OrangeParams& geo = this->params();
+    EXPECT_EQ(9, geo.num_volumes());
+    EXPECT_EQ(19, geo.num_surfaces());
+    EXPECT_EQ(1, geo.host_ref().scalars.max_level);
+}
+
+TEST_F(UniversesFlatTest, cross_universes)
+{
+    // Same track as in the nested version
+    auto result = this->track(Initializer_t{{1.5, -2, 1}, {1, 0, 0}});
+    static const char* const expected_volumes[]
+        = {"a_b", "b_b", "c_b", "johnny"};
+    static const real_type expected_distances[] = {1.5, 2, 1, 2};
+    EXPECT_VEC_EQ(expected_volumes, result.volumes);
+    EXPECT_VEC_SOFT_EQ(expected_distances, result.distances);
+}
+
+TEST_F(UniversesFlatTest, DISABLED_benchmark)
+{
+    this->run_benchmark(1 << 16);
+}
+
+TEST_F(RectArrayTest, params)
+{
+    const OrangeParams& geo = this->params();
+    // Global, pin, and water units followed by the array cells
+    EXPECT_EQ(2 + 2 + 1 + 6, geo.num_volumes());
+    EXPECT_EQ(6 + 1 + 0 + 9, geo.num_surfaces());
+    EXPECT_EQ(3, geo.host_ref().scalars.max_level);
+
+    EXPECT_EQ("{1,0,0}", geo.id_to_label(VolumeId{7}).name);
+    EXPECT_EQ("arr", geo.id_to_label(VolumeId{7}).ext);
+    EXPECT_EQ(SurfaceId{11}, geo.find_surface("y0"));
+}
+
+TEST_F(RectArrayTest, initialize)
+{
+    auto geo = this->make_track_view();
+
+    geo = Initializer_t{{0.6, 0.25, 0}, {1, 0, 0}};
+    EXPECT_EQ("fuel", this->params().id_to_label(geo.volume_id()).name);
+    EXPECT_EQ(2, geo.level());
+    // Safety is limited by the fuel radius
+    EXPECT_SOFT_EQ(0.1, geo.find_safety());
+
+    geo = Initializer_t{{0.5, 1.25, 0}, {1, 0, 0}};
+    EXPECT_EQ("water", this->params().id_to_label(geo.volume_id()).name);
+    // Safety is limited by the array cell
+    EXPECT_SOFT_EQ(0.5, geo.find_safety());
+}
+
+TEST_F(RectArrayTest, cross_cells)
+{
+    {
+        // Through a row of cells along x
+        auto result = this->track(Initializer_t{{0.1, 0.25, 0}, {1, 0, 0}});
+        static const char* const expected_volumes[] = {"moderator",
+                                                       "fuel",
+                                                       "moderator",
+                                                       "water",
+                                                       "moderator",
+                                                       "fuel",
+                                                       "moderator"};
+        static const real_type expected_distances[]
+            = {0.2, 0.4, 0.3, 1, 0.3, 0.4, 0.3};
+        EXPECT_VEC_EQ(expected_volumes, result.volumes);
+        EXPECT_VEC_SOFT_EQ(expected_distances, result.distances);
+    }
+    {
+        // Across the unevenly spaced y edges
+        auto result = this->track(Initializer_t{{2.5, 0.1, 0}, {0, 1, 0}});
+        static const char* const expected_volumes[]
+            = {"fuel", "moderator", "water"};
+        static const real_type expected_distances[] = {0.35, 0.05, 1.5};
+        EXPECT_VEC_EQ(expected_volumes, result.volumes);
+        EXPECT_VEC_SOFT_EQ(expected_distances, result.distances);
+    }
+}
+
+TEST_F(RectArrayTest, DISABLED_benchmark)
+{
+    this->run_benchmark(1 << 16);
+}
+
 TEST_F(Geant4Testem15Test, params)
 {
     const OrangeParams& geo = this->params();
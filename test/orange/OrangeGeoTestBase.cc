@@ -86,14 +86,24 @@ OrangeGeoTestBase::~OrangeGeoTestBase() = default;
  * Load a geometry from the given JSON filename.
  */
 void OrangeGeoTestBase::build_geometry(const char* filename)
+{
+    this->build_geometry("orange", filename);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load a geometry from a JSON file in another test data directory.
+ */
+void OrangeGeoTestBase::build_geometry(const char* subdir,
+                                       const char* filename)
 {
     CELER_EXPECT(!params_);
-    CELER_EXPECT(filename);
+    CELER_EXPECT(subdir && filename);
     CELER_VALIDATE(CELERITAS_USE_JSON,
                    << "JSON is not enabled so geometry cannot be loaded");
 
     params_
-        = std::make_unique<Params>(this->test_data_path("orange", filename));
+        = std::make_unique<Params>(this->test_data_path(subdir, filename));
 }
 
 //---------------------------------------------------------------------------//
@@ -70,6 +70,9 @@ class OrangeGeoTestBase : public Test
     // Load `test/orange/data/{filename}` JSON input
     void build_geometry(const char* filename);
 
+    // Load `test/{subdir}/data/{filename}` JSON input
+    void build_geometry(const char* subdir, const char* filename);
+
     // Load geometry with one infinite volume
     void build_geometry(OneVolInput);
 
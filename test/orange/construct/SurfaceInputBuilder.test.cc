@@ -0,0 +1,136 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/construct/SurfaceInputBuilder.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/construct/SurfaceInputBuilder.hh"
+
+#include <string>
+#include <vector>
+
+#include "corecel/cont/Label.hh"
+#include "orange/construct/OrangeInput.hh"
+#include "orange/surf/GeneralQuadric.hh"
+#include "orange/surf/Plane.hh"
+#include "orange/surf/PlaneAligned.hh"
+#include "orange/surf/SimpleQuadric.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class SurfaceInputBuilderTest : public Test
+{
+  protected:
+    using VecReal = std::vector<real_type>;
+
+    //! Insert a surface and return the inserted type
+    template<class S>
+    std::string insert(const S& surf)
+    {
+        SurfaceInput        input;
+        SurfaceInputBuilder insert_surface(&input);
+        auto                id = insert_surface(surf, Label{"surf"});
+        EXPECT_EQ(0, id.unchecked_get());
+        EXPECT_EQ(1, input.size());
+        data_ = input.data;
+        return to_cstring(input.types.front());
+    }
+
+    VecReal data_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(SurfaceInputBuilderTest, unchanged)
+{
+    EXPECT_EQ("px", this->insert(PlaneX(1.5)));
+    EXPECT_VEC_SOFT_EQ((VecReal{1.5}), data_);
+
+    // Cross terms
+    GeneralQuadric cross{{1, 1, 1}, {1, 0, 0}, {0, 0, 0}, -1};
+    EXPECT_EQ("gq", this->insert(cross));
+
+    // Inverted sphere
+    EXPECT_EQ("sq", this->insert(SimpleQuadric{{-1, -1, -1}, {0, 0, 0}, 4}));
+
+    // Hyperboloid
+    EXPECT_EQ("sq", this->insert(SimpleQuadric{{-0.25, 1, 1}, {1, 0, 0}, -2}));
+
+    // Imaginary sphere
+    EXPECT_EQ("sq", this->insert(SimpleQuadric{{1, 1, 1}, {0, 0, 0}, 4}));
+
+    // Elliptical cylinder
+    EXPECT_EQ("sq", this->insert(SimpleQuadric{{1, 2, 0}, {0, 0, 0}, -4}));
+}
+
+TEST_F(SurfaceInputBuilderTest, planes)
+{
+    EXPECT_EQ("pz", this->insert(SimpleQuadric{{0, 0, 0}, {0, 0, 2}, -4}));
+    EXPECT_VEC_SOFT_EQ((VecReal{2}), data_);
+
+    EXPECT_EQ("py", this->insert(Plane{{0, 1, 0}, -3.0}));
+    EXPECT_VEC_SOFT_EQ((VecReal{-3}), data_);
+
+    EXPECT_EQ("p", this->insert(SimpleQuadric{{0, 0, 0}, {3, 4, 0}, -10}));
+    EXPECT_VEC_SOFT_EQ((VecReal{0.6, 0.8, 0, 2}), data_);
+
+    // Negative normal stays a general plane to preserve the sense
+    GeneralQuadric neg_plane{{0, 0, 0}, {0, 0, 0}, {-1, 0, 0}, 1};
+    EXPECT_EQ("p", this->insert(neg_plane));
+    EXPECT_VEC_SOFT_EQ((VecReal{-1, 0, 0, -1}), data_);
+}
+
+TEST_F(SurfaceInputBuilderTest, spheres)
+{
+    GeneralQuadric sphere{{1, 1, 1}, {0, 0, 0}, {0, 0, 0}, -4};
+    EXPECT_EQ("sc", this->insert(sphere));
+    EXPECT_VEC_SOFT_EQ((VecReal{4}), data_);
+
+    EXPECT_EQ("s", this->insert(SimpleQuadric{{2, 2, 2}, {-4, 0, 0}, -6}));
+    EXPECT_VEC_SOFT_EQ((VecReal{1, 0, 0, 4}), data_);
+}
+
+TEST_F(SurfaceInputBuilderTest, cylinders)
+{
+    EXPECT_EQ("czc", this->insert(SimpleQuadric{{1, 1, 0}, {0, 0, 0}, -9}));
+    EXPECT_VEC_SOFT_EQ((VecReal{9}), data_);
+
+    // (x - 1)^2 + (z - 2)^2 = 1
+    EXPECT_EQ("cy", this->insert(SimpleQuadric{{1, 0, 1}, {-2, 0, -4}, 4}));
+    EXPECT_VEC_SOFT_EQ((VecReal{1, 2, 1}), data_);
+
+    GeneralQuadric cyl{{0, 3, 3}, {0, 0, 0}, {0, 0, 0}, -3};
+    EXPECT_EQ("cxc", this->insert(cyl));
+    EXPECT_VEC_SOFT_EQ((VecReal{1}), data_);
+}
+
+TEST_F(SurfaceInputBuilderTest, cones)
+{
+    // y^2 + z^2 - (x - 2)^2 / 4 = 0
+    EXPECT_EQ("kx", this->insert(SimpleQuadric{{-0.25, 1, 1}, {1, 0, 0}, -1}));
+    EXPECT_VEC_SOFT_EQ((VecReal{2, 0, 0, 0.25}), data_);
+
+    // x^2 + y^2 - 4 (z + 1)^2 = 0
+    GeneralQuadric cone{{1, 1, -4}, {0, 0, 0}, {0, 0, -8}, -4};
+    EXPECT_EQ("kz", this->insert(cone));
+    EXPECT_VEC_SOFT_EQ((VecReal{0, 0, -1, 4}), data_);
+
+    // Hyperboloid whose constant term differs from a cone's by roundoff
+    SimpleQuadric hyperboloid{{-0.25, 1, 1}, {1, 0, 0}, -1 + 1e-14};
+    EXPECT_EQ("sq", this->insert(hyperboloid));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
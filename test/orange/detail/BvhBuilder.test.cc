@@ -0,0 +1,126 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/BvhBuilder.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/detail/BvhBuilder.hh"
+
+#include <algorithm>
+
+#include "corecel/cont/Range.hh"
+#include "orange/BoundingBoxUtils.hh"
+
+#include "celeritas_test.hh"
+
+using BvhBuilder = celeritas::detail::BvhBuilder;
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+class BvhBuilderTest : public Test
+{
+  protected:
+    using VecBBox = BvhBuilder::VecBBox;
+    using VecInt  = std::vector<int>;
+
+    //! Find candidate volumes by traversing the tree
+    VecInt find_candidates(ItemRange<BvhNode> bvh, const Real3& pos) const
+    {
+        auto   nodes = data_.bvh_nodes[bvh];
+        VecInt result;
+
+        size_type i = 0;
+        while (i < nodes.size())
+        {
+            if (!is_inside(nodes[i].bbox, pos))
+            {
+                i = nodes[i].escape;
+                continue;
+            }
+            for (VolumeId v : data_.volume_ids[nodes[i].volumes])
+            {
+                result.push_back(v.unchecked_get());
+            }
+            ++i;
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    HostVal<OrangeParamsData> data_;
+};
+
+//---------------------------------------------------------------------------//
+
+TEST_F(BvhBuilderTest, unbounded)
+{
+    BvhBuilder build(&data_);
+
+    // Background volume with null bbox, one infinite volume
+    auto bvh = build({BoundingBox{}, BoundingBox::from_infinite()});
+    ASSERT_EQ(1, bvh.size());
+    EXPECT_EQ(1, data_.bvh_nodes[*bvh.begin()].escape);
+    EXPECT_EQ(VecInt{1}, this->find_candidates(bvh, {1e10, 0, 0}));
+}
+
+TEST_F(BvhBuilderTest, slabs)
+{
+    BvhBuilder build(&data_);
+
+    // Unbounded world plus a row of unit cubes along x
+    VecBBox bboxes = {BoundingBox::from_infinite()};
+    for (auto i : range(10))
+    {
+        bboxes.push_back({{real_type(i), 0, 0}, {real_type(i + 1), 1, 1}});
+    }
+    auto bvh = build(bboxes);
+
+    // Root plus a binary tree over the cubes
+    EXPECT_EQ(12, bvh.size());
+    auto root = data_.bvh_nodes[*bvh.begin()];
+    EXPECT_EQ(bvh.size(), root.escape);
+    EXPECT_EQ(1, root.volumes.size());
+
+    auto first = data_.bvh_nodes[*bvh.begin() + 1];
+    EXPECT_VEC_SOFT_EQ((Real3{0, 0, 0}), first.bbox.lower());
+    EXPECT_VEC_SOFT_EQ((Real3{10, 1, 1}), first.bbox.upper());
+
+    // Leaves may include adjacent cubes
+    EXPECT_EQ((VecInt{0, 4, 5}),
+              this->find_candidates(bvh, {3.5, 0.5, 0.5}));
+    EXPECT_EQ((VecInt{0, 9, 10}), this->find_candidates(bvh, {9, 0.5, 0.5}));
+    EXPECT_EQ((VecInt{0}), this->find_candidates(bvh, {3.5, 1.5, 0.5}));
+    EXPECT_EQ((VecInt{0}), this->find_candidates(bvh, {-1, 0.5, 0.5}));
+
+    // A second unit is appended after the first
+    auto bvh2 = build({BoundingBox{{0, 0, 0}, {1, 1, 1}}});
+    EXPECT_EQ(*bvh.end(), *bvh2.begin());
+    EXPECT_EQ((VecInt{0}), this->find_candidates(bvh2, {0.5, 0.5, 0.5}));
+    EXPECT_EQ((VecInt{}), this->find_candidates(bvh2, {1.5, 0.5, 0.5}));
+}
+
+TEST_F(BvhBuilderTest, coincident)
+{
+    BvhBuilder build(&data_);
+
+    // Nested boxes with the same center can't be split
+    VecBBox bboxes;
+    for (auto i : range(5))
+    {
+        real_type w = i + 1;
+        bboxes.push_back({{-w, -w, -w}, {w, w, w}});
+    }
+    auto bvh = build(bboxes);
+    EXPECT_EQ(2, bvh.size());
+    EXPECT_EQ((VecInt{0, 1, 2, 3, 4}),
+              this->find_candidates(bvh, {2.5, 0, 0}));
+    EXPECT_EQ((VecInt{}), this->find_candidates(bvh, {5.5, 0, 0}));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
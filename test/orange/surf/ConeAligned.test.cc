@@ -0,0 +1,101 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/surf/ConeAligned.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/surf/ConeAligned.hh"
+
+#include <cmath>
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+using Intersections = ConeX::Intersections;
+
+//---------------------------------------------------------------------------//
+TEST(ConeAlignedTest, construction)
+{
+    EXPECT_EQ(SurfaceType::kx, ConeX::surface_type());
+    EXPECT_EQ(SurfaceType::ky, ConeY::surface_type());
+    EXPECT_EQ(SurfaceType::kz, ConeZ::surface_type());
+    EXPECT_EQ(4, ConeX::Storage::extent);
+    EXPECT_EQ(2, ConeX::Intersections{}.size());
+
+    ConeX k({1, 2, 3}, 0.5);
+
+    const real_type expected_data[] = {1, 2, 3, 0.25};
+    EXPECT_VEC_SOFT_EQ(expected_data, k.data());
+}
+
+TEST(ConeAlignedTest, x)
+{
+    const Real3 origin{1.1, 2.2, 3.3};
+    ConeX       cone(origin, 2.0 / 3.0);
+
+    auto translate = [&origin](Real3 pos) {
+        for (int i = 0; i < 3; ++i)
+        {
+            pos[i] += origin[i];
+        }
+        return pos;
+    };
+
+    EXPECT_EQ(SignedSense::inside, cone.calc_sense(translate({3, 0, 0})));
+    EXPECT_EQ(SignedSense::inside, cone.calc_sense(translate({-3, 1, 0})));
+    EXPECT_EQ(SignedSense::outside, cone.calc_sense(translate({0, 1, 0})));
+    EXPECT_EQ(SignedSense::outside, cone.calc_sense(translate({3, 0, 2.1})));
+
+    EXPECT_VEC_SOFT_EQ((Real3{-0.5547001962252291, 0.8320502943378437, 0}),
+                       cone.calc_normal(translate({3, 2, 0})));
+
+    Intersections distances;
+
+    // From inside
+    distances = cone.calc_intersections(
+        translate({3, 0, 0}), Real3{0, 1, 0}, SurfaceState::off);
+    EXPECT_EQ(no_intersection(), distances[0]);
+    EXPECT_SOFT_EQ(2.0, distances[1]);
+
+    // From outside, hitting both sides of one nappe
+    distances = cone.calc_intersections(
+        translate({3, -5, 0}), Real3{0, 1, 0}, SurfaceState::off);
+    EXPECT_SOFT_EQ(3.0, distances[0]);
+    EXPECT_SOFT_EQ(7.0, distances[1]);
+
+    // On surface, heading inward
+    distances = cone.calc_intersections(
+        translate({3, 2, 0}), Real3{0, -1, 0}, SurfaceState::on);
+    EXPECT_SOFT_EQ(4.0, distances[0]);
+    EXPECT_EQ(no_intersection(), distances[1]);
+
+    // From outside, crossing both nappes along the axis
+    distances = cone.calc_intersections(
+        translate({-6, 0, 1}), Real3{1, 0, 0}, SurfaceState::off);
+    EXPECT_SOFT_EQ(4.5, distances[0]);
+    EXPECT_SOFT_EQ(7.5, distances[1]);
+}
+
+TEST(ConeAlignedTest, z)
+{
+    ConeZ cone({0, 0, 0}, 1.0);
+
+    EXPECT_EQ(SignedSense::inside, cone.calc_sense({0.5, 0.5, 1}));
+    EXPECT_EQ(SignedSense::outside, cone.calc_sense({1, 1, 1}));
+
+    // Parallel to the cone's surface: one (imprecise) intersection
+    const real_type sqrt_half = 1 / std::sqrt(2.0);
+    Intersections   distances = cone.calc_intersections(
+        Real3{-1, 0, 0}, Real3{sqrt_half, 0, sqrt_half}, SurfaceState::off);
+    EXPECT_NEAR(std::sqrt(0.5), distances[0], 1e-5);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
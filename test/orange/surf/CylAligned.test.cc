@@ -0,0 +1,103 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/surf/CylAligned.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/surf/CylAligned.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+using Intersections = CylZ::Intersections;
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+TEST(TestCylX, construction)
+{
+    EXPECT_EQ(SurfaceType::cx, CylX::surface_type());
+    EXPECT_EQ(3, CylX::Storage::extent);
+    EXPECT_EQ(2, CylX::Intersections{}.size());
+
+    // Position along the axis is ignored
+    CylX c({123, 1, 2}, 0.5);
+
+    const real_type expected_data[] = {1, 2, 0.25};
+    EXPECT_VEC_SOFT_EQ(expected_data, c.data());
+    EXPECT_VEC_SOFT_EQ((Real3{0, 1, 2}), c.calc_origin());
+}
+
+TEST(TestCylX, intersect)
+{
+    CylX cyl({0, 1, 2}, 1.0);
+
+    EXPECT_EQ(SignedSense::inside, cyl.calc_sense(Real3{5, 1, 2.5}));
+    EXPECT_EQ(SignedSense::outside, cyl.calc_sense(Real3{5, 1, 3.5}));
+
+    Intersections distances = cyl.calc_intersections(
+        Real3{5, 1, -1}, Real3{0, 0, 1}, SurfaceState::off);
+    EXPECT_SOFT_EQ(2.0, distances[0]);
+    EXPECT_SOFT_EQ(4.0, distances[1]);
+
+    EXPECT_VEC_SOFT_EQ((Real3{0, 0, -1}), cyl.calc_normal(Real3{3, 1, 1}));
+}
+
+//---------------------------------------------------------------------------//
+TEST(TestCylZ, all)
+{
+    EXPECT_EQ(SurfaceType::cz, CylZ::surface_type());
+
+    CylZ cyl({1, 2, 0}, 2.0);
+    EXPECT_SOFT_EQ(1.0, cyl.origin_u());
+    EXPECT_SOFT_EQ(2.0, cyl.origin_v());
+    EXPECT_SOFT_EQ(4.0, cyl.radius_sq());
+
+    EXPECT_EQ(SignedSense::inside, cyl.calc_sense(Real3{1, 2, 5}));
+    EXPECT_EQ(SignedSense::outside, cyl.calc_sense(Real3{3.1, 2, 0}));
+
+    EXPECT_VEC_SOFT_EQ((Real3{1, 0, 0}), cyl.calc_normal(Real3{3, 2, 7}));
+    EXPECT_VEC_SOFT_EQ((Real3{0, -1, 0}), cyl.calc_normal(Real3{1, 0, -7}));
+
+    Intersections distances;
+
+    // From outside, hitting both
+    distances = cyl.calc_intersections(
+        Real3{-3, 2, 0}, Real3{1, 0, 0}, SurfaceState::off);
+    EXPECT_SOFT_EQ(2.0, distances[0]);
+    EXPECT_SOFT_EQ(6.0, distances[1]);
+
+    // From inside
+    distances = cyl.calc_intersections(
+        Real3{1, 2, 0}, Real3{0, 1, 0}, SurfaceState::off);
+    EXPECT_EQ(no_intersection(), distances[0]);
+    EXPECT_SOFT_EQ(2.0, distances[1]);
+
+    // On surface, inward
+    distances = cyl.calc_intersections(
+        Real3{3, 2, 0}, Real3{-1, 0, 0}, SurfaceState::on);
+    EXPECT_SOFT_EQ(4.0, distances[0]);
+    EXPECT_EQ(no_intersection(), distances[1]);
+
+    // On surface, outward
+    distances = cyl.calc_intersections(
+        Real3{3, 2, 0}, Real3{1, 0, 0}, SurfaceState::on);
+    EXPECT_EQ(no_intersection(), distances[0]);
+    EXPECT_EQ(no_intersection(), distances[1]);
+
+    // Along the axis
+    distances = cyl.calc_intersections(
+        Real3{1, 2, 0}, Real3{0, 0, 1}, SurfaceState::off);
+    EXPECT_EQ(no_intersection(), distances[0]);
+    EXPECT_EQ(no_intersection(), distances[1]);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
@@ -0,0 +1,66 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/surf/Plane.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/surf/Plane.hh"
+
+#include <cmath>
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+using Intersections = Plane::Intersections;
+
+//---------------------------------------------------------------------------//
+TEST(PlaneTest, all)
+{
+    EXPECT_EQ(SurfaceType::p, Plane::surface_type());
+    EXPECT_EQ(4, Plane::Storage::extent);
+    EXPECT_EQ(1, Plane::Intersections{}.size());
+
+    const real_type sqrt_half = 1 / std::sqrt(2.0);
+    const Real3     normal{sqrt_half, sqrt_half, 0};
+
+    Plane p{normal, Real3{1, 1, 0}};
+    EXPECT_VEC_SOFT_EQ(normal, p.normal());
+    EXPECT_SOFT_EQ(std::sqrt(2.0), p.displacement());
+    EXPECT_SOFT_EQ(p.displacement(), Plane(normal, std::sqrt(2.0)).data()[3]);
+
+    EXPECT_EQ(SignedSense::inside, p.calc_sense({0, 0, 5}));
+    EXPECT_EQ(SignedSense::outside, p.calc_sense({2, 2, -5}));
+    EXPECT_VEC_SOFT_EQ(normal, p.calc_normal({1, 1, 0}));
+
+    Intersections distances;
+
+    // Toward the plane
+    distances = p.calc_intersections(
+        Real3{0, 0, 0}, Real3{1, 0, 0}, SurfaceState::off);
+    EXPECT_SOFT_EQ(2.0, distances[0]);
+
+    // Away from the plane
+    distances = p.calc_intersections(
+        Real3{0, 0, 0}, Real3{-1, 0, 0}, SurfaceState::off);
+    EXPECT_EQ(no_intersection(), distances[0]);
+
+    // Parallel to the plane
+    distances = p.calc_intersections(
+        Real3{0, 0, 0}, Real3{sqrt_half, -sqrt_half, 0}, SurfaceState::off);
+    EXPECT_EQ(no_intersection(), distances[0]);
+
+    // On the plane
+    distances = p.calc_intersections(
+        Real3{2, 0, 0}, Real3{-1, 0, 0}, SurfaceState::on);
+    EXPECT_EQ(no_intersection(), distances[0]);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
@@ -0,0 +1,76 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/surf/SimpleQuadric.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/surf/SimpleQuadric.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+using Intersections = SimpleQuadric::Intersections;
+
+//---------------------------------------------------------------------------//
+/*!
+ * This shape is an ellipsoid with radii {3, 2, 1} centered at {1, 2, 3}.
+ */
+TEST(SimpleQuadricTest, all)
+{
+    EXPECT_EQ(SurfaceType::sq, SimpleQuadric::surface_type());
+    EXPECT_EQ(7, SimpleQuadric::Storage::extent);
+    EXPECT_EQ(2, SimpleQuadric::Intersections{}.size());
+
+    const Real3 second{4, 9, 36};
+    const Real3 first{-8, -36, -216};
+    real_type   zeroth = 328;
+
+    SimpleQuadric sq{second, first, zeroth};
+    EXPECT_VEC_SOFT_EQ(second, sq.second());
+    EXPECT_VEC_SOFT_EQ(first, sq.first());
+    EXPECT_SOFT_EQ(zeroth, sq.zeroth());
+
+    EXPECT_EQ(SignedSense::inside, sq.calc_sense({1, 2, 3}));
+    EXPECT_EQ(SignedSense::inside, sq.calc_sense({3.9, 2, 3}));
+    EXPECT_EQ(SignedSense::outside, sq.calc_sense({4.01, 2, 3}));
+    EXPECT_EQ(SignedSense::outside, sq.calc_sense({1, 2, 4.01}));
+
+    EXPECT_VEC_SOFT_EQ((Real3{1, 0, 0}), sq.calc_normal({4, 2, 3}));
+    EXPECT_VEC_SOFT_EQ((Real3{0, 1, 0}), sq.calc_normal({1, 4, 3}));
+
+    Intersections distances;
+
+    // In center
+    distances = sq.calc_intersections(
+        Real3{1, 2, 3}, Real3{1, 0, 0}, SurfaceState::off);
+    EXPECT_EQ(no_intersection(), distances[0]);
+    EXPECT_SOFT_EQ(3.0, distances[1]);
+
+    // Outside, hitting both
+    distances = sq.calc_intersections(
+        Real3{-4, 2, 3}, Real3{1, 0, 0}, SurfaceState::off);
+    EXPECT_SOFT_EQ(2.0, distances[0]);
+    EXPECT_SOFT_EQ(8.0, distances[1]);
+
+    // On surface, inward
+    distances = sq.calc_intersections(
+        Real3{4, 2, 3}, Real3{-1, 0, 0}, SurfaceState::on);
+    EXPECT_SOFT_EQ(6.0, distances[0]);
+    EXPECT_EQ(no_intersection(), distances[1]);
+
+    // On surface, outward
+    distances = sq.calc_intersections(
+        Real3{1, 2, 4}, Real3{0, 0, 1}, SurfaceState::on);
+    EXPECT_EQ(no_intersection(), distances[0]);
+    EXPECT_EQ(no_intersection(), distances[1]);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
@@ -15,7 +15,9 @@
 #include <vector>
 
 #include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
 #include "corecel/data/CollectionMirror.hh"
+#include "corecel/sys/Stopwatch.hh"
 #include "orange/OrangeData.hh"
 #include "orange/OrangeGeoTestBase.hh"
 #include "orange/construct/OrangeInput.hh"
@@ -107,6 +109,55 @@ class SurfaceActionTest : public OrangeGeoTestBase
     std::mt19937 rng_;
 };
 
+//! One surface of each type
+class AllSurfacesTest : public SurfaceActionTest
+{
+  protected:
+    void SetUp() override
+    {
+        UnitInput unit;
+        unit.label = "dummy";
+
+        {
+            SurfaceInputBuilder insert(&unit.surfaces);
+            insert(PlaneX(1), "px");
+            insert(PlaneY(2), "py");
+            insert(PlaneZ(3), "pz");
+            insert(CCylX(5), "cxc");
+            insert(CCylY(6), "cyc");
+            insert(CCylZ(7), "czc");
+            insert(SphereCentered(1.5), "sc");
+            insert(CylX({0, 1, 2}, 3), "cx");
+            insert(CylY({1, 0, 2}, 4), "cy");
+            insert(CylZ({1, 2, 0}, 5), "cz");
+            insert(Plane({0.6, 0.8, 0}, 2.0), "p");
+            insert(Sphere({1, 2, 3}, 1.5), "s");
+            insert(ConeX({1, 2, 3}, 0.5), "kx");
+            insert(ConeY({1, 2, 3}, 1.0), "ky");
+            insert(ConeZ({1, 2, 3}, 2.0), "kz");
+            insert(SimpleQuadric({4, 9, 36}, {-8, -36, -216}, 328), "sq");
+            insert(GeneralQuadric({0, 1, 2}, {3, 4, 5}, {6, 7, 8}, 9), "gq");
+        }
+        {
+            VolumeInput v;
+            for (logic_int i : range(unit.surfaces.size()))
+            {
+                v.logic.push_back(i);
+                if (i != 0)
+                {
+                    v.logic.push_back(logic::lor);
+                }
+                v.faces.push_back(SurfaceId{i});
+            }
+            v.logic.insert(v.logic.end(), {logic::ltrue, logic::lor});
+            unit.volumes = {std::move(v)};
+        }
+        unit.bbox = {{-1, -1, -1}, {1, 1, 1}};
+
+        this->build_geometry(std::move(unit));
+    }
+};
+
 class StaticSurfaceActionTest : public Test
 {
 };
@@ -131,6 +182,31 @@ struct ToString
     ToString(ToString&&)      = default;
 };
 
+//---------------------------------------------------------------------------//
+//! Accumulate the distance to the nearest intersection
+struct SumNearestIntersection
+{
+    const Real3* pos;
+    const Real3* dir;
+    real_type*   sum;
+
+    template<class S>
+    void operator()(S&& surf) const
+    {
+        auto all_dist = surf.calc_intersections(
+            *this->pos, *this->dir, SurfaceState::off);
+        real_type nearest = no_intersection();
+        for (real_type dist : all_dist)
+        {
+            nearest = std::min(nearest, dist);
+        }
+        if (nearest < no_intersection())
+        {
+            *this->sum += nearest;
+        }
+    }
+};
+
 //---------------------------------------------------------------------------//
 //! Get the amount of storage
 template<class S>
@@ -263,6 +339,114 @@ TEST_F(SurfaceActionTest, TEST_IF_CELER_DEVICE(device_distances))
     }
 }
 
+//---------------------------------------------------------------------------//
+
+TEST_F(AllSurfacesTest, string)
+{
+    const auto& host_ref = this->params().host_ref();
+    Surfaces surfaces(host_ref, host_ref.simple_unit[SimpleUnitId{0}].surfaces);
+    auto     surf_to_string = make_surface_action(surfaces, ToString{});
+
+    std::vector<std::string> strings;
+    std::vector<std::string> types;
+    for (auto id : range(SurfaceId{surfaces.num_surfaces()}))
+    {
+        strings.push_back(surf_to_string(id));
+        types.push_back(to_cstring(surfaces.surface_type(id)));
+    }
+
+    // clang-format off
+    const std::string expected_strings[] = {
+        "Plane: x=1",
+        "Plane: y=2",
+        "Plane: z=3",
+        "Cyl x: r=5",
+        "Cyl y: r=6",
+        "Cyl z: r=7",
+        "Sphere: r=1.5",
+        "Cyl x: r=3 at {0,1,2}",
+        "Cyl y: r=4 at {1,0,2}",
+        "Cyl z: r=5 at {1,2,0}",
+        "Plane: n={0.6,0.8,0}, d=2",
+        "Sphere: r=1.5 at {1,2,3}",
+        "Cone x: t=0.5 at {1,2,3}",
+        "Cone y: t=1 at {1,2,3}",
+        "Cone z: t=2 at {1,2,3}",
+        "SQuadric: {4,9,36} {-8,-36,-216} 328",
+        "GQuadric: {0,1,2} {3,4,5} {6,7,8} 9"};
+    // clang-format on
+    EXPECT_VEC_EQ(expected_strings, strings);
+
+    // Each surface type is used exactly once
+    std::vector<std::string> expected_types;
+    for (auto st : range(SurfaceType::size_))
+    {
+        expected_types.push_back(to_cstring(st));
+    }
+    EXPECT_VEC_EQ(expected_types, types);
+}
+
+TEST_F(AllSurfacesTest, host_distances)
+{
+    const auto& host_ref = this->params().host_ref();
+
+    HostVal<OrangeMiniStateData> states;
+    resize(&states, host_ref, 1024);
+    HostRef<OrangeMiniStateData> state_ref;
+    state_ref = states;
+    this->fill_uniform_box(state_ref.pos[AllItems<Real3>{}]);
+    this->fill_isotropic(state_ref.dir[AllItems<Real3>{}]);
+
+    CalcSenseDistanceLauncher<> calc_thread{host_ref, state_ref};
+    for (auto tid : range(ThreadId{states.size()}))
+    {
+        calc_thread(tid);
+    }
+
+    // Dispatching to every surface type gives valid distances
+    for (auto tid : range(ThreadId{states.size()}))
+    {
+        EXPECT_GT(state_ref.distance[tid], 0);
+    }
+}
+
+//---------------------------------------------------------------------------//
+//! Time the intersection calculation for each surface type
+TEST_F(AllSurfacesTest, DISABLED_benchmark)
+{
+    constexpr size_type num_samples = 1 << 20;
+
+    std::vector<Real3> pos(num_samples);
+    std::vector<Real3> dir(num_samples);
+    this->fill_uniform_box(make_span(pos));
+    this->fill_isotropic(make_span(dir));
+
+    const auto& host_ref = this->params().host_ref();
+    Surfaces surfaces(host_ref, host_ref.simple_unit[SimpleUnitId{0}].surfaces);
+
+    for (auto id : range(SurfaceId{surfaces.num_surfaces()}))
+    {
+        Real3     cur_pos;
+        Real3     cur_dir;
+        real_type sum            = 0;
+        auto      calc_intersect = make_surface_action(
+            surfaces, SumNearestIntersection{&cur_pos, &cur_dir, &sum});
+
+        Stopwatch get_time;
+        for (auto i : range(num_samples))
+        {
+            cur_pos = pos[i];
+            cur_dir = dir[i];
+            calc_intersect(id);
+        }
+        double time = get_time();
+
+        std::cout << to_cstring(surfaces.surface_type(id)) << ": "
+             << time * 1e9 / num_samples << " ns per intersection (sum "
+             << sum << ")" << std::endl;
+    }
+}
+
 //---------------------------------------------------------------------------//
 //! Loop through all surface types and ensure "storage" type is correctly sized
 TEST_F(StaticSurfaceActionTest, check_surface_sizes)
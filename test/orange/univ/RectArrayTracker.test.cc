@@ -0,0 +1,206 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2022 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/univ/RectArrayTracker.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/univ/RectArrayTracker.hh"
+
+#include "celeritas_config.h"
+#include "orange/OrangeGeoTestBase.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST FIXTURES
+//---------------------------------------------------------------------------//
+
+#define RectArrayTrackerTest TEST_IF_CELERITAS_JSON(RectArrayTrackerTest)
+class RectArrayTrackerTest : public OrangeGeoTestBase
+{
+  protected:
+    using LocalState = ::celeritas::detail::LocalState;
+    using OnSurface  = ::celeritas::detail::OnSurface;
+    using Coords     = RectArrayTracker::Coords;
+
+    void SetUp() override { this->build_geometry("rect-array.org.json"); }
+
+    //! Create a tracker for the (only) array
+    RectArrayTracker make_tracker() const
+    {
+        return RectArrayTracker(this->params().host_ref(), RectArrayId{0});
+    }
+
+    //! Create a local state in the array
+    LocalState make_state(Real3 pos, Real3 dir, VolumeId vol = {}) const
+    {
+        LocalState state;
+        state.pos    = pos;
+        state.dir    = dir;
+        state.volume = vol;
+        return state;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(RectArrayTrackerTest, accessors)
+{
+    auto tracker = this->make_tracker();
+    EXPECT_EQ(6, tracker.num_volumes());
+    EXPECT_EQ(9, tracker.num_surfaces());
+
+    // Only x and z are evenly spaced
+    const auto& record = this->params().host_ref().rect_arrays[RectArrayId{0}];
+    EXPECT_VEC_SOFT_EQ(Real3({1, 0, 2}), record.uniform_width);
+    EXPECT_EQ(3, record.num_cells(Axis::x));
+    EXPECT_EQ(2, record.num_cells(Axis::y));
+    EXPECT_EQ(1, record.num_cells(Axis::z));
+}
+
+TEST_F(RectArrayTrackerTest, indexing)
+{
+    auto tracker = this->make_tracker();
+
+    // Evenly spaced
+    EXPECT_EQ(0, tracker.find_index(Axis::x, 0.0));
+    EXPECT_EQ(0, tracker.find_index(Axis::x, 0.999));
+    EXPECT_EQ(1, tracker.find_index(Axis::x, 1.0));
+    EXPECT_EQ(2, tracker.find_index(Axis::x, 2.999));
+    EXPECT_EQ(3, tracker.find_index(Axis::x, 3.0));
+    EXPECT_EQ(3, tracker.find_index(Axis::x, -0.001));
+
+    // Unevenly spaced
+    EXPECT_EQ(0, tracker.find_index(Axis::y, 0.499));
+    EXPECT_EQ(1, tracker.find_index(Axis::y, 0.5));
+    EXPECT_EQ(1, tracker.find_index(Axis::y, 1.999));
+    EXPECT_EQ(2, tracker.find_index(Axis::y, 2.0));
+
+    // Cells are numbered with z varying fastest
+    EXPECT_EQ(VolumeId{0}, tracker.to_volume({0, 0, 0}));
+    EXPECT_EQ(VolumeId{3}, tracker.to_volume({1, 1, 0}));
+    EXPECT_EQ(VolumeId{4}, tracker.to_volume({2, 0, 0}));
+    for (auto i : range(tracker.num_volumes()))
+    {
+        EXPECT_EQ(VolumeId{i},
+                  tracker.to_volume(tracker.to_coords(VolumeId{i})));
+    }
+
+    // Surfaces are numbered along x, then y, then z
+    EXPECT_EQ(SurfaceId{0}, tracker.to_surface(Axis::x, 0));
+    EXPECT_EQ(SurfaceId{5}, tracker.to_surface(Axis::y, 1));
+    EXPECT_EQ(SurfaceId{8}, tracker.to_surface(Axis::z, 1));
+}
+
+TEST_F(RectArrayTrackerTest, initialize)
+{
+    auto tracker = this->make_tracker();
+    {
+        auto init
+            = tracker.initialize(this->make_state({1.5, 1, 0}, {1, 0, 0}));
+        EXPECT_EQ(VolumeId{3}, init.volume);
+        EXPECT_FALSE(init.surface);
+    }
+    {
+        // Lower edge belongs to the cell above it
+        auto init = tracker.initialize(this->make_state({2, 0, 0}, {1, 0, 0}));
+        EXPECT_EQ(VolumeId{4}, init.volume);
+    }
+    {
+        // Outside the array
+        auto init = tracker.initialize(this->make_state({1, 1, 2}, {1, 0, 0}));
+        EXPECT_FALSE(init.volume);
+    }
+}
+
+TEST_F(RectArrayTrackerTest, intersect)
+{
+    auto tracker = this->make_tracker();
+    {
+        auto isect = tracker.intersect(
+            this->make_state({1.5, 1, 0}, {1, 0, 0}, VolumeId{3}));
+        EXPECT_EQ(SurfaceId{2}, isect.surface.id());
+        EXPECT_EQ(Sense::inside, isect.surface.sense());
+        EXPECT_SOFT_EQ(0.5, isect.distance);
+    }
+    {
+        auto isect = tracker.intersect(
+            this->make_state({1.5, 1, 0}, {0, -1, 0}, VolumeId{3}));
+        EXPECT_EQ(SurfaceId{5}, isect.surface.id());
+        EXPECT_EQ(Sense::outside, isect.surface.sense());
+        EXPECT_SOFT_EQ(0.5, isect.distance);
+    }
+    {
+        // Outer edges are ignored
+        auto isect = tracker.intersect(
+            this->make_state({1.5, 1, 0}, {0, 1, 0}, VolumeId{3}));
+        EXPECT_FALSE(isect);
+        EXPECT_EQ(no_intersection(), isect.distance);
+    }
+    {
+        // Nearest edge along an oblique direction
+        const real_type inv_sqrt2 = 1 / std::sqrt(real_type(2));
+        auto            isect     = tracker.intersect(this->make_state(
+            {1.75, 0.25, 0}, {-inv_sqrt2, inv_sqrt2, 0}, VolumeId{2}));
+        EXPECT_EQ(SurfaceId{5}, isect.surface.id());
+        EXPECT_SOFT_EQ(0.25 / inv_sqrt2, isect.distance);
+    }
+    {
+        // Limited by the maximum distance
+        auto isect = tracker.intersect(
+            this->make_state({1.5, 1, 0}, {1, 0, 0}, VolumeId{3}), 0.25);
+        EXPECT_FALSE(isect);
+        EXPECT_SOFT_EQ(0.25, isect.distance);
+    }
+}
+
+TEST_F(RectArrayTrackerTest, cross_boundary)
+{
+    auto tracker = this->make_tracker();
+    {
+        auto state    = this->make_state({2, 1, 0}, {1, 0, 0}, VolumeId{3});
+        state.surface = {SurfaceId{2}, Sense::outside};
+        auto init     = tracker.cross_boundary(state);
+        EXPECT_EQ(VolumeId{5}, init.volume);
+        EXPECT_EQ(SurfaceId{2}, init.surface.id());
+    }
+    {
+        auto state
+            = this->make_state({1.5, 0.5, 0}, {0, -1, 0}, VolumeId{3});
+        state.surface = {SurfaceId{5}, Sense::inside};
+        auto init     = tracker.cross_boundary(state);
+        EXPECT_EQ(VolumeId{2}, init.volume);
+    }
+    {
+        // Leaving the array
+        auto state    = this->make_state({3, 1, 0}, {1, 0, 0}, VolumeId{5});
+        state.surface = {SurfaceId{3}, Sense::outside};
+        auto init     = tracker.cross_boundary(state);
+        EXPECT_FALSE(init.volume);
+    }
+}
+
+TEST_F(RectArrayTrackerTest, safety_normal)
+{
+    auto tracker = this->make_tracker();
+    EXPECT_SOFT_EQ(0.2, tracker.safety({1.2, 1, 0.5}, VolumeId{3}));
+    EXPECT_SOFT_EQ(0.0, tracker.safety({1, 1, 0.5}, VolumeId{3}));
+
+    EXPECT_VEC_SOFT_EQ(Real3({1, 0, 0}),
+                       tracker.normal({1, 1, 0}, SurfaceId{1}));
+    EXPECT_VEC_SOFT_EQ(Real3({0, 1, 0}),
+                       tracker.normal({1, 1, 0}, SurfaceId{5}));
+    EXPECT_VEC_SOFT_EQ(Real3({0, 0, 1}),
+                       tracker.normal({1, 1, 0}, SurfaceId{7}));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace test
+} // namespace celeritas
@@ -9,14 +9,19 @@
 
 #include <algorithm>
 #include <random>
+#include <utility>
+#include <vector>
 
 #include "celeritas_config.h"
 #include "corecel/data/CollectionAlgorithms.hh"
 #include "corecel/data/CollectionStateStore.hh"
 #include "corecel/io/Repr.hh"
+#include "corecel/math/Algorithms.hh"
 #include "corecel/math/ArrayUtils.hh"
 #include "corecel/sys/Stopwatch.hh"
 #include "orange/OrangeGeoTestBase.hh"
+#include "orange/surf/SurfaceIO.hh"
+#include "orange/surf/Surfaces.hh"
 #include "celeritas/Constants.hh"
 #include "celeritas/random/distribution/IsotropicDistribution.hh"
 #include "celeritas/random/distribution/UniformBoxDistribution.hh"
@@ -124,6 +129,36 @@ class FiveVolumesTest : public SimpleUnitTrackerTest
     void SetUp() override { this->build_geometry("five-volumes.org.json"); }
 };
 
+#define TestEm3Test TEST_IF_CELERITAS_JSON(TestEm3Test)
+class TestEm3Test : public SimpleUnitTrackerTest
+{
+    void SetUp() override
+    {
+        this->build_geometry("celeritas", "testem3-flat.org.json");
+    }
+};
+
+#define PolyPrismTest TEST_IF_CELERITAS_JSON(PolyPrismTest)
+class PolyPrismTest : public SimpleUnitTrackerTest
+{
+    void SetUp() override { this->build_geometry("polyprism.org.json"); }
+};
+
+#define RotatedCylinderTest TEST_IF_CELERITAS_JSON(RotatedCylinderTest)
+class RotatedCylinderTest : public SimpleUnitTrackerTest
+{
+    void SetUp() override
+    {
+        this->build_geometry("rotated-cylinder.org.json");
+    }
+};
+
+#define QuadricsTest TEST_IF_CELERITAS_JSON(QuadricsTest)
+class QuadricsTest : public SimpleUnitTrackerTest
+{
+    void SetUp() override { this->build_geometry("quadrics.org.json"); }
+};
+
 //---------------------------------------------------------------------------//
 // TEST FIXTURE IMPLEMENTATION
 //---------------------------------------------------------------------------//
@@ -580,13 +615,8 @@ TEST_F(TwoVolumeTest, safety)
     EXPECT_SOFT_EQ(0.5, tracker.safety({0, 0, 2}, outside));
     EXPECT_SOFT_EQ(0.5, tracker.safety({0, 0, 1}, inside));
     EXPECT_SOFT_EQ(1.5 - 1e-10, tracker.safety({1e-10, 0, 0}, inside));
-#if 0
-    // Correct result but there is a singularity at zero
-    EXPECT_SOFT_EQ(1.5, tracker.safety({0, 0, 0}, inside)); // degenerate!
-#else
-    // Actual result
-    EXPECT_SOFT_EQ(inf, tracker.safety({0, 0, 0}, inside)); // degenerate!
-#endif
+    // No singularity at the center
+    EXPECT_SOFT_EQ(1.5, tracker.safety({0, 0, 0}, inside));
 }
 
 TEST_F(TwoVolumeTest, normal)
@@ -937,6 +967,501 @@ TEST_F(FiveVolumesTest, heuristic_init)
     }
 }
 
+//---------------------------------------------------------------------------//
+
+TEST_F(TestEm3Test, bvh)
+{
+    const auto& host_ref = this->params().host_ref();
+    const auto& unit     = host_ref.simple_unit[SimpleUnitId{0}];
+
+    // Exterior is unbounded; world box and layers are bounded
+    auto nodes = host_ref.bvh_nodes[unit.bvh];
+    ASSERT_GT(nodes.size(), 1);
+    EXPECT_EQ(nodes.size(), nodes[0].escape);
+    EXPECT_EQ(1, nodes[0].volumes.size());
+    EXPECT_EQ("[EXTERIOR]",
+              this->id_to_label(host_ref.volume_ids[nodes[0].volumes][0]));
+    EXPECT_VEC_SOFT_EQ((Real3{-24, -24, -24}), nodes[1].bbox.lower());
+    EXPECT_VEC_SOFT_EQ((Real3{24, 24, 24}), nodes[1].bbox.upper());
+
+    // Leaves are no larger than a few layers
+    size_type max_leaf_volumes = 0;
+    for (const BvhNode& n : nodes)
+    {
+        max_leaf_volumes = std::max(max_leaf_volumes, n.volumes.size());
+    }
+    EXPECT_EQ(2, max_leaf_volumes);
+}
+
+TEST_F(TestEm3Test, face_batches)
+{
+    using ::celeritas::detail::CalcBatchIntersections;
+    using ::celeritas::detail::CalcIntersections;
+    using ::celeritas::detail::IsFinite;
+    using ::celeritas::detail::TempNextFace;
+    using VecIsect = std::vector<std::pair<FaceId, real_type>>;
+
+    const auto& host_ref = this->params().host_ref();
+    const auto& unit     = host_ref.simple_unit[SimpleUnitId{0}];
+    Surfaces    surfaces{host_ref, unit.surfaces};
+
+    // The world box has one batch for each axis
+    {
+        VolumeView world{host_ref, unit, this->find_volume("world_lv")};
+        auto       batches = world.face_batches();
+        ASSERT_EQ(3, batches.size());
+        EXPECT_EQ(SurfaceType::px, batches[0].type);
+        EXPECT_EQ(SurfaceType::pz, batches[2].type);
+        EXPECT_EQ(world.num_faces(),
+                  batches[0].faces.size() + batches[1].faces.size()
+                      + batches[2].faces.size());
+        EXPECT_EQ(batches[0].faces.size(), batches[0].data.size());
+    }
+
+    // Storage for the scalar and batched intersections
+    const size_type        max_isect = host_ref.scalars.max_intersections;
+    std::vector<FaceId>    faces(2 * max_isect);
+    std::vector<real_type> distances(2 * max_isect);
+    std::vector<size_type> isects(2 * max_isect);
+    auto                   make_temp = [&](size_type offset) {
+        TempNextFace result;
+        result.face     = faces.data() + offset;
+        result.distance = distances.data() + offset;
+        result.isect    = isects.data() + offset;
+        result.size     = max_isect;
+        return result;
+    };
+    auto to_sorted = [](const TempNextFace& temp, size_type num_isect) {
+        VecIsect result;
+        for (auto i : range(num_isect))
+        {
+            result.push_back({temp.face[i], temp.distance[i]});
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+
+    // Batched intersections should exactly match the scalar reference
+    std::mt19937             rng;
+    const auto&              bbox = this->params().bbox();
+    UniformBoxDistribution<> sample_box{bbox.lower(), bbox.upper()};
+    IsotropicDistribution<>  sample_dir;
+    for (auto i : range(64))
+    {
+        Real3 pos = sample_box(rng);
+        Real3 dir = sample_dir(rng);
+        for (auto vid : range(VolumeId{unit.volumes.size()}))
+        {
+            VolumeView vol{host_ref, unit, vid};
+            FaceId     on_face{i % (vol.num_faces() + 1)};
+            if (!(on_face < vol.num_faces()))
+            {
+                on_face = {};
+            }
+
+            TempNextFace scalar_temp = make_temp(0);
+            auto         calc_scalar = make_surface_action(
+                surfaces,
+                CalcIntersections<IsFinite>{
+                    pos, dir, IsFinite{}, on_face, false, scalar_temp});
+            for (SurfaceId sid : vol.faces())
+            {
+                calc_scalar(sid);
+            }
+
+            TempNextFace batch_temp = make_temp(max_isect);
+            auto         calc_batch = make_surface_type_action(
+                CalcBatchIntersections<IsFinite>{
+                    pos, dir, IsFinite{}, on_face, false, batch_temp});
+            for (const FaceBatchRecord& batch : vol.face_batches())
+            {
+                calc_batch(
+                    batch.type, vol.batch_faces(batch), vol.batch_data(batch));
+            }
+            EXPECT_EQ(vol.num_faces(), calc_batch.action().num_faces());
+
+            EXPECT_EQ(
+                to_sorted(scalar_temp, calc_scalar.action().isect_idx()),
+                to_sorted(batch_temp, calc_batch.action().isect_idx()))
+                << "for volume " << this->id_to_label(vid);
+        }
+    }
+}
+
+TEST_F(TestEm3Test, intersect_tie)
+{
+    SimpleUnitTracker tracker(this->params().host_ref(), SimpleUnitId{0});
+
+    // Aim exactly at the edge between the first absorber (a y plane with a
+    // lower face index) and the next layer (an x plane intersected first on
+    // the host): the lower face should be chosen
+    const real_type delta = 0.125;
+    Real3           pos{-19.77 - delta, -20 + delta, 0};
+    ASSERT_EQ(delta, -19.77 - pos[0]);
+    auto state = this->make_state(pos, {1, -1, 0}, "gap_lv_0");
+    auto isect = tracker.intersect(state);
+    EXPECT_TRUE(isect);
+    EXPECT_EQ("absorber_lv_0.my", this->id_to_label(isect.surface.id()));
+    EXPECT_SOFT_EQ(delta * sqrt_two, isect.distance);
+}
+
+TEST_F(TestEm3Test, cross_boundary)
+{
+    SimpleUnitTracker tracker(this->params().host_ref(), SimpleUnitId{0});
+
+    {
+        SCOPED_TRACE("Into a layer through a side shared by all layers");
+        auto state = this->make_state_crossing(
+            {0.1, 20, 0}, {0, -1, 0}, "world_lv", "absorber_lv_0.py", '+');
+        auto init = tracker.cross_boundary(state);
+        EXPECT_EQ("gap_lv_25", this->id_to_label(init.volume));
+        EXPECT_EQ("absorber_lv_0.py", this->id_to_label(init.surface.id()));
+        EXPECT_EQ(Sense::inside, init.surface.unchecked_sense());
+        EXPECT_LE(init.num_tested, 3);
+    }
+    {
+        SCOPED_TRACE("Out of a layer through a shared side");
+        auto state = this->make_state_crossing(
+            {0.1, 0, -20}, {0, 0, -1}, "gap_lv_25", "absorber_lv_0.mz", '+');
+        auto init = tracker.cross_boundary(state);
+        EXPECT_EQ("world_lv", this->id_to_label(init.volume));
+        EXPECT_EQ(Sense::inside, init.surface.unchecked_sense());
+        EXPECT_LE(init.num_tested, 3);
+    }
+    {
+        SCOPED_TRACE("Between layers");
+        auto state = this->make_state_crossing(
+            {-20, 1, 2}, {1, 0, 0}, "world_lv", "calorimeter_lv.mx", '-');
+        auto init = tracker.cross_boundary(state);
+        EXPECT_EQ("gap_lv_0", this->id_to_label(init.volume));
+        EXPECT_EQ(1, init.num_tested);
+    }
+}
+
+TEST_F(TestEm3Test, heuristic_init)
+{
+    size_type num_tracks = 8192;
+
+    // clang-format off
+    static const double expected_vol_fractions[]
+        = {0, 0.4171142578125, 0.0020751953125, 0.0089111328125,
+           0.0037841796875, 0.0079345703125, 0.00341796875, 0.0091552734375,
+           0.0032958984375, 0.0064697265625, 0.004150390625, 0.008544921875,
+           0.00341796875, 0.0086669921875, 0.0040283203125, 0.0069580078125,
+           0.002197265625, 0.0078125, 0.0040283203125, 0.0098876953125,
+           0.0023193359375, 0.0086669921875, 0.0037841796875, 0.0078125,
+           0.0040283203125, 0.008544921875, 0.0042724609375, 0.009033203125,
+           0.0020751953125, 0.0107421875, 0.0029296875, 0.0089111328125,
+           0.004150390625, 0.0087890625, 0.0029296875, 0.0086669921875,
+           0.0032958984375, 0.007080078125, 0.003173828125, 0.0086669921875,
+           0.003173828125, 0.008056640625, 0.0030517578125, 0.009033203125,
+           0.0037841796875, 0.0086669921875, 0.003173828125, 0.0086669921875,
+           0.003173828125, 0.0096435546875, 0.003173828125, 0.008056640625,
+           0.0028076171875, 0.0074462890625, 0.0035400390625, 0.009033203125,
+           0.003173828125, 0.0089111328125, 0.0025634765625, 0.0072021484375,
+           0.0042724609375, 0.008056640625, 0.002685546875, 0.0079345703125,
+           0.0030517578125, 0.009521484375, 0.0028076171875, 0.0067138671875,
+           0.004150390625, 0.0091552734375, 0.003173828125, 0.0081787109375,
+           0.0030517578125, 0.008056640625, 0.0035400390625, 0.0086669921875,
+           0.003173828125, 0.0089111328125, 0.0029296875, 0.0091552734375,
+           0.004150390625, 0.008056640625, 0.0025634765625, 0.0074462890625,
+           0.0029296875, 0.0108642578125, 0.00244140625, 0.0072021484375,
+           0.003173828125, 0.008544921875, 0.002197265625, 0.0086669921875,
+           0.0029296875, 0.00732421875, 0.00390625, 0.0068359375,
+           0.00390625, 0.0072021484375, 0.0025634765625, 0.0096435546875,
+           0.0028076171875, 0.0093994140625};
+    // clang-format on
+
+    {
+        SCOPED_TRACE("Host heuristic");
+        auto result = this->run_heuristic_init_host(num_tracks);
+        EXPECT_VEC_SOFT_EQ(expected_vol_fractions, result.vol_fractions);
+        EXPECT_SOFT_EQ(0, result.failed);
+    }
+    if (CELER_USE_DEVICE)
+    {
+        SCOPED_TRACE("Device heuristic");
+        auto result = this->run_heuristic_init_device(num_tracks);
+        EXPECT_VEC_SOFT_EQ(expected_vol_fractions, result.vol_fractions);
+        EXPECT_SOFT_EQ(0, result.failed);
+    }
+}
+
+TEST_F(TestEm3Test, DISABLED_benchmark)
+{
+    size_type num_tracks = 1 << 18;
+
+    const auto& host_ref = this->params().host_ref();
+    const auto& unit     = host_ref.simple_unit[SimpleUnitId{0}];
+    const auto& state    = this->host_state();
+
+    std::mt19937             rng;
+    const auto&              bbox = this->params().bbox();
+    UniformBoxDistribution<> sample_box{bbox.lower(), bbox.upper()};
+
+    // Reference: test every volume in the unit
+    size_type num_found = 0;
+    Stopwatch get_linear_time;
+    for (size_type i = 0; i < num_tracks; ++i)
+    {
+        ::celeritas::detail::SenseCalculator calc_senses{
+            Surfaces{host_ref, unit.surfaces},
+            sample_box(rng),
+            state.temp_sense[AllItems<Sense>{}]};
+        for (auto vid : range(VolumeId{unit.volumes.size()}))
+        {
+            VolumeView vol{host_ref, unit, vid};
+            auto       senses = calc_senses(vol).senses;
+            if (::celeritas::detail::LogicEvaluator{vol.logic()}(senses))
+            {
+                ++num_found;
+                break;
+            }
+        }
+    }
+    double linear_time = get_linear_time();
+    EXPECT_GT(num_found, 0);
+
+    auto result = this->run_heuristic_init_host(num_tracks);
+    EXPECT_SOFT_EQ(0, result.failed);
+
+    cout << "Initialization time per track: " << result.walltime_per_track_ns
+         << " ns with BVH, " << linear_time * 1e9 / num_tracks
+         << " ns with linear search" << std::endl;
+}
+
+TEST_F(PolyPrismTest, intersect)
+{
+    SimpleUnitTracker tracker(this->params().host_ref(), SimpleUnitId{0});
+
+    {
+        SCOPED_TRACE("Through a prism side");
+        real_type theta = constants::pi / 64;
+        auto      state = this->make_state(
+            {0, 0, 1}, {std::cos(theta), std::sin(theta), 0}, "prism");
+        auto isect = tracker.intersect(state);
+        EXPECT_TRUE(isect);
+        EXPECT_EQ("prism.p0", this->id_to_label(isect.surface.id()));
+        EXPECT_EQ(Sense::inside, isect.surface.unchecked_sense());
+        EXPECT_SOFT_EQ(5, isect.distance);
+    }
+    {
+        SCOPED_TRACE("Through a prism cap");
+        auto state = this->make_state({1, 2, 3}, {0, 0, 1}, "prism");
+        auto isect = tracker.intersect(state);
+        EXPECT_TRUE(isect);
+        EXPECT_EQ("prism.pz", this->id_to_label(isect.surface.id()));
+        EXPECT_SOFT_EQ(2, isect.distance);
+    }
+    {
+        SCOPED_TRACE("Into the prism from the world");
+        auto state = this->make_state({-9, 0, 0}, {1, 0, 0}, "world");
+        auto isect = tracker.intersect(state);
+        EXPECT_TRUE(isect);
+        EXPECT_EQ(Sense::outside, isect.surface.unchecked_sense());
+        EXPECT_SOFT_EQ(9 - 5 / std::cos(constants::pi / 64), isect.distance);
+    }
+}
+
+TEST_F(PolyPrismTest, DISABLED_benchmark_intersect)
+{
+    using ::celeritas::detail::CalcBatchIntersections;
+    using ::celeritas::detail::CalcIntersections;
+    using ::celeritas::detail::IsFinite;
+    using ::celeritas::detail::TempNextFace;
+
+    const size_type num_rays = 1 << 18;
+
+    const auto& host_ref = this->params().host_ref();
+    const auto& unit     = host_ref.simple_unit[SimpleUnitId{0}];
+    Surfaces    surfaces{host_ref, unit.surfaces};
+    VolumeView  vol{host_ref, unit, this->find_volume("prism")};
+    ASSERT_EQ(66, vol.num_faces());
+    ASSERT_EQ(2, vol.face_batches().size());
+
+    const size_type        max_isect = host_ref.scalars.max_intersections;
+    std::vector<FaceId>    faces(max_isect);
+    std::vector<real_type> distances(max_isect);
+    std::vector<size_type> isects(max_isect);
+    TempNextFace           temp;
+    temp.face     = faces.data();
+    temp.distance = distances.data();
+    temp.isect    = isects.data();
+    temp.size     = max_isect;
+
+    // Sample rays inside the prism
+    std::mt19937             rng;
+    UniformBoxDistribution<> sample_box{{-3, -3, -4}, {3, 3, 4}};
+    IsotropicDistribution<>  sample_dir;
+    std::vector<std::pair<Real3, Real3>> rays(num_rays);
+    for (auto& ray : rays)
+    {
+        ray = {sample_box(rng), sample_dir(rng)};
+    }
+
+    // Reference: intersect each face separately
+    size_type num_scalar = 0;
+    Stopwatch get_scalar_time;
+    for (const auto& ray : rays)
+    {
+        auto calc_scalar = make_surface_action(
+            surfaces,
+            CalcIntersections<IsFinite>{
+                ray.first, ray.second, IsFinite{}, FaceId{}, true, temp});
+        for (SurfaceId sid : vol.faces())
+        {
+            calc_scalar(sid);
+        }
+        num_scalar += calc_scalar.action().isect_idx();
+    }
+    double scalar_time = get_scalar_time();
+
+    // Intersect all faces of each type together
+    size_type num_batch = 0;
+    Stopwatch get_batch_time;
+    for (const auto& ray : rays)
+    {
+        auto calc_batch = make_surface_type_action(
+            CalcBatchIntersections<IsFinite>{
+                ray.first, ray.second, IsFinite{}, FaceId{}, true, temp});
+        for (const FaceBatchRecord& batch : vol.face_batches())
+        {
+            calc_batch(
+                batch.type, vol.batch_faces(batch), vol.batch_data(batch));
+        }
+        num_batch += calc_batch.action().isect_idx();
+    }
+    double batch_time = get_batch_time();
+    EXPECT_EQ(num_scalar, num_batch);
+
+    cout << "Intersection time per ray for " << vol.num_faces()
+         << " faces: " << scalar_time * 1e9 / num_rays << " ns scalar, "
+         << batch_time * 1e9 / num_rays << " ns batched" << std::endl;
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(RotatedCylinderTest, safety)
+{
+    SimpleUnitTracker tracker(this->params().host_ref(), SimpleUnitId{0});
+    VolumeId          cyl   = this->find_volume("cyl");
+    VolumeId          world = this->find_volume("world");
+
+    // Inside, the general quadric bound is exact for a cylinder
+    EXPECT_SOFT_EQ(1.0, tracker.safety({0, 0, 0}, cyl));
+    EXPECT_SOFT_EQ(0.5, tracker.safety({1, 1, 0.5}, cyl));
+    EXPECT_SOFT_EQ(1 - sqrt_half, tracker.safety({0.5, -0.5, 0}, cyl));
+
+    // Outside, it's nonzero but less than the true distance of sqrt(8) - 1
+    const real_type bound = tracker.safety({2, -2, 0}, world);
+    EXPECT_SOFT_EQ(1.0445562214612267, bound);
+    EXPECT_LT(bound, 2 * sqrt_two - 1);
+
+    // Near the surface it approaches the true distance
+    const real_type r = 1.01 * sqrt_half;
+    EXPECT_SOFT_NEAR(0.01, tracker.safety({r, -r, 0}, world), 0.02);
+}
+
+TEST_F(RotatedCylinderTest, average_safety)
+{
+    // Exact distance to the nearest face of either volume
+    auto calc_exact = [](const Real3& pos) {
+        const real_type along = (pos[0] + pos[1]) * sqrt_half;
+        const real_type rho = std::sqrt(dot_product(pos, pos) - ipow<2>(along));
+        real_type       result = std::fabs(rho - 1);
+        for (real_type x : pos)
+        {
+            result = std::fmin(result, 5 - std::fabs(x));
+        }
+        return result;
+    };
+
+    SimpleUnitTracker tracker(this->params().host_ref(), SimpleUnitId{0});
+    const VolumeId    cyl = this->find_volume("cyl");
+
+    // Sample points near the cylinder, where its surface limits the safety
+    std::mt19937             rng;
+    UniformBoxDistribution<> sample_box{{-3, -3, -3}, {3, 3, 3}};
+    std::vector<double>      total_safety(2);
+    std::vector<double>      total_exact(2);
+    std::vector<int>         num_points(2);
+    for (int i = 0; i < 4096; ++i)
+    {
+        const Real3 pos   = sample_box(rng);
+        auto        state = this->make_state(pos, {1, 0, 0});
+        auto        init  = tracker.initialize(state);
+        ASSERT_TRUE(init.volume);
+        const real_type safety = tracker.safety(pos, init.volume);
+        const real_type exact  = calc_exact(pos);
+        EXPECT_LE(safety, exact * (1 + 1e-12)) << repr(pos);
+
+        // Previously, any volume bounded by a general quadric had zero safety
+        EXPECT_GT(safety, 0) << repr(pos);
+
+        const int idx = (init.volume == cyl ? 0 : 1);
+        total_safety[idx] += safety;
+        total_exact[idx] += exact;
+        ++num_points[idx];
+    }
+
+    // Since MSC limits the step to a fraction of the safety, the ratio
+    // approximates the change in the step length relative to exact safety
+    std::vector<double> safety_ratio;
+    for (auto i : range(2))
+    {
+        ASSERT_GT(num_points[i], 0);
+        safety_ratio.push_back(total_safety[i] / total_exact[i]);
+    }
+    static const double expected_safety_ratio[] = {1, 0.618053858605516};
+    EXPECT_VEC_SOFT_EQ(expected_safety_ratio, safety_ratio);
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(QuadricsTest, simplified)
+{
+    // General quadrics without cross terms are stored as simple surfaces
+    const auto& host_ref = this->params().host_ref();
+    Surfaces surfaces(host_ref, host_ref.simple_unit[SimpleUnitId{0}].surfaces);
+
+    std::vector<std::string> types;
+    for (auto id : range(SurfaceId{surfaces.num_surfaces()}))
+    {
+        types.push_back(to_cstring(surfaces.surface_type(id)));
+    }
+    static const std::string expected_types[] = {
+        "px", "px", "py", "py", "pz", "pz", "s", "czc", "kz", "pz", "pz"};
+    EXPECT_VEC_EQ(expected_types, types);
+
+    // Tracking through the simplified surfaces is unchanged
+    SimpleUnitTracker tracker(host_ref, SimpleUnitId{0});
+    const VolumeId    sph   = this->find_volume("sph");
+    const VolumeId    cyl   = this->find_volume("cyl");
+    const VolumeId    cone  = this->find_volume("cone");
+    const VolumeId    world = this->find_volume("world");
+    {
+        auto state = this->make_state({-9, 0, 0}, {1, 0, 0}, "world");
+        auto isect = tracker.intersect(state);
+        EXPECT_TRUE(isect);
+        EXPECT_SOFT_EQ(3.0, isect.distance);
+    }
+    {
+        std::vector<VolumeId> volumes;
+        for (Real3 pos : {Real3{-5, 0, 0.5},
+                          Real3{0.5, 0, 0.5},
+                          Real3{5, 0.25, 0.5},
+                          Real3{5, 0.75, 0.5}})
+        {
+            auto init = tracker.initialize(this->make_state(pos, {1, 0, 0}));
+            volumes.push_back(init.volume);
+        }
+        const std::vector<VolumeId> expected_volumes{sph, cyl, cone, world};
+        EXPECT_EQ(expected_volumes, volumes);
+    }
+
+    // Every volume is bounded by simple surfaces
+    EXPECT_SOFT_EQ(1.0, tracker.safety({-5, 0, 0}, sph));
+    EXPECT_SOFT_EQ(0.5, tracker.safety({0, 0, 0.5}, cyl));
+}
+
 //---------------------------------------------------------------------------//
 } // namespace test
 } // namespace celeritas
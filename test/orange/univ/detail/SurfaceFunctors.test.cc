@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #include "orange/univ/detail/SurfaceFunctors.hh"
 
+#include "corecel/io/Repr.hh"
+#include "corecel/math/ArrayUtils.hh"
 #include "orange/OrangeData.hh"
 #include "orange/OrangeGeoTestBase.hh"
 #include "orange/construct/OrangeInput.hh"
@@ -150,6 +152,96 @@ TEST_F(SurfaceFunctorsTest, calc_safety_distance)
     pos = {3.5, 1, 0};
     EXPECT_SOFT_EQ(2.25, calc_distance(SurfaceId{0}));
     EXPECT_SOFT_EQ(0.0, calc_distance(SurfaceId{1}));
+
+    // Center of the sphere
+    pos = {2.25, 1, 0};
+    EXPECT_SOFT_EQ(1.25, calc_distance(SurfaceId{1}));
+}
+
+TEST_F(SurfaceFunctorsTest, calc_safety_distance_quadric)
+{
+    Real3 pos;
+
+    CalcSafetyDistance calc_distance{pos};
+
+    // Plane x = 1: exact
+    GeneralQuadric plane{{0, 0, 0}, {0, 0, 0}, {1, 0, 0}, -1};
+    pos = {3, 5, 0};
+    EXPECT_SOFT_EQ(2.0, calc_distance(plane));
+    pos = {1, 5, 0};
+    EXPECT_SOFT_EQ(0.0, calc_distance(plane));
+
+    // Unit sphere: conservative outside, exact at the center and surface
+    GeneralQuadric sphere{{1, 1, 1}, {0, 0, 0}, {0, 0, 0}, -1};
+    pos = {2, 0, 0};
+    EXPECT_SOFT_EQ(0.6457513110645906, calc_distance(sphere));
+    pos = {0, 0, 0};
+    EXPECT_SOFT_EQ(1.0, calc_distance(sphere));
+    pos = {0, 0, 1};
+    EXPECT_SOFT_EQ(0.0, calc_distance(sphere));
+
+    // Unit cylinder along the (1, 1, 0) direction: the bound must never
+    // exceed the true distance to the surface
+    GeneralQuadric cyl{{0.5, 0.5, 1}, {-1, 0, 0}, {0, 0, 0}, -1};
+    const Real3    axis = {1 / std::sqrt(2.0), 1 / std::sqrt(2.0), 0};
+    for (real_type x : {-2.0, -0.5, 0.0, 0.25, 1.5})
+    {
+        for (real_type z : {-3.0, -0.9, 0.0, 0.5, 2.0})
+        {
+            pos = {x, 0.5, z};
+
+            Real3 perp = pos;
+            axpy(-dot_product(pos, axis), axis, &perp);
+            real_type expected = std::fabs(norm(perp) - 1);
+
+            real_type actual = calc_distance(cyl);
+            EXPECT_LE(actual, expected * (1 + 1e-12)) << "at " << repr(pos);
+            EXPECT_GT(actual, 0.25 * expected) << "at " << repr(pos);
+        }
+    }
+}
+
+TEST_F(SurfaceFunctorsTest, calc_safety_distance_other)
+{
+    Real3 pos;
+
+    CalcSafetyDistance calc_distance{pos};
+
+    // Exact distances
+    Plane plane{{1 / std::sqrt(2.0), 1 / std::sqrt(2.0), 0}, Real3{1, 1, 0}};
+    pos = {0, 0, 3};
+    EXPECT_SOFT_EQ(std::sqrt(2.0), calc_distance(plane));
+    pos = {2, 2, -1};
+    EXPECT_SOFT_EQ(std::sqrt(2.0), calc_distance(plane));
+
+    CylY cyl{{1, 100, 2}, 0.5};
+    pos = {1, -3, 2.25};
+    EXPECT_SOFT_EQ(0.25, calc_distance(cyl));
+    pos = {4, 10, 6};
+    EXPECT_SOFT_EQ(4.5, calc_distance(cyl));
+
+    // Quadric bound for a sphere is the same as for the general quadric
+    SimpleQuadric sphere{{1, 1, 1}, {0, 0, 0}, -1};
+    pos = {2, 0, 0};
+    EXPECT_SOFT_EQ(0.6457513110645906, calc_distance(sphere));
+    pos = {0, 0, 0};
+    EXPECT_SOFT_EQ(1.0, calc_distance(sphere));
+
+    // Cone with 45-degree half-angle about z: lower bound on true distance
+    ConeZ cone{{0, 0, 1}, 1.0};
+    for (real_type rho : {0.0, 0.5, 1.0, 3.0})
+    {
+        for (real_type z : {-2.0, -0.5, 0.0, 1.0, 1.75, 4.0})
+        {
+            pos = {rho, 0, z};
+            real_type expected
+                = std::fabs(rho - std::fabs(z - 1)) / std::sqrt(2.0);
+
+            real_type actual = calc_distance(cone);
+            EXPECT_LE(actual, expected * (1 + 1e-12)) << "at " << repr(pos);
+            EXPECT_GE(actual, 0.25 * expected) << "at " << repr(pos);
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//